@@ -36,6 +36,18 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -186,6 +198,12 @@ cbga_fkcentroid
     llfh_listFuntionHist
     (aiinParam_CBGA.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinParam_CBGA.getNumMaxGenerations(),
+     aiinParam_CBGA
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -313,13 +331,46 @@ cbga_fkcentroid
     /*BEGIN 1. GENERATE S RANDOM SOLUTIONS
      */
     long ll_invalidOffspring = 0;
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinParam_CBGA.getOpInitialization(),
+       lconstui_numInstances,
+       aiinParam_CBGA.getOversamplingInitialization() * lconstui_numClusterFk,
+       aiinParam_CBGA.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinParam_CBGA.getFileNameWarmStart(),
+       aiinParam_CBGA.getFractionWarmStart(),
+       aiinParam_CBGA.getPerturbationWarmStart(),
+       aiinParam_CBGA.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for ( auto literchrom_cbga: lvectorchromcbga_populationNew ) {
-       
-      clusteringop::randomInitialize
-	(literchrom_cbga->getCodeBook(), 
-	 aiiterator_instfirst,
-	 aiiterator_instlast
-	 );
+
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (literchrom_cbga->getCodeBook(),
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else if ( lseeds_initial.isRandom() ) 
+	clusteringop::randomInitialize
+	  (literchrom_cbga->getCodeBook(), 
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else
+	clusteringop::seedsInitialize
+	  (literchrom_cbga->getCodeBook(), 
+	   aiiterator_instfirst,
+	   lseeds_initial.select(lconstui_numClusterFk,lcostseeds_instances)
+	   );
 
       /*Generate optimal Partitioning
        */
@@ -476,8 +527,13 @@ cbga_fkcentroid
 #endif  /*__WITHOUT_PLOT_STAT */
 
 
-  while ( llfh_listFuntionHist.getDomainUpperBound() < 
-	  aiinParam_CBGA.getNumMaxGenerations()) {
+  /*THE OBJECTIVE FUNCTION IS MINIMIZED, THE FITNESS IS 1/SSE AS IN KGA
+   */
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound(),
+	   runtime::elapsedTime(let_executionTime),
+	   1.0 / lT_bestObjeticeFunc
+	   ) ) {
    
     llfh_listFuntionHist.increaseDomainUpperBound();
     
@@ -941,6 +997,8 @@ cbga_fkcentroid
 
   aoop_outParamGAC.setFitness
     (OUTPARAMCLUSTERING_FITNESS_NaN);
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -32,6 +32,7 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 
 
 /*! \namespace eac
@@ -136,6 +137,12 @@ cga_vklabel
     llfh_listFuntionHist
     (aiinp_inParamWithoutPcPmVk.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamWithoutPcPmVk.getNumMaxGenerations(),
+     aiinp_inParamWithoutPcPmVk
+     );
+
  
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
@@ -261,11 +268,12 @@ cga_vklabel
 
   llfh_listFuntionHist.increaseDomainUpperBound();
 
-  while ( ( llfh_listFuntionHist.getDomainUpperBound() <= 
-	    aiinp_inParamWithoutPcPmVk.getNumMaxGenerations() )
-          && ( runtime::elapsedTime(let_executionTime)
-	       < aiinp_inParamWithoutPcPmVk.getMaxExecutiontime() )
-	  ) {
+  /*THE GENERATION IS COUNTED BEFORE IT IS EVALUATED*/
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound() - 1,
+	   runtime::elapsedTime(let_executionTime),
+	   lochromfixleng_best.getFitness()
+	   ) ) {
 
     { /*BEGIN FITNESS COMPUTATION*/
 
@@ -671,6 +679,8 @@ cga_vklabel
     (lochromfixleng_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
         
@@ -31,6 +31,7 @@
 #include <leac.hpp>
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 
 #include "inparam_subclusterbinaryvk.hpp"
 #include "outparam_gac.hpp"
@@ -131,6 +132,12 @@ clustering_genetic
     llfh_listFuntionHist
     (aiinp_inParamSubClusterBinVk.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamSubClusterBinVk.getNumMaxGenerations(),
+     aiinp_inParamSubClusterBinVk
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -621,7 +628,11 @@ clustering_genetic
     --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
 
-    if ( (llfh_listFuntionHist.getDomainUpperBound() >= aiinp_inParamSubClusterBinVk.getNumMaxGenerations() ) )
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(aiet_executionTime),
+	  lochrom_best.getFitness()
+	  ) )
       break;
    
     /*Selection
@@ -899,6 +910,10 @@ clustering_genetic
   --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
 
+  /*THE CRITERION OF THE LAST CALL IS REPORTED*/
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
+
   return lochrom_best;  
  
 } /* END clustering_genetic */
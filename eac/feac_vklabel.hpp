@@ -41,6 +41,23 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+#include "ga_island.hpp"
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -178,6 +195,12 @@ feca_vklabel
     llfh_listFuntionHist
     (aiinp_inParamFEAC.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamFEAC.getNumMaxGenerations(),
+     aiinp_inParamFEAC
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -275,6 +298,26 @@ feca_vklabel
     std::uniform_int_distribution<uintidx> uniformdis_idxInstances
       (0,lui_numInstances-1);
     
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamFEAC.getOpInitialization(),
+       lui_numInstances,
+       aiinp_inParamFEAC.getOversamplingInitialization() * aiinp_inParamFEAC.getNumClusterKMaximum(),
+       aiinp_inParamFEAC.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamFEAC.getFileNameWarmStart(),
+       aiinp_inParamFEAC.getFractionWarmStart(),
+       aiinp_inParamFEAC.getPerturbationWarmStart(),
+       aiinp_inParamFEAC.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for (uintidx luintidx_i = 0; 
 	 luintidx_i < aiinp_inParamFEAC.getSizePopulation(); 
 	 luintidx_i++) 
@@ -290,13 +333,42 @@ feca_vklabel
 	   data::Instance<T_FEATURE>::getNumDimensions()
 	   );
 	
-	clusteringop::randomInitialize
-	  (liter_iChrom.getCentroids(),
-	   liter_iChrom.getString(),
-	   liter_iChrom.getNumInstancesClusterK(),
-	   aiiterator_instfirst,
-	   aiiterator_instlast
-	   );
+	if ( lwarmstart_population.hasNext() ) {
+	  /*THE INSTANCES ARE ASSIGNED BY THE K-MEANS
+	   */
+	  lwarmstart_population.initialize
+	    (liter_iChrom.getCentroids(),
+	     aiiterator_instfirst,
+	     aiiterator_instlast
+	     );
+	  interfacesse::copya
+	    (liter_iChrom.getString(),
+	     T_CLUSTERIDX(NEARESTCENTROID_UNKNOWN),
+	     lui_numInstances
+	     );
+	  std::fill
+	    (liter_iChrom.getNumInstancesClusterK().begin(),
+	     liter_iChrom.getNumInstancesClusterK().end(),
+	     T_INSTANCES_CLUSTER_K(0)
+	     );
+	}
+	else if ( lseeds_initial.isRandom() ) 
+	  clusteringop::randomInitialize
+	    (liter_iChrom.getCentroids(),
+	     liter_iChrom.getString(),
+	     liter_iChrom.getNumInstancesClusterK(),
+	     aiiterator_instfirst,
+	     aiiterator_instlast
+	     );
+	else
+	  clusteringop::seedsInitialize
+	    (liter_iChrom.getCentroids(),
+	     liter_iChrom.getString(),
+	     liter_iChrom.getNumInstancesClusterK(),
+	     aiiterator_instfirst,
+	     aiiterator_instlast,
+	     lseeds_initial.select(luintidx_krand,lcostseeds_instances)
+	     );
 	
 	liter_iChrom.setObjetiveFunc(-1.0);
 	liter_iChrom.setFitness(0);
@@ -640,15 +712,26 @@ feca_vklabel
       papers do not consider this option
     */
 
-    if ( (aiinp_inParamFEAC.getDesiableObjetiveFunc()
-	  <  (lochrom_best.getObjetiveFunc() )) || 
-	 (llfh_listFuntionHist.getDomainUpperBound() >=
-	  aiinp_inParamFEAC.getNumMaxGenerations()) ||
-	 (runtime::elapsedTime(let_executionTime) >
-	  aiinp_inParamFEAC.getMaxExecutiontime() )
-	 )
+    if ( aiinp_inParamFEAC.getDesiableObjetiveFunc()
+	 <  lochrom_best.getObjetiveFunc() )
+      lterminationcriteria.setAttained(runtime::TERMINATION_ALGORITHM);
+    
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(let_executionTime),
+	  lochrom_best.getFitness()
+	  ) )
       break;
 
+    /*MIGRATION BETWEEN THE ISLANDS, THE FITNESS IS A RANKING OF THE
+      ISLAND, SO THE CHROMOSOMES ARE COMPARED BY THE OBJECTIVE FUNCTION
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchrom_population,
+       gaisland::ObjetiveFuncChromosome()
+       );
+
     std::vector
       <gaencode::ChromosomeFEAC
        <T_CLUSTERIDX,T_REAL,T_FEATURE,T_FEATURE_SUM,T_INSTANCES_CLUSTER_K> >
@@ -876,6 +959,8 @@ feca_vklabel
     (lochrom_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
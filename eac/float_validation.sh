@@ -0,0 +1,70 @@
+#
+# Compare the float features build (-D __FLOAT_INSTANCES__) with the
+# double build of the same algorithm. Both binaries run with the same
+# seeds, the relative difference of each metric and the execution
+# time are printed
+#
+# use:
+# sh float_validation.sh binary dataset numberClusters [numberOfRun] [tolerance] [options...]
+#   ej  sh float_validation.sh gas_fkcentroid iris.data 3 10 1e-4 -c 5
+#   compares ./gas_fkcentroid with ./gas_fkcentroid_float
+#
+if [ "$#" -lt 3 ]; then
+  echo
+  echo "Usage: $0 binary dataset numberClusters [numberOfRun] [tolerance] [options...]" >&2
+  exit 1
+fi
+
+BIN_DOUBLE=$1
+BIN_FLOAT=$1"_float"
+DATASET=$2
+NUMBER_CLUSTERS=$3
+NUM_RUN=10
+TOLERANCE=1e-4
+shift 3
+if [ "$#" -gt 0 ]; then
+NUM_RUN=$1
+shift
+fi
+if [ "$#" -gt 0 ]; then
+TOLERANCE=$1
+shift
+fi
+
+if [ ! -x "$BIN_DOUBLE" ] || [ ! -x "$BIN_FLOAT" ]; then
+  echo
+  echo "Not found the executables: $BIN_DOUBLE $BIN_FLOAT (make $BIN_DOUBLE $BIN_FLOAT)" >&2
+  exit 1
+fi
+
+METRICS="_SED _SSE _Silhouette _DB-index _Variance Ratio Criterion _Purity"
+STATUS=0
+RUN=1
+while [ $RUN -le $NUM_RUN ]; do
+  OUT_DOUBLE=$( ./$BIN_DOUBLE -i $DATASET -z $RUN --number-clusters=$NUMBER_CLUSTERS "$@" 2>/dev/null | grep '_inout,out' )
+  OUT_FLOAT=$( ./$BIN_FLOAT -i $DATASET -z $RUN --number-clusters=$NUMBER_CLUSTERS "$@" 2>/dev/null | grep '_inout,out' )
+  printf "%s\n%s\n" "$OUT_DOUBLE" "$OUT_FLOAT" | \
+  awk -F"," -v run="$RUN" -v tol="$TOLERANCE" -v metrics="$METRICS" '
+  BEGIN { nm = split(metrics, lm, " _"); }
+  {
+    for (j = 1; j < NF; j++) { value[NR, $j] = $(j+1); }
+  }
+  END {
+    st = 0;
+    printf("run %d: time double %.4f float %.4f", run, value[1, "_execution time seconds"], value[2, "_execution time seconds"]);
+    for (m = 1; m <= nm; m++) {
+      name = (m == 1) ? lm[m] : "_" lm[m];
+      vd = value[1, name]; vf = value[2, name];
+      den = (vd < 0) ? -vd : vd;
+      dif = vd - vf; if (dif < 0) dif = -dif;
+      rel = (den > 0) ? dif / den : dif;
+      printf(", %s %g", name, rel);
+      if (rel > tol) st = 1;
+    }
+    printf("%s\n", (st == 1) ? " FAIL" : " ok");
+    exit st;
+  }' || STATUS=1
+  RUN=$( expr $RUN + 1 )
+done
+
+exit $STATUS
@@ -32,6 +32,7 @@
 #include <leac.hpp>
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 #include "inparam_withoutpcpmfk.hpp"
 #include "outparam_gac.hpp"
 
@@ -160,6 +161,12 @@ gaclustering_fkcrispmatrix
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamWithoutPcPmFk.getNumMaxGenerations(),
+     aiinp_inParamWithoutPcPmFk
+     );
+
   /*Declaration of variables: computing statistical 
     and metric of the algorithm
    */
@@ -512,11 +519,11 @@ gaclustering_fkcrispmatrix
 
     /*Termination criterion attained?
      */
-    if ( (llfh_listFuntionHist.getDomainUpperBound()
-	  >= aiinp_inParamWithoutPcPmFk.getNumMaxGenerations()) ||
-	 (runtime::elapsedTime(let_executionTime) >
-	  aiinp_inParamWithoutPcPmFk.getMaxExecutiontime())
-	 )
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(let_executionTime),
+	  lochrombitcrispmatrix_best.getFitness()
+	  ) )
       break;
   
     /*Selection
@@ -879,6 +886,8 @@ gaclustering_fkcrispmatrix
  
   aoop_outParamGAC.setFitness
     (lochrombitcrispmatrix_best.getObjetiveFunc());
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -34,6 +34,7 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -102,10 +103,16 @@ gaclustering_fklabel
   std::vector<gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>* >  
     lvectorchromfixleng_population;
 
-  /*SPACE FOR STORE MATINGPOOL
+  /*SPACE FOR STORE OFFSPRING
    */
   std::vector<gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>* >  
-    lvectorchromfixleng_matingPool;
+    lvectorchromfixleng_offspring;
+
+  /*SPACE FOR STORE MATINGPOOL, THE INDEXES OF THE PARENTS
+   */
+  std::vector<uintidx>
+    lvectorui_idxMatingPool
+    (aiinpcgaprobfixedk_inParamGA.getSizePopulation());
 
 
 #ifdef __VERBOSE_YES
@@ -147,6 +154,12 @@ gaclustering_fklabel
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinpcgaprobfixedk_inParamGA.getNumMaxGenerations(),
+     aiinpcgaprobfixedk_inParamGA
+     );
+
  
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
@@ -210,28 +223,22 @@ gaclustering_fklabel
 
 
   /*POPULATION CREATE-----------------------------------------------------------
+    THE STRINGS OF THE POPULATION AND THE OFFSPRING ARE IN ONE ARENA
    */
+  gaencode::PopulationArena<T_CLUSTERIDX,T_REAL>
+    lpopulationarena_chrom(aiinpcgaprobfixedk_inParamGA.getSizePopulation());
+
   lvectorchromfixleng_population.reserve
     (aiinpcgaprobfixedk_inParamGA.getSizePopulation());
-  for (uintidx luintidx_i = 0; 
-       luintidx_i < aiinpcgaprobfixedk_inParamGA.getSizePopulation(); 
-       luintidx_i++) 
-    {
-      lvectorchromfixleng_population.push_back
-	( new gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>() );
-    }
+  for ( auto& lchromfixleng_iter: lpopulationarena_chrom.getPopulation() ) 
+    lvectorchromfixleng_population.push_back(&lchromfixleng_iter);
  
-  /*CREATE SPACE FOR STORE MATINGPOOL-------------------------------------------
+  /*CREATE SPACE FOR STORE OFFSPRING--------------------------------------------
    */
-  lvectorchromfixleng_matingPool.reserve
+  lvectorchromfixleng_offspring.reserve
     (aiinpcgaprobfixedk_inParamGA.getSizePopulation());
-  for (uintidx luintidx_i = 0; 
-       luintidx_i < aiinpcgaprobfixedk_inParamGA.getSizePopulation(); 
-       luintidx_i++) 
-    {
-      lvectorchromfixleng_matingPool.push_back
-	( new gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>() );
-    }
+  for ( auto& lchromfixleng_iter: lpopulationarena_chrom.getOffspring() ) 
+    lvectorchromfixleng_offspring.push_back(&lchromfixleng_iter);
  
   /*POPULATION INITIAL----------------------------------------------------------
    */
@@ -443,9 +450,11 @@ gaclustering_fklabel
  
   /*ITERATION: STEPS (B), (C), AND (D)
    */
-  while ( (llfh_listFuntionHist.getDomainUpperBound() < 
-	   aiinpcgaprobfixedk_inParamGA.getNumMaxGenerations()) &&
-	  (runtime::elapsedTime(let_executionTime) < aiinpcgaprobfixedk_inParamGA.getMaxExecutiontime() ) ) {
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound(),
+	   runtime::elapsedTime(let_executionTime),
+	   lochromfixleng_best.getFitness()
+	   ) ) {
    
     llfh_listFuntionHist.increaseDomainUpperBound();
 
@@ -477,17 +486,15 @@ gaclustering_fklabel
 	 }
 	 );
 	      
-      /*COPY POPULATION TO MATING POOL FOR ROULETTE WHEEL--
+      /*SELECT THE INDEXES OF THE MATING POOL FOR ROULETTE WHEEL--
        */
-      for ( auto lchromfixleng_iter: lvectorchromfixleng_matingPool) {
+      for ( auto& luiidx_chrom: lvectorui_idxMatingPool) {
 
-	uintidx luiidx_chrom = 
+	luiidx_chrom = 
 	  gaselect::getIdxRouletteWheel
 	  (lvectorT_probDistRouletteWheel,
 	   uintidx(0)
 	   );
-	
-	*lchromfixleng_iter = *lvectorchromfixleng_population.at(luiidx_chrom);
       }
          
 #ifdef __VERBOSE_YES
@@ -519,11 +526,11 @@ gaclustering_fklabel
       
       long ll_invalidOffspring = 0;
 
-     gaiterator::crossover
-      (lvectorchromfixleng_matingPool.begin(),
-       lvectorchromfixleng_matingPool.end(),
+     gaiterator::crossoverIdx
+      (lvectorui_idxMatingPool,
        lvectorchromfixleng_population.begin(),
-       lvectorchromfixleng_population.end(),
+       lvectorchromfixleng_offspring.begin(),
+       lvectorchromfixleng_offspring.end(),
        [&](const gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>* aichrom_parent1,
 	   const gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>* aichrom_parent2,
 	   gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL>*  aochrom_child1, 
@@ -647,6 +654,10 @@ gaclustering_fklabel
 	
       aoop_outParamGAC.sumTotalInvalidOffspring(ll_invalidOffspring);
 
+      /*THE OFFSPRING IS THE NEW POPULATION
+       */
+      lvectorchromfixleng_population.swap(lvectorchromfixleng_offspring);
+
 #ifdef __VERBOSE_YES
       if ( geiinparam_verbose <= geiinparam_verboseMax ) {
 	std::cout << geverbosepc_labelstep
@@ -978,61 +989,6 @@ gaclustering_fklabel
   } /*END While*/
 
   
-  {/*BEGIN FREE MEMORY OF POPULATION*/ 
-    
-#ifdef __VERBOSE_YES
-    geverbosepc_labelstep = "DELETEPOPULATION";
-    ++geiinparam_verbose;
-    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-      std::cout <<  geverbosepc_labelstep
-		<< ":  IN(" << geiinparam_verbose << ')'
-		<< std::endl;
-    }
-#endif /*__VERBOSE_YES*/
-
-    for (uintidx lui_i = 0; lui_i < lvectorchromfixleng_population.size(); ++lui_i) {
-      delete lvectorchromfixleng_population[lui_i];
-    }
-
-#ifdef __VERBOSE_YES
-    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-      std::cout << geverbosepc_labelstep
-		<< ": OUT(" << geiinparam_verbose << ')'
-		<< std::endl;
-    }
-    --geiinparam_verbose;
-#endif /*__VERBOSE_YES*/
-
-  }/*END FREE MEMORY OF POPULATION*/
-    
-  
-  {/*BEGIN FREE MEMORY OF STRINGPOOL*/ 
-    
-#ifdef __VERBOSE_YES
-    geverbosepc_labelstep = "DELETESTRINGPOOL";
-    ++geiinparam_verbose;
-    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-      std::cout <<  geverbosepc_labelstep
-		<< ":  IN(" << geiinparam_verbose << ')'
-		<< std::endl;
-    }
-#endif /*__VERBOSE_YES*/
-    
-    for (uintidx lui_i = 0; lui_i < lvectorchromfixleng_matingPool.size(); ++lui_i) {
-      delete lvectorchromfixleng_matingPool[lui_i];
-    }
-
-#ifdef __VERBOSE_YES
-    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-      std::cout << geverbosepc_labelstep
-		<< ": OUT(" << geiinparam_verbose << ')'
-		<< std::endl;
-    }
-    --geiinparam_verbose;
-#endif /*__VERBOSE_YES*/
-
-  } /*END FREE MEMORY OF STRINGPOOL*/ 
-
   std::unordered_set<T_CLUSTERIDX> lounorderedset_numClusterK;
   lounorderedset_numClusterK.reserve(aiinpcgaprobfixedk_inParamGA.getNumClusterK());
   
@@ -1055,6 +1011,8 @@ gaclustering_fklabel
     (lochromfixleng_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
         
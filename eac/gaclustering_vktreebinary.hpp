@@ -35,6 +35,7 @@
 #include "outparam_gac.hpp"
 #include "container_out.hpp"
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -160,6 +161,12 @@ gaclustering_vktreebinary
      "Iterations",
      "Clustering metrics"
      );
+
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamGenWOChgVk.getNumMaxGenerations(),
+     aiinp_inParamGenWOChgVk
+     );
   
   COMMON_IDOMAIN  lit_iterNotChange =
     aiinp_inParamGenWOChgVk.getNumNotChangeStop();
@@ -664,10 +671,14 @@ gaclustering_vktreebinary
 #endif /*__VERBOSE_YES*/
 
 
-    if ( (llfh_listFuntionHist.getDomainUpperBound() >= aiinp_inParamGenWOChgVk.getNumMaxGenerations() ) || 
-	 (lit_iterNotChange == 0 ) ||
-	 (runtime::elapsedTime(let_executionTime) > aiinp_inParamGenWOChgVk.getMaxExecutiontime())
-	 )
+    if ( lit_iterNotChange == 0 )
+      lterminationcriteria.setAttained(runtime::TERMINATION_ALGORITHM);
+    
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(let_executionTime),
+	  lochrom_best.getFitness()
+	  ) )
       break;
    
     /*3.3 Selection
@@ -947,6 +958,8 @@ gaclustering_vktreebinary
     (lochrom_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -31,6 +31,23 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+#include "ga_island.hpp"
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -115,6 +132,12 @@ gagr_fkcentroid
     llfh_listFuntionHist
     (aiinp_inParamProbAdaptive.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamProbAdaptive.getNumMaxGenerations(),
+     aiinp_inParamProbAdaptive
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT 
   std::ofstream lfileout_plotStatObjetiveFunc;
@@ -269,6 +292,26 @@ gagr_fkcentroid
     }
 #endif /*__VERBOSE_YES*/
 
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamProbAdaptive.getOpInitialization(),
+       uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)),
+       aiinp_inParamProbAdaptive.getOversamplingInitialization() * lconstui_numClusterFk,
+       aiinp_inParamProbAdaptive.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamProbAdaptive.getFileNameWarmStart(),
+       aiinp_inParamProbAdaptive.getFractionWarmStart(),
+       aiinp_inParamProbAdaptive.getPerturbationWarmStart(),
+       aiinp_inParamProbAdaptive.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for ( auto lchromfixleng_iter: lvectorchromfixleng_population ) {
       /*DECODE CHROMOSOME*/
       mat::MatrixRow<T_FEATURE> 
@@ -278,11 +321,24 @@ gagr_fkcentroid
 	 lchromfixleng_iter->getString()
 	 );
 	
-      clusteringop::randomInitialize
-	(lmatrixrowt_centroidsChrom,
-	 aiiterator_instfirst,
-	 aiiterator_instlast
-	 );
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else if ( lseeds_initial.isRandom() ) 
+	clusteringop::randomInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else
+	clusteringop::seedsInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   lseeds_initial.select(lconstui_numClusterFk,lcostseeds_instances)
+	   );
 
       lchromfixleng_iter->setObjetiveFunc(std::numeric_limits<T_REAL>::max());
       lchromfixleng_iter->setFitness(-std::numeric_limits<T_REAL>::min());
@@ -557,8 +613,18 @@ gagr_fkcentroid
       cluster result.
     */
   
-  while ( llfh_listFuntionHist.getDomainUpperBound() 
-	  < aiinp_inParamProbAdaptive.getNumMaxGenerations() ) {
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound(),
+	   runtime::elapsedTime(let_executionTime),
+	   lochromfixleng_best.getFitness()
+	   ) ) {
+
+    /*MIGRATION BETWEEN THE ISLANDS
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchromfixleng_population
+       );
 
     /*4. Select individuals from the population for crossover and muta-
       tion.
@@ -1213,6 +1279,8 @@ gagr_fkcentroid
 
   aoop_outParamGAC.setFitness
     (lochromfixleng_best.getFitness());
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
  
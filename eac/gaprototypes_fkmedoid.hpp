@@ -34,6 +34,7 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -153,6 +154,12 @@ gaprototypes_fkmedoid
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamGAPrototypes.getNumMaxGenerations(),
+     aiinp_inParamGAPrototypes
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -347,10 +354,11 @@ gaprototypes_fkmedoid
   } /*END 1. INITIALIZE POPULATION*/
 
 
-  while ( (llfh_listFuntionHist.getDomainUpperBound() < 
-	   aiinp_inParamGAPrototypes.getNumMaxGenerations()) &&
-	  (runtime::elapsedTime(let_executionTime) <
-	   aiinp_inParamGAPrototypes.getMaxExecutiontime() ) ) {
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound(),
+	   runtime::elapsedTime(let_executionTime),
+	   lochrombitarray_best.getFitness()
+	   ) ) {
    
     llfh_listFuntionHist.increaseDomainUpperBound();
 
@@ -755,6 +763,8 @@ gaprototypes_fkmedoid
     (lochrombitarray_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
   
@@ -31,6 +31,29 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+#include "runtime_profile.hpp"
+#include "ga_island.hpp"
+
+/*THE FITNESS CAN BE ESTIMATED ON A MINI-BATCH OF THE INSTANCES,
+  see minibatch.hpp
+ */
+#define __INPARAM_MINIBATCH__
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -94,15 +117,21 @@ gas_fkcentroid
   /*VARIABLE NEED FOR POPULATION AND MATINGPOOL GENETIC
    
    *POPULATION CREATE------------------------------------------------------------
+    THE STRINGS OF THE POPULATION AND THE OFFSPRING ARE IN ONE ARENA
    */
-  std::vector<gaencode::ChromFixedLength<T_FEATURE,T_REAL> >
-    lvectorchromfixleng_population
-    (aiinp_inParamPcPmFk.getSizePopulation());
+  gaencode::PopulationArena<T_FEATURE,T_REAL>
+    lpopulationarena_chrom(aiinp_inParamPcPmFk.getSizePopulation());
+  
+  std::vector<gaencode::ChromFixedLength<T_FEATURE,T_REAL> >&
+    lvectorchromfixleng_population = lpopulationarena_chrom.getPopulation();
 
-  /*CREATE SPACE FOR STORE MATINGPOOL--------------------------------------------
+  std::vector<gaencode::ChromFixedLength<T_FEATURE,T_REAL> >&
+    lvectorchromfixleng_offspring = lpopulationarena_chrom.getOffspring();
+
+  /*CREATE SPACE FOR STORE MATINGPOOL, THE INDEXES OF THE PARENTS---------------
    */
-  std::vector<gaencode::ChromFixedLength<T_FEATURE,T_REAL> >
-    lvectorchromfixleng_matingPool
+  std::vector<uintidx>
+    lvectorui_idxMatingPool
     (aiinp_inParamPcPmFk.getSizePopulation());
 
   std::uniform_real_distribution<T_REAL> uniformdis_real01(0, 1);
@@ -150,6 +179,15 @@ gas_fkcentroid
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPcPmFk.getNumMaxGenerations(),
+     aiinp_inParamPcPmFk
+     );
+
+  /*TIME, CALLS AND DISTANCES OF EACH PHASE, ENABLED WITH THE PLOT-STAT FILE*/
+  runtime::ProfilePhases lprofile_phases;
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
   std::ofstream               lfileout_plotStatObjetiveFunc;
@@ -196,6 +234,11 @@ gas_fkcentroid
 
     lfileout_plotStatObjetiveFunc.precision(COMMON_COUT_PRECISION);
 
+    lprofile_phases.open
+      (aoop_outParamGAC.getFileNameOutPlotStatObjetiveFunc(),
+       llfh_listFuntionHist.getPlotStatSeparator()
+       );
+
     //FUNCTION HEADER
     lfileout_plotStatObjetiveFunc 
       <<  llfh_listFuntionHist.getHeaderFuntions() 
@@ -221,6 +264,7 @@ gas_fkcentroid
     population. \cite{Maulik:Bandyopadhyay:GAclustering:GAS:2000}
   */
   {/*BEGIN INITIALIZE POPULATION P(t)*/     
+    runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_INITIALIZE);
 #ifdef __VERBOSE_YES
     geverbosepc_labelstep = "(0) POPULATION INITIAL";
     ++geiinparam_verbose;
@@ -231,6 +275,26 @@ gas_fkcentroid
     }
 #endif /*__VERBOSE_YES*/
 
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamPcPmFk.getOpInitialization(),
+       uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)),
+       aiinp_inParamPcPmFk.getOversamplingInitialization() * lconstui_numClusterFk,
+       aiinp_inParamPcPmFk.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamPcPmFk.getFileNameWarmStart(),
+       aiinp_inParamPcPmFk.getFractionWarmStart(),
+       aiinp_inParamPcPmFk.getPerturbationWarmStart(),
+       aiinp_inParamPcPmFk.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for ( auto& lchromfixleng_iter: lvectorchromfixleng_population ) {
       
       /*DECODE CHROMOSOME
@@ -241,12 +305,25 @@ gas_fkcentroid
 	 data::Instance<T_FEATURE>::getNumDimensions(),
 	 lchromfixleng_iter.getString()
 	 );
- 	 
-      clusteringop::randomInitialize
-	(lmatrixrowt_centroidsChrom,
-	 aiiterator_instfirst,
-	 aiiterator_instlast
-	 );
+
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else if ( lseeds_initial.isRandom() ) 
+	clusteringop::randomInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else
+	clusteringop::seedsInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   lseeds_initial.select(lconstui_numClusterFk,lcostseeds_instances)
+	   );
 
       lchromfixleng_iter.setFitness(-std::numeric_limits<T_REAL>::max());
       lchromfixleng_iter.setObjetiveFunc(std::numeric_limits<T_REAL>::max());
@@ -265,11 +342,23 @@ gas_fkcentroid
 
   } /*END INITIALIZE POPULATION P(t)*/
 
+  /*MINI-BATCH: WITH --minibatch-size THE CLUSTERS AND THE FITNESS
+    ARE COMPUTED ON A SAMPLE OF THE INSTANCES THAT CHANGES EACH
+    GENERATION
+   */
+  minibatch::StratifiedSample<INPUT_ITERATOR>
+    lminibatch_sample
+    (aiiterator_instfirst,
+     aiiterator_instlast,
+     aiinp_inParamPcPmFk.getSizeMiniBatch(),
+     aiinp_inParamPcPmFk.getGrowthMiniBatch()
+     );
   
   while ( 1 ) {
 
     /*BEGIN ITERATION*/
     llfh_listFuntionHist.increaseDomainUpperBound();
+    lminibatch_sample.next();
 
     /*CLUSTERING----------------------------------------------------------
       The fitness computation process consists of two
@@ -281,6 +370,7 @@ gas_fkcentroid
       \cite{Maulik:Bandyopadhyay:GAclustering:GAS:2000}
     */
     {/*BEGIN CLUSTERING*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_CLUSTERING);
  
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "A. THE CLUSTERS ARE FORMED";
@@ -317,13 +407,12 @@ gas_fkcentroid
 	    
 	T_CLUSTERIDX lmcidx_numClusterNull;
 	    
-	clusteringop::updateCentroids
+	minibatch::updateCentroids
 	  (lmcidx_numClusterNull,
 	   lmatrixrowt_centroidsChrom,
 	   llmatrixrowt_sumInstancesCluster,
 	   lvectort_numInstancesInClusterK,
-	   aiiterator_instfirst,
-	   aiiterator_instlast,
+	   lminibatch_sample,
 	   aifunc2p_dist
 	   );
       }
@@ -351,6 +440,7 @@ gas_fkcentroid
       \cite{Maulik:Bandyopadhyay:GAclustering:GAS:2000}
     */
     { /*BEGIN COMPUTED METRIC M AND FITNESS*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_FITNESS);
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "B. COMPUTED METRIC M AND FITNESS";
       ++geiinparam_verbose;
@@ -375,10 +465,9 @@ gas_fkcentroid
 	   );
 
 	std::pair<T_REAL,bool> lpair_SSE =
-	  um::SSE 
+	  minibatch::SSE 
 	  (lmatrixrowt_centroidsChrom,
-	   aiiterator_instfirst,
-	   aiiterator_instlast,
+	   lminibatch_sample,
 	   aifunc2p_dist
 	   );
 	   
@@ -422,6 +511,27 @@ gas_fkcentroid
       \cite{Maulik:Bandyopadhyay:GAclustering:GAS:2000}
     */
     { /*BEGIN PRESERVING THE BEST STRING*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_ELITISM);
+
+      /*THE BEST STRING IS EVALUATED ON THE SAME SAMPLE AS THE POPULATION
+       */
+      if ( lminibatch_sample.isActive() &&
+	   lochromfixleng_best.getFitness() != -std::numeric_limits<T_REAL>::max() ) {
+	mat::MatrixRow<T_FEATURE> 
+	  lmatrixrowt_centroidsBest
+	  (lconstui_numClusterFk,
+	   data::Instance<T_FEATURE>::getNumDimensions(),
+	   lochromfixleng_best.getString()
+	   );
+	std::pair<T_REAL,bool> lpair_SSE =
+	  minibatch::SSE 
+	  (lmatrixrowt_centroidsBest,
+	   lminibatch_sample,
+	   aifunc2p_dist
+	   );
+	lochromfixleng_best.setObjetiveFunc(lpair_SSE.first);
+	lochromfixleng_best.setFitness(1.0 / lpair_SSE.first);
+      }
       
       auto lchromfixleng_iterMax  =
 	std::max_element
@@ -483,6 +593,7 @@ gas_fkcentroid
 	 lvectorT_statfuncObjetiveFunc
 	 );
       lfileout_plotStatObjetiveFunc << llfh_listFuntionHist;
+      lprofile_phases.endGeneration(llfh_listFuntionHist.getDomainUpperBound());
       lvectorT_statfuncObjetiveFunc.clear();
     }
 #endif /*__WITHOUT_PLOT_STAT*/
@@ -506,11 +617,21 @@ gas_fkcentroid
     --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
    
-    if ( !(llfh_listFuntionHist.getDomainUpperBound() 
-	   < aiinp_inParamPcPmFk.getNumMaxGenerations() ) 
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(let_executionTime),
+	  lochromfixleng_best.getFitness()
+	  )
 	 )
       break;
 
+    /*MIGRATION BETWEEN THE ISLANDS
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchromfixleng_population
+       );
+
     /*SELECTION------------------------------------------------------------------
       The selection process selects chromosomes from the
       mating pool directed by the survival of the fittest concept
@@ -524,6 +645,7 @@ gas_fkcentroid
       \cite{Maulik:Bandyopadhyay:GAclustering:GAS:2000}
     */
     { /*BEGIN SELECTION*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_SELECTION);
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "SELECTION";
       ++geiinparam_verbose;
@@ -545,17 +667,15 @@ gas_fkcentroid
 	 }
 	 );
       
-      /*COPY POPULATION TO STRING POOL FOR ROULETTE WHEEL--------------------------
+      /*SELECT THE INDEXES OF THE STRING POOL FOR ROULETTE WHEEL------------------
        */ 
-      for ( auto& lchromfixleng_iter: lvectorchromfixleng_matingPool ) {
+      for ( auto& lui_idxChrom: lvectorui_idxMatingPool ) {
 	
-	uintidx lstidx_chrom = 
+	lui_idxChrom = 
 	  gaselect::getIdxRouletteWheel
 	  (lvectorT_probDistRouletteWheel,
 	   uintidx(0)
 	   );
-
-	lchromfixleng_iter = lvectorchromfixleng_population.at(lstidx_chrom);
       }
 
 #ifdef __VERBOSE_YES
@@ -584,6 +704,7 @@ gas_fkcentroid
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
     { /*BEGIN CROSSOVER*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_CROSSOVER);
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "CROSSOVER";
       ++geiinparam_verbose;
@@ -595,11 +716,11 @@ gas_fkcentroid
 #endif /*__VERBOSE_YES*/
 
       
-      gaiterator::crossover
-	(lvectorchromfixleng_matingPool.begin(),
-	 lvectorchromfixleng_matingPool.end(),
+      gaiterator::crossoverIdx
+	(lvectorui_idxMatingPool,
 	 lvectorchromfixleng_population.begin(),
-	 lvectorchromfixleng_population.end(),
+	 lvectorchromfixleng_offspring.begin(),
+	 lvectorchromfixleng_offspring.end(),
 	 [&](const gaencode::ChromFixedLength<T_FEATURE,T_REAL>&
 	     aichrom_parent1,
 	     const gaencode::ChromFixedLength<T_FEATURE,T_REAL>&
@@ -628,6 +749,10 @@ gas_fkcentroid
 	   }
 	 }
 	 );
+
+      /*THE OFFSPRING IS THE NEW POPULATION
+       */
+      lpopulationarena_chrom.swap();
 	 
 #ifdef __VERBOSE_YES
       if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -645,6 +770,7 @@ gas_fkcentroid
       /*MUTATION----------------------------------------------------------------
        */
     {/*BEGIN MUTATION*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_MUTATION);
 
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "MUTATION";
@@ -685,6 +811,30 @@ gas_fkcentroid
       
   } /*END EVOLUTION While*/ 
     
+  /*MINI-BATCH: THE BEST STRING IS EVALUATED ON ALL THE INSTANCES
+   */
+  if ( lminibatch_sample.isUsed() ) {
+    mat::MatrixRow<T_FEATURE> 
+      lmatrixrowt_centroidsBest
+      (lconstui_numClusterFk,
+       data::Instance<T_FEATURE>::getNumDimensions(),
+       lochromfixleng_best.getString()
+       );
+    std::pair<T_REAL,bool> lpair_SSE =
+      um::SSE 
+      (lmatrixrowt_centroidsBest,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       aifunc2p_dist
+       );
+    aoop_outParamGAC.setMiniBatch
+      (lochromfixleng_best.getObjetiveFunc(),lpair_SSE.first);
+    lochromfixleng_best.setObjetiveFunc(lpair_SSE.first);
+    lochromfixleng_best.setFitness(1.0 / lpair_SSE.first);
+    lochromfixleng_best.setValidString(lpair_SSE.second);
+  }
+    
+  lprofile_phases.close();
   runtime::stop(let_executionTime);
   aoop_outParamGAC.setNumClusterK
     (aiinp_inParamPcPmFk.getNumClusterK());
@@ -694,6 +844,8 @@ gas_fkcentroid
     (runtime::getTime(let_executionTime));
   aoop_outParamGAC.setFitness
     (lochromfixleng_best.getFitness());
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
  
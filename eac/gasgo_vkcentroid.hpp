@@ -31,6 +31,12 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_island.hpp"
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -241,6 +247,12 @@ gasgo_vkcentroid
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPcPmVk.getNumMaxGenerations(),
+     aiinp_inParamPcPmVk
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -775,8 +787,11 @@ gasgo_vkcentroid
       --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
     
-      if ( !(llfh_listFuntionHist.getDomainUpperBound() 
-	     < aiinp_inParamPcPmVk.getNumMaxGenerations() ) 
+      if ( lterminationcriteria.isAttained
+	   (llfh_listFuntionHist.getDomainUpperBound(),
+	    runtime::elapsedTime(let_executionTime),
+	    lochrom_best.getObjetiveFunc()
+	    )
 	   )
 	break;
       
@@ -784,6 +799,14 @@ gasgo_vkcentroid
     } /*END TERMINATION CRITERION
        */
 
+    /*MIGRATION BETWEEN THE ISLANDS, THE CHROMOSOMES ARE RANKED BY THE OBJECTIVE FUNCTION
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchrom_population,
+       gaisland::ObjetiveFuncChromosome()
+       );
+
     
     /*GENETIC OPERATIONS
      */
@@ -1964,7 +1987,7 @@ gasgo_vkcentroid
 	      
 	      {  //BEGIN MUTATION K-1 ---------------------------------------------
 		
-		static std::uniform_int_distribution<uintidx>
+		std::uniform_int_distribution<uintidx>
 		  luniformdis_uiidxInstances0n
 		  (0, (uintidx) std::distance(aiiterator_instfirst,aiiterator_instlast) -1);
 		uintidx  lui_idxInsRand =
@@ -2546,6 +2569,8 @@ gasgo_vkcentroid
     (lochrom_best.getObjetiveFunc());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
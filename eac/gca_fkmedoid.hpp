@@ -34,6 +34,18 @@
 #include "outparam_gamedoid.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -126,6 +138,12 @@ gca_fkmedoid
   runtime::ListRuntimeFunction<COMMON_IDOMAIN> 
     llfh_listFuntionHist
     (aiinp_inParamGCA.getNumMaxGenerations(), "Iterations", "Clustering metrics");
+
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamGCA.getNumMaxGenerations(),
+     aiinp_inParamGCA
+     );
  
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
@@ -214,6 +232,22 @@ gca_fkmedoid
 	(new gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>());
     }
 
+  /*EACH STRING CARRIES THE TWO NEAREST MEDOIDS OF THE INSTANCES. A STRING
+    STARTS FROM THOSE OF THE PARENT WITH FEWER DIFFERENT MEDOIDS, SO A
+    MUTATION ONLY EVALUATES THE MEDOID THAT CHANGED
+  */
+  std::vector<nearest::MedoidsTwoNN<T_CLUSTERIDX,T_REAL> >
+    lvectormedoidstwonn_population
+    (lvectorchromfixleng_population.size(),
+     nearest::MedoidsTwoNN<T_CLUSTERIDX,T_REAL>(aimatrixtriagrt_dissimilarity)
+     );
+  std::vector<nearest::MedoidsTwoNN<T_CLUSTERIDX,T_REAL> >
+    lvectormedoidstwonn_parents(lvectormedoidstwonn_population);
+  std::vector<std::pair<uintidx,uintidx> >
+    lvectorpair_idxParents(lvectorchromfixleng_population.size());
+  std::vector<uintidx>
+    lvectorui_idxStringPool(lvectorchromfixleng_stringPool.size());
+
   /*-1. Initiate strings. The initial population is
     created. Each string in the population uniquely
     encodes a candidate solution.
@@ -233,23 +267,64 @@ gca_fkmedoid
 
     const uintidx  luintidx_numClusterK =
       (uintidx) aiinp_inParamGCA.getNumClusterK();
+
+    /*COST OF AN INSTANCE TO A SEED, THE SQUARED DISSIMILARITY
+     */
+    auto lfunc_costSeeds =
+      [&](const uintidx aiui_i, const uintidx aiui_j) -> T_REAL
+      {
+	const T_REAL lrt_dissimilarity = aimatrixtriagrt_dissimilarity(aiui_i,aiui_j);
+	return lrt_dissimilarity * lrt_dissimilarity;
+      };
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamGCA.getOpInitialization(),
+       aimatrixtriagrt_dissimilarity.getNumRows(),
+       aiinp_inParamGCA.getOversamplingInitialization() * luintidx_numClusterK,
+       aiinp_inParamGCA.getRoundsInitialization(),
+       lfunc_costSeeds
+       );
+    gawarmstart::WarmStartMedoids<T_REAL>
+      lwarmstart_population
+      (aiinp_inParamGCA.getFileNameWarmStart(),
+       aiinp_inParamGCA.getFractionWarmStart(),
+       aiinp_inParamGCA.getPerturbationWarmStart(),
+       aiinp_inParamGCA.getSizePopulation(),
+       aimatrixtriagrt_dissimilarity
+       );
     
     for (auto lchromfixleng_iter :lvectorchromfixleng_population) {
-       
-      std::unordered_set<T_INSTANCEIDX> &&lunorderedset_medoids =
-	prob::getWithoutRepeatsSet
-	( luintidx_numClusterK,
-	  [&]() -> T_INSTANCEIDX
-	  {
-	    return uniformdis_idxInstances(gmt19937_eng);
-	  }
-	  );
 
-      std::copy_n
-	(lunorderedset_medoids.begin(),
-	 lunorderedset_medoids.size(),
-	 lchromfixleng_iter->getString()   
-	 );
+      if ( lwarmstart_population.hasNext() ) {
+	lwarmstart_population.initialize
+	  (lchromfixleng_iter->getString(),luintidx_numClusterK);
+      }
+      else if ( lseeds_initial.isRandom() ) {
+	std::unordered_set<T_INSTANCEIDX> &&lunorderedset_medoids =
+	  prob::getWithoutRepeatsSet
+	  ( luintidx_numClusterK,
+	    [&]() -> T_INSTANCEIDX
+	    {
+	      return uniformdis_idxInstances(gmt19937_eng);
+	    }
+	    );
+
+	std::copy_n
+	  (lunorderedset_medoids.begin(),
+	   lunorderedset_medoids.size(),
+	   lchromfixleng_iter->getString()   
+	   );
+      }
+      else {
+	std::vector<uintidx> &&lvectorui_medoids =
+	  lseeds_initial.select(luintidx_numClusterK,lfunc_costSeeds);
+
+	std::copy_n
+	  (lvectorui_medoids.begin(),
+	   lvectorui_medoids.size(),
+	   lchromfixleng_iter->getString()   
+	   );
+      }
 
       lchromfixleng_iter->setObjetiveFunc(std::numeric_limits<T_REAL>::max());
       lchromfixleng_iter->setFitness(-std::numeric_limits<T_REAL>::max());
@@ -287,16 +362,25 @@ gca_fkmedoid
       }
 #endif /*__VERBOSE_YES*/
 
-      std::for_each
-	(lvectorchromfixleng_population.begin(),
-	 lvectorchromfixleng_population.end(),
-	 [&](gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>* lchromfixleng_iter)
+      lvectormedoidstwonn_parents.swap(lvectormedoidstwonn_population);
+      
+      for ( uintidx lui_i = 0; lui_i < lvectorchromfixleng_population.size(); lui_i++)
 	 {
+	   gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>* lchromfixleng_iter =
+	     lvectorchromfixleng_population[lui_i];
+	   const nearest::MedoidsTwoNN<T_CLUSTERIDX,T_REAL> &lmedoidstwonn_parent1 =
+	     lvectormedoidstwonn_parents[lvectorpair_idxParents[lui_i].first];
+	   const nearest::MedoidsTwoNN<T_CLUSTERIDX,T_REAL> &lmedoidstwonn_parent2 =
+	     lvectormedoidstwonn_parents[lvectorpair_idxParents[lui_i].second];
 	   T_REAL lT_objetiveFunc = 
-	     um::SSEMedoid
-	     (lchromfixleng_iter->getString(),
-	      aiinp_inParamGCA.getNumClusterK(),
-	      aimatrixtriagrt_dissimilarity
+	     lvectormedoidstwonn_population[lui_i].setMedoids
+	     (( lmedoidstwonn_parent2.getNumChanges
+		(lchromfixleng_iter->getString(),aiinp_inParamGCA.getNumClusterK())
+		< lmedoidstwonn_parent1.getNumChanges
+		(lchromfixleng_iter->getString(),aiinp_inParamGCA.getNumClusterK()) )?
+	      lmedoidstwonn_parent2:lmedoidstwonn_parent1,
+	      lchromfixleng_iter->getString(),
+	      aiinp_inParamGCA.getNumClusterK()
 	      );
 	   lchromfixleng_iter->setObjetiveFunc(lT_objetiveFunc);
 	   lchromfixleng_iter->setFitness(1.0 / lchromfixleng_iter->getObjetiveFunc());
@@ -307,7 +391,6 @@ gca_fkmedoid
 #endif /*__WITHOUT_PLOT_STAT*/
 	
 	 }
-	 );
 
 #ifdef __VERBOSE_YES
       if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -399,8 +482,11 @@ gca_fkmedoid
     /*GCA the termination criterion is based on a predetermined 
       maximum genetation
     */
-    if ( llfh_listFuntionHist.getDomainUpperBound() >=
-	 aiinp_inParamGCA.getNumMaxGenerations()) 
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(let_executionTime),
+	  lochromfixleng_best.getFitness()
+	  ) )
       break;
    
     llfh_listFuntionHist.increaseDomainUpperBound();
@@ -436,7 +522,7 @@ gca_fkmedoid
       
       /*COPY POPULATION TO STRING POOL FOR ROULETTE WHEEL--------------------------
        */
-      for ( auto lchromfixleng_iter: lvectorchromfixleng_stringPool) {
+      for ( uintidx lui_i = 0; lui_i < lvectorchromfixleng_stringPool.size(); lui_i++) {
 
 	uintidx luiidx_chrom = 
 	  gaselect::getIdxRouletteWheel
@@ -444,7 +530,8 @@ gca_fkmedoid
 	   uintidx(0)
 	   );
 	
-	*lchromfixleng_iter = *lvectorchromfixleng_population.at(luiidx_chrom);
+	*lvectorchromfixleng_stringPool[lui_i] = *lvectorchromfixleng_population.at(luiidx_chrom);
+	lvectorui_idxStringPool[lui_i] = luiidx_chrom;
       }
       
 #ifdef __VERBOSE_YES
@@ -495,6 +582,13 @@ gca_fkmedoid
 	     );
 	  
 	  gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>* lchromfixleng_child1 = *lchromfixleng_iter;
+	  const uintidx lui_idxChild1 = 
+	    (uintidx) std::distance(lvectorchromfixleng_population.begin(),lchromfixleng_iter);
+	  lvectorpair_idxParents[lui_idxChild1] =
+	    std::make_pair
+	    (lvectorui_idxStringPool[lpair_idxChrom.first],
+	     lvectorui_idxStringPool[lpair_idxChrom.second]
+	     );
 	  
 	  if ( ++lchromfixleng_iter == lvectorchromfixleng_population.end()) {
 	    *lchromfixleng_child1 = *lvectorchromfixleng_stringPool.at(lpair_idxChrom.first); 
@@ -502,6 +596,7 @@ gca_fkmedoid
 	  }
 
 	  gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>* lchromfixleng_child2 = *lchromfixleng_iter;
+	  lvectorpair_idxParents[lui_idxChild1+1] = lvectorpair_idxParents[lui_idxChild1];
 	  
 	  if ( uniformdis_real01(gmt19937_eng) //if  Crossover
 	       < aiinp_inParamGCA.getProbCrossover() ) {
@@ -683,6 +778,8 @@ gca_fkmedoid
     (runtime::getTime(let_executionTime));
   aoop_outParamGAC.setFitness
     (lochromfixleng_best.getFitness());
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -33,6 +33,29 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+#include "runtime_profile.hpp"
+#include "ga_island.hpp"
+
+/*THE FITNESS CAN BE ESTIMATED ON A MINI-BATCH OF THE INSTANCES,
+  see minibatch.hpp
+ */
+#define __INPARAM_MINIBATCH__
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -146,6 +169,15 @@ gcuk_vkcentroid
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPcPmVk.getNumMaxGenerations(),
+     aiinp_inParamPcPmVk
+     );
+
+  /*TIME, CALLS AND DISTANCES OF EACH PHASE, ENABLED WITH THE PLOT-STAT FILE*/
+  runtime::ProfilePhases lprofile_phases;
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -192,6 +224,11 @@ gcuk_vkcentroid
 
     lfileout_plotStatObjetiveFunc.precision(COMMON_COUT_PRECISION);
 
+    lprofile_phases.open
+      (aoop_outParamGAC.getFileNameOutPlotStatObjetiveFunc(),
+       llfh_listFuntionHist.getPlotStatSeparator()
+       );
+
     //FUNCTION HEADER
 
     lfileout_plotStatObjetiveFunc 
@@ -260,6 +297,7 @@ gcuk_vkcentroid
     in the range [Kmin;Kmax] is generated.
   */    
   { /*BEGIN POPULATION INITIALIZATION*/
+    runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_INITIALIZE);
       
 #ifdef __VERBOSE_YES
     const char *geverbosepc_labelstep = "POPULATION INITIALIZATION:";
@@ -272,15 +310,48 @@ gcuk_vkcentroid
 #endif /*__VERBOSE_YES*/
    
     
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamPcPmVk.getOpInitialization(),
+       uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)),
+       aiinp_inParamPcPmVk.getOversamplingInitialization() * aiinp_inParamPcPmVk.getNumClusterKMaximum(),
+       aiinp_inParamPcPmVk.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamPcPmVk.getFileNameWarmStart(),
+       aiinp_inParamPcPmVk.getFractionWarmStart(),
+       aiinp_inParamPcPmVk.getPerturbationWarmStart(),
+       aiinp_inParamPcPmVk.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for ( auto &&liter_iChrom: lvectorchrom_population ) {
       
       /*Chose Ki point randomly from the data
        */
-      clusteringop::randomInitialize
-	(liter_iChrom,
-	 aiiterator_instfirst,
-	 aiiterator_instlast
-	 );
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (liter_iChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else if ( lseeds_initial.isRandom() ) 
+	clusteringop::randomInitialize
+	  (liter_iChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else
+	clusteringop::seedsInitialize
+	  (liter_iChrom,
+	   aiiterator_instfirst,
+	   lseeds_initial.select(liter_iChrom.getNumRows(),lcostseeds_instances)
+	   );
       
       std::shuffle
 	(liter_iChrom.toArray(),
@@ -313,15 +384,29 @@ gcuk_vkcentroid
     
   } /*END POPULATION INITIALIZATION*/
 
+  /*MINI-BATCH: WITH --minibatch-size THE CLUSTERS AND THE FITNESS
+    ARE COMPUTED ON A SAMPLE OF THE INSTANCES THAT CHANGES EACH
+    GENERATION
+   */
+  minibatch::StratifiedSample<INPUT_ITERATOR>
+    lminibatch_sample
+    (aiiterator_instfirst,
+     aiiterator_instlast,
+     aiinp_inParamPcPmVk.getSizeMiniBatch(),
+     aiinp_inParamPcPmVk.getGrowthMiniBatch()
+     );
 
   while ( 1 ) {
 
+    lminibatch_sample.next();
+
     /*2.1.3. Fitness computation
       The fitness of a chromosome is computed using the
       Davies–Bouldin index. 
     */
 
     {/*BEGIN FITNESS COMPUTATION*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_FITNESS);
       
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "FITNESS COMPUTATION";
@@ -357,34 +442,22 @@ gcuk_vkcentroid
 	       );
 	  
 	    T_CLUSTERIDX lmcidx_numClusterNull; 
-	    clusteringop::updateCentroids
+	    minibatch::updateCentroids
 	      (lmcidx_numClusterNull,
 	       lmatrixrow_centroidsChrom,
 	       llmatrixrowt_sumInstancesCluster,
 	       lvectort_numInstancesInClusterK,
-	       aiiterator_instfirst,
-	       aiiterator_instlast,
+	       lminibatch_sample,
 	       aifunc2p_dist
 	       );
 	    liter_iChrom.setMatrix(lmatrixrow_centroidsChrom);
 	     
 	    if (lmcidx_numClusterNull == 0 ) {
-		 
-	      auto  lpartitionCentroids_clusters = 
-		partition::makePartition
-		(lmatrixrow_centroidsChrom,
-		 aiiterator_instfirst,
-		 aiiterator_instlast,
-		 T_CLUSTERIDX(lmatrixrow_centroidsChrom.getNumRows()),
-		 aifunc2p_dist
-		 );
 	    
 	      T_REAL lrt_dbindex = 
-		um::dbindex
+		minibatch::dbindex<T_CLUSTERIDX>
 		(lmatrixrow_centroidsChrom,
-		 aiiterator_instfirst,
-		 aiiterator_instlast,
-		 lpartitionCentroids_clusters,
+		 lminibatch_sample,
 		 aifunc2p_dist
 		 );
 
@@ -421,6 +494,23 @@ gcuk_vkcentroid
 	    aoop_outParamGAC.incTotalInvalidOffspring();
 	    liter_iChrom.setValidString(false); 
 	  }
+	  else if ( lminibatch_sample.isActive() &&
+		    liter_iChrom.getValidString() ) {
+	    /*THE FITNESS OF THE PREVIOUS SAMPLE IS NOT COMPARABLE,
+	      THE STRING IS EVALUATED AGAIN WITHOUT CHANGING ITS CENTROIDS
+	    */
+	    mat::MatrixRow<T_FEATURE>&& 
+	      lmatrixrow_centroidsChrom = 
+	      liter_iChrom.getMatrix();
+	    T_REAL lrt_dbindex = 
+	      minibatch::dbindex<T_CLUSTERIDX>
+	      (lmatrixrow_centroidsChrom,
+	       lminibatch_sample,
+	       aifunc2p_dist
+	       );
+	    liter_iChrom.setObjetiveFunc(lrt_dbindex); 
+	    liter_iChrom.setFitness(1.0 / lrt_dbindex);
+	  }
 	}
       }
    
@@ -438,6 +528,7 @@ gcuk_vkcentroid
    
     { /*BEGIN PRESERVING THE BEST STRING
        */
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_ELITISM);
 #ifdef __VERBOSE_YES
       const char *geverbosepc_labelstep = "ELITISM PRESERVING THE BEST";
       ++geiinparam_verbose;
@@ -448,6 +539,24 @@ gcuk_vkcentroid
       }
 #endif /*__VERBOSE_YES*/
 
+      /*THE BEST STRING IS EVALUATED ON THE SAME SAMPLE AS THE POPULATION
+       */
+      if ( lminibatch_sample.isActive() &&
+	   lochrom_best.getFitness() != -std::numeric_limits<T_REAL>::max() &&
+	   lochrom_best.getNumRows() > 1 ) {
+	mat::MatrixRow<T_FEATURE>&& 
+	  lmatrixrow_centroidsBest = 
+	  lochrom_best.getMatrix();
+	T_REAL lrt_dbindex = 
+	  minibatch::dbindex<T_CLUSTERIDX>
+	  (lmatrixrow_centroidsBest,
+	   lminibatch_sample,
+	   aifunc2p_dist
+	   );
+	lochrom_best.setObjetiveFunc(lrt_dbindex); 
+	lochrom_best.setFitness(1.0 / lrt_dbindex);
+      }
+
       auto lit_chromMax = std::max_element
 	(lvectorchrom_population.begin(), 
 	 lvectorchrom_population.end(), 
@@ -522,10 +631,18 @@ gcuk_vkcentroid
 	 lvectort_statfuncObjetiveFunc
 	 );
       lfileout_plotStatObjetiveFunc << llfh_listFuntionHist;
+      lprofile_phases.endGeneration(llfh_listFuntionHist.getDomainUpperBound());
       lvectort_statfuncObjetiveFunc.clear();
     }
 #endif /*__WITHOUT_PLOT_STAT*/
 
+    /*MIGRATION BETWEEN THE ISLANDS
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchrom_population
+       );
+
     /*2.1.4 GENETIC OPERATIONS
      */
 
@@ -535,6 +652,7 @@ gcuk_vkcentroid
 	applied on the population of strings.
       */
       { /*BEGIN SELECTION*/
+	runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_SELECTION);
 
 #ifdef __VERBOSE_YES
 	geverbosepc_labelstep = "SELECTION";
@@ -599,6 +717,7 @@ gcuk_vkcentroid
 	applied stochastically with probability c,
       */
       { /*BEGIN CROSSOVER*/
+	runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_CROSSOVER);
 
 #ifdef __VERBOSE_YES
 	geverbosepc_labelstep = "CROSSOVER";
@@ -651,6 +770,7 @@ gcuk_vkcentroid
 	in a chromosome is mutated with probability $\mu_m$.
       */
       { /*BEGIN MUTATION*/
+	runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_MUTATION);
 
 #ifdef __VERBOSE_YES
 	geverbosepc_labelstep = "MUTATION";
@@ -711,8 +831,11 @@ gcuk_vkcentroid
       --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
     
-      if ( !(llfh_listFuntionHist.getDomainUpperBound() 
-	     < aiinp_inParamPcPmVk.getNumMaxGenerations() ) 
+      if ( lterminationcriteria.isAttained
+	   (llfh_listFuntionHist.getDomainUpperBound(),
+	    runtime::elapsedTime(let_executionTime),
+	    lochrom_best.getFitness()
+	    )
 	   )
 	break;
       llfh_listFuntionHist.increaseDomainUpperBound();
@@ -724,7 +847,33 @@ gcuk_vkcentroid
   mat::MatrixRow<T_FEATURE>&& 
     lomatrixrow_centroidsChromBest = 
     lochrom_best.getMatrix();
+
+  /*MINI-BATCH: THE BEST STRING IS EVALUATED ON ALL THE INSTANCES
+   */
+  if ( lminibatch_sample.isUsed() && lochrom_best.getNumRows() > 1 ) {
+    auto  lpartitionCentroids_clusters = 
+      partition::makePartition
+      (lomatrixrow_centroidsChromBest,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       T_CLUSTERIDX(lomatrixrow_centroidsChromBest.getNumRows()),
+       aifunc2p_dist
+       );
+    T_REAL lrt_dbindex = 
+      um::dbindex
+      (lomatrixrow_centroidsChromBest,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       lpartitionCentroids_clusters,
+       aifunc2p_dist
+       );
+    aoop_outParamGAC.setMiniBatch
+      (lochrom_best.getObjetiveFunc(),lrt_dbindex);
+    lochrom_best.setObjetiveFunc(lrt_dbindex); 
+    lochrom_best.setFitness(1.0 / lrt_dbindex);
+  }
   
+  lprofile_phases.close();
   runtime::stop(let_executionTime);
   aoop_outParamGAC.setNumClusterK
     ((T_CLUSTERIDX)lochrom_best.getNumRows());
@@ -734,6 +883,8 @@ gcuk_vkcentroid
     (lochrom_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -38,6 +38,7 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -151,6 +152,12 @@ gga_vklabel
     llfh_listFuntionHist
     (aiinp_inParamGGA.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamGGA.getNumMaxGenerations(),
+     aiinp_inParamGGA
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -790,11 +797,11 @@ gga_vklabel
 #endif /*__VERBOSE_YES*/
 
     
-      if ( (llfh_listFuntionHist.getDomainUpperBound() >=
-	    aiinp_inParamGGA.getNumMaxGenerations() ) ||
-	   (runtime::elapsedTime(let_executionTime) >
-	    aiinp_inParamGGA.getMaxExecutiontime())
-	   )
+      if ( lterminationcriteria.isAttained
+	   (llfh_listFuntionHist.getDomainUpperBound(),
+	    runtime::elapsedTime(let_executionTime),
+	    lochrom_best.getFitness()
+	    ) )
 	break;
       llfh_listFuntionHist.increaseDomainUpperBound();
     } /*END 3.1.5 TERMINATION CRITERION*/
@@ -974,36 +981,22 @@ gga_vklabel
 	      
 #ifdef ALG_GGA_VKLABEL_SILHOUETTE_AGUSTIN_ETAL_2012
  
-	    partition::PartitionLabel
-	      <T_CLUSTERIDX>
-	      lpartition_clusters
-	      (liter_iChrom->getString(),
-	       gaencode::ChromosomeGGA<T_CLUSTERIDX,T_REAL>::getElementSize(),
+	    /*THE SUMS OF THE DISTANCES OF EACH INSTANCE TO EACH CLUSTER ARE
+	      UPDATED WHEN AN INSTANCE CHANGES OF CLUSTER, SO EACH INSTANCE
+	      TRIES ALL THE CLUSTERS IN O(K)
+	     */
+	    um::SilhouetteDistSums<T_REAL,T_CLUSTERIDX,T_INSTANCES_CLUSTER_K>
+	      lsilhouettedistsums_memberShip
+	      (lmatrixtriagT_dissimilarity,
+	       liter_iChrom->getString(),
 	       liter_iChrom->getNumClusterK()
 	       );
 
-	    ds::PartitionLinkedNumInst<T_CLUSTERIDX,T_INSTANCES_CLUSTER_K>
-	      &&lpartlinknuminst_memberShip =
-	      ds::getPartitionLinkedNumInst
-	      (aiiterator_instfirst,
-	       aiiterator_instlast,
-	       lpartition_clusters,
-	       [&](data::Instance<T_FEATURE>* liter_inst)
-	       {
-		 return T_INSTANCES_CLUSTER_K(1);
-	       }
-	       );
-
 #ifdef __VERBOSE_YES
 	    T_REAL lrt_origSilhouette;
 	    ++geiinparam_verbose;
 	    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-	      lrt_origSilhouette =
-		(um::silhouette
-		 (lmatrixtriagT_dissimilarity,
-		  lpartlinknuminst_memberShip
-		  )
-		 );	      
+	      lrt_origSilhouette = lsilhouettedistsums_memberShip.silhouette();
 	    }
 	    --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
@@ -1014,47 +1007,23 @@ gga_vklabel
 		 lui_i <  gaencode::ChromosomeGGA<T_CLUSTERIDX,T_REAL>::getElementSize();
 		 lui_i++)
 	      {
-		T_CLUSTERIDX lmmidx_geneMaxObj  = -1;
-		T_REAL lrt_geneSilhouetteMax =
-		  measuare_lowerValueSilhouette(T_REAL);
-		lpartlinknuminst_memberShip.subInstanceFromCluster
+		lsilhouettedistsums_memberShip.subInstanceFromCluster
 		  (*larraymmidx_iChrom,lui_i);
 		
-		for ( T_CLUSTERIDX lmmidx_iterK = 0;
-		      lmmidx_iterK < liter_iChrom->getNumClusterK();
-		      ++lmmidx_iterK ) 
-		  {
-
-		    T_REAL lrt_geneSilhouette  = 
-		      um::silhouette
-		      (lui_i,
-		       lmmidx_iterK,
-		       lmatrixtriagT_dissimilarity,
-		       lpartlinknuminst_memberShip,
-		       lpartlinknuminst_memberShip.getVectorNumInstClusterK()
-		       );
-
-		    if ( lrt_geneSilhouette > lrt_geneSilhouetteMax ) {
-		      lmmidx_geneMaxObj = lmmidx_iterK;
-		      lrt_geneSilhouetteMax = lrt_geneSilhouette;
-		    }
-		  } /*FOR K*/
+		T_CLUSTERIDX lmmidx_geneMaxObj =
+		  lsilhouettedistsums_memberShip.getClusterMaxSilhouette(lui_i);
 		
 		*larraymmidx_iChrom = lmmidx_geneMaxObj;
-		lpartlinknuminst_memberShip.addInstanceToCluster
+		lsilhouettedistsums_memberShip.addInstanceToCluster
 		  (lmmidx_geneMaxObj,lui_i);
 		++larraymmidx_iChrom;
 	      }
 
 	    T_REAL lrt_searchLocalSilhouette =
-	      (um::silhouette
-	       (lmatrixtriagT_dissimilarity,
-		lpartlinknuminst_memberShip
-		)
-	       );
+	      lsilhouettedistsums_memberShip.silhouette();
 	    for ( T_CLUSTERIDX lmmc_k = (liter_iChrom->getNumClusterK()-1) ;
 		  lmmc_k >= 0; --lmmc_k) {
-	      if ( lpartlinknuminst_memberShip.getVectorNumInstClusterK().at(lmmc_k)
+	      if ( lsilhouettedistsums_memberShip.getVectorNumInstClusterK().at(lmmc_k)
 		   ==  0 )		
 		liter_iChrom->deleteGroupNull(lmmc_k);
 	    }
@@ -1111,8 +1080,8 @@ gga_vklabel
 	      liter_iChrom->print();
 	      std::cout << std::endl;
 	      inout::containerprint
-		(lpartlinknuminst_memberShip.getVectorNumInstClusterK().begin(),
-		 lpartlinknuminst_memberShip.getVectorNumInstClusterK().end(),
+		(lsilhouettedistsums_memberShip.getVectorNumInstClusterK().begin(),
+		 lsilhouettedistsums_memberShip.getVectorNumInstClusterK().end(),
 		 std::cout,
 		 geverbosepc_labelstep,
 		 ','
@@ -1629,6 +1598,8 @@ gga_vklabel
     (lochrom_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
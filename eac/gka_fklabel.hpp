@@ -34,6 +34,13 @@
 #include "ga_integer_operator.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -107,6 +114,12 @@ gka_fklabel
   runtime::ListRuntimeFunction<COMMON_IDOMAIN> 
     llfh_listFuntionHist
     (aiinp_inParamPmFk.getNumMaxGenerations(), "Iterations", "Clustering metrics");
+
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPmFk.getNumMaxGenerations(),
+     aiinp_inParamPmFk
+     );
   
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
@@ -200,16 +213,35 @@ gka_fklabel
     std::uniform_int_distribution<T_CLUSTERIDX> uniformdis_mmcidx0K
       (0,aiinp_inParamPmFk.getNumClusterK()-1);
    
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamPmFk.getFileNameWarmStart(),
+       aiinp_inParamPmFk.getFractionWarmStart(),
+       aiinp_inParamPmFk.getPerturbationWarmStart(),
+       aiinp_inParamPmFk.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for (auto &lchromfixleng_iter :lvectorchromfixleng_population) {
-      
-      gagenericop::initializeGenes
-	(lchromfixleng_iter.begin(),
-	 lchromfixleng_iter.end(),
-	 [&]() 
-	 {
-	   return uniformdis_mmcidx0K(gmt19937_eng);
-	 }
-	 );
+
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (lchromfixleng_iter.getString(),
+	   (T_CLUSTERIDX) aiinp_inParamPmFk.getNumClusterK(),
+	   aiiterator_instfirst,
+	   aiiterator_instlast,
+	   aifunc2p_dist
+	   );
+      else
+	gagenericop::initializeGenes
+	  (lchromfixleng_iter.begin(),
+	   lchromfixleng_iter.end(),
+	   [&]() 
+	   {
+	     return uniformdis_mmcidx0K(gmt19937_eng);
+	   }
+	   );
       
       lchromfixleng_iter.setObjetiveFunc(std::numeric_limits<T_REAL>::max());
       lchromfixleng_iter.setFitness(-std::numeric_limits<T_REAL>::max());
@@ -374,8 +406,11 @@ gka_fklabel
   
 #endif  /*__WITHOUT_PLOT_STAT */
 
-  while ( llfh_listFuntionHist.getDomainUpperBound() < 
-	  aiinp_inParamPmFk.getNumMaxGenerations()) {
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound(),
+	   runtime::elapsedTime(let_executionTime),
+	   lochromfixleng_best.getFitness()
+	   ) ) {
     
     llfh_listFuntionHist.increaseDomainUpperBound();
 
@@ -820,6 +855,8 @@ gka_fklabel
     (lochromfixleng_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
   
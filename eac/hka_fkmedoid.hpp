@@ -33,6 +33,18 @@
 #include "outparam_gamedoid.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -130,6 +142,12 @@ hka_fkmedoid
     llfh_listFuntionHist
     (aiinp_inParamHKA.getNumMaxGenerations(), "Iterations", "Clustering metrics"); 
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamHKA.getNumMaxGenerations(),
+     aiinp_inParamHKA
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
   
@@ -214,6 +232,10 @@ hka_fkmedoid
       lvectorchromfixleng_newoffspring.push_back
 	(new gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>());
     }
+
+  /*SED RETURNED BY THE LOCAL SEARCH OF EACH OFFSPRING, -1 IF IT DID NOT RUN
+   */
+  std::vector<T_REAL> lvectorT_SSELocalSearch(lvectorchromfixleng_newoffspring.size());
  
   /*Step 1. Randomly initialize a population with P
     individuals. Each individual uniquely encodes a
@@ -235,23 +257,64 @@ hka_fkmedoid
 
     const uintidx  luintidx_numClusterK =
       (uintidx) aiinp_inParamHKA.getNumClusterK();
+
+    /*COST OF AN INSTANCE TO A SEED, THE SQUARED DISSIMILARITY
+     */
+    auto lfunc_costSeeds =
+      [&](const uintidx aiui_i, const uintidx aiui_j) -> T_REAL
+      {
+	const T_REAL lrt_dissimilarity = aimatrixtriagrt_dissimilarity(aiui_i,aiui_j);
+	return lrt_dissimilarity * lrt_dissimilarity;
+      };
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamHKA.getOpInitialization(),
+       aimatrixtriagrt_dissimilarity.getNumRows(),
+       aiinp_inParamHKA.getOversamplingInitialization() * luintidx_numClusterK,
+       aiinp_inParamHKA.getRoundsInitialization(),
+       lfunc_costSeeds
+       );
+    gawarmstart::WarmStartMedoids<T_REAL>
+      lwarmstart_population
+      (aiinp_inParamHKA.getFileNameWarmStart(),
+       aiinp_inParamHKA.getFractionWarmStart(),
+       aiinp_inParamHKA.getPerturbationWarmStart(),
+       aiinp_inParamHKA.getSizePopulation(),
+       aimatrixtriagrt_dissimilarity
+       );
     
     for (auto ichrom_population :lvectorchromfixleng_population) {
-       
-      std::unordered_set<T_INSTANCEIDX> &&lunorderedset_medoids =
-	prob::getWithoutRepeatsSet
-	( luintidx_numClusterK,
-	  [&]() -> T_INSTANCEIDX
-	  {
-	    return uniformdis_idxInstances(gmt19937_eng);
-	  }
-	  );
 
-      std::copy_n
-	(lunorderedset_medoids.begin(),
-	 lunorderedset_medoids.size(),
-	 ichrom_population->getString()   
-	 );
+      if ( lwarmstart_population.hasNext() ) {
+	lwarmstart_population.initialize
+	  (ichrom_population->getString(),luintidx_numClusterK);
+      }
+      else if ( lseeds_initial.isRandom() ) {
+	std::unordered_set<T_INSTANCEIDX> &&lunorderedset_medoids =
+	  prob::getWithoutRepeatsSet
+	  ( luintidx_numClusterK,
+	    [&]() -> T_INSTANCEIDX
+	    {
+	      return uniformdis_idxInstances(gmt19937_eng);
+	    }
+	    );
+
+	std::copy_n
+	  (lunorderedset_medoids.begin(),
+	   lunorderedset_medoids.size(),
+	   ichrom_population->getString()   
+	   );
+      }
+      else {
+	std::vector<uintidx> &&lvectorui_medoids =
+	  lseeds_initial.select(luintidx_numClusterK,lfunc_costSeeds);
+
+	std::copy_n
+	  (lvectorui_medoids.begin(),
+	   lvectorui_medoids.size(),
+	   ichrom_population->getString()   
+	   );
+      }
 
       ichrom_population->setObjetiveFunc(std::numeric_limits<T_REAL>::max());
       ichrom_population->setFitness(-std::numeric_limits<T_REAL>::max());
@@ -557,13 +620,15 @@ hka_fkmedoid
 #endif /*__VERBOSE_YES*/
 
       
-      for ( auto ichrom_newoffspring: lvectorchromfixleng_newoffspring ) {
+      for ( uintidx lui_i = 0; lui_i < lvectorchromfixleng_newoffspring.size(); lui_i++ ) {
 	
+	lvectorT_SSELocalSearch[lui_i] = -1.0;
 	if ( uniformdis_real01(gmt19937_eng)  
 	     < aiinp_inParamHKA.getProbSearchHeuristic()  ) {
 
-	  clusteringop::updateMedoids
-	    (ichrom_newoffspring->getString(),
+	  lvectorT_SSELocalSearch[lui_i] =
+	    clusteringop::updateMedoids
+	    (lvectorchromfixleng_newoffspring[lui_i]->getString(),
 	     aiinp_inParamHKA.getNumClusterK(),
 	     aiinp_inParamHKA.getNearestNeighbors(),
 	     aimatrixtriagrt_dissimilarity
@@ -600,10 +665,17 @@ hka_fkmedoid
       }
 #endif /*__VERBOSE_YES*/
 
-      for ( auto&& ichrom_newoffspring: lvectorchromfixleng_newoffspring ) {
-     
-	T_REAL lT_objetiveFunc = 
-	  um::SSEMedoid
+      for ( uintidx lui_i = 0; lui_i < lvectorchromfixleng_newoffspring.size(); lui_i++ ) {
+
+	gaencode::ChromFixedLength<T_INSTANCEIDX,T_REAL>* ichrom_newoffspring =
+	  lvectorchromfixleng_newoffspring[lui_i];
+	
+	/*THE LOCAL SEARCH ALREADY RETURNS THE SED OF THE OFFSPRING
+	 */
+	T_REAL lT_objetiveFunc =
+	  ( lvectorT_SSELocalSearch[lui_i] >= 0.0 )?
+	  lvectorT_SSELocalSearch[lui_i]
+	  :um::SSEMedoid
 	  (ichrom_newoffspring->getString(),
 	   aiinp_inParamHKA.getNumClusterK(),
 	   aimatrixtriagrt_dissimilarity
@@ -845,8 +917,11 @@ hka_fkmedoid
     --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
     
-  } while ( llfh_listFuntionHist.getDomainUpperBound() <
-	    aiinp_inParamHKA.getNumMaxGenerations() );  
+  } while ( !lterminationcriteria.isAttained
+	    (llfh_listFuntionHist.getDomainUpperBound(),
+	     runtime::elapsedTime(let_executionTime),
+	     lochromfixleng_best.getFitness()
+	     ) );  
   /* END  REPEAT */
 
   
@@ -925,6 +1000,8 @@ hka_fkmedoid
     (lochromfixleng_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
  
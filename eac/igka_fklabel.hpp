@@ -39,6 +39,13 @@
 #include "inparam_pmfk.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 
 /*! \namespace eac
@@ -186,6 +193,12 @@ igka_fklabel
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPmFk.getNumMaxGenerations(),
+     aiinp_inParamPmFk
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
 
@@ -307,16 +320,35 @@ igka_fklabel
 #endif /*ALG_FGKA_FKLABEL_LU_ETAL2004*/
        
       }
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamPmFk.getFileNameWarmStart(),
+       aiinp_inParamPmFk.getFractionWarmStart(),
+       aiinp_inParamPmFk.getPerturbationWarmStart(),
+       aiinp_inParamPmFk.getSizePopulation(),
+       aivectorptinst_instances.begin(),
+       aivectorptinst_instances.end()
+       );
+
     for (auto lchromigka_iter: lvectorchromigka_populationS) {
-      
-      gagenericop::initializeGenes
-	(lchromigka_iter->begin(),
-	 lchromigka_iter->end(),
-	 [&]() 
-	 {
-	   return uniformdis_mmcidx0K(gmt19937_eng);
-	 }
-	 );
+
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (lchromigka_iter->getString(),
+	   (T_CLUSTERIDX) aiinp_inParamPmFk.getNumClusterK(),
+	   aivectorptinst_instances.begin(),
+	   aivectorptinst_instances.end(),
+	   aifunc2p_dist
+	   );
+      else
+	gagenericop::initializeGenes
+	  (lchromigka_iter->begin(),
+	   lchromigka_iter->end(),
+	   [&]() 
+	   {
+	     return uniformdis_mmcidx0K(gmt19937_eng);
+	   }
+	   );
 
       //EVALUATE ObjetiveFunc
 #ifdef ALG_IGKA_FKLABEL_LU_ETAL2004
@@ -469,7 +501,11 @@ igka_fklabel
 
   /*BEGIN EVOLUTIONARY LOOP------------------------------------------------------ 
    */
-  while ( llfh_listFuntionHist.getDomainUpperBound() <  aiinp_inParamPmFk.getNumMaxGenerations()) {
+  while ( !lterminationcriteria.isAttained
+	  (llfh_listFuntionHist.getDomainUpperBound(),
+	   runtime::elapsedTime(lexetime_time),
+	   lochromigka_best.getFitness()
+	   ) ) {
     
     llfh_listFuntionHist.increaseDomainUpperBound();
    
@@ -724,9 +760,13 @@ igka_fklabel
 	 
 #endif /*ALG_FGKA_FKLABEL_LU_ETAL2004*/
 	  
-	for ( uintidx luintidx_i = 0; luintidx_i < aivectorptinst_instances.size(); luintidx_i++) {
-	    
-	  if ( uniformdis_real01(gmt19937_eng) < aiinp_inParamPmFk.getProbMutation() ) {
+	/*ONLY THE ALLELES THAT MUTATE ARE DRAWN
+	 */
+	prob::forEachBernoulliSuccess
+	  (aivectorptinst_instances.size(),
+	   aiinp_inParamPmFk.getProbMutation(),
+	   [&](const uintidx luintidx_i)
+	   {
 	    /*IF BEGIN PROBABILITY*/
 #ifdef ALG_IGKA_FKLABEL_LU_ETAL2004
 	      
@@ -840,9 +880,8 @@ igka_fklabel
 	      /*AccumulateUpdate(m, n, olda, S[m].a[n]);
 	       */
 	    }
-	  } /*IF BEGIN PROBABILITY*/
-	    
-	} /*FOR*/
+	   } /*IF BEGIN PROBABILITY*/
+	   );
 	  
 #ifdef ALG_IGKA_FKLABEL_LU_ETAL2004
 	  
@@ -1242,6 +1281,8 @@ igka_fklabel
     (lochromigka_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(lexetime_time));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
    
@@ -33,6 +33,29 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+#include "runtime_profile.hpp"
+#include "ga_island.hpp"
+
+/*THE FITNESS CAN BE ESTIMATED ON A MINI-BATCH OF THE INSTANCES,
+  see minibatch.hpp
+ */
+#define __INPARAM_MINIBATCH__
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -153,6 +176,15 @@ kga_fkcentroid
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPcPmFk.getNumMaxGenerations(),
+     aiinp_inParamPcPmFk
+     );
+
+  /*TIME, CALLS AND DISTANCES OF EACH PHASE, ENABLED WITH THE PLOT-STAT FILE*/
+  runtime::ProfilePhases lprofile_phases;
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM*/
 #ifndef __WITHOUT_PLOT_STAT
   std::ofstream               lfileout_plotStatObjetiveFunc;
@@ -199,6 +231,11 @@ kga_fkcentroid
 
     lfileout_plotStatObjetiveFunc.precision(COMMON_COUT_PRECISION);
 
+    lprofile_phases.open
+      (aoop_outParamGAC.getFileNameOutPlotStatObjetiveFunc(),
+       llfh_listFuntionHist.getPlotStatSeparator()
+       );
+
     //FUNCTION HEADER
     lfileout_plotStatObjetiveFunc 
       <<  llfh_listFuntionHist.getHeaderFuntions() 
@@ -241,6 +278,7 @@ kga_fkcentroid
     \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
   */
   {/*BEGIN INITIALIZE POPULATION P(t)*/
+    runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_INITIALIZE);
       
 #ifdef __VERBOSE_YES
     geverbosepc_labelstep = "(0) POPULATION INITIAL";
@@ -253,6 +291,26 @@ kga_fkcentroid
     }
 #endif /*__VERBOSE_YES*/
 
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamPcPmFk.getOpInitialization(),
+       uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)),
+       aiinp_inParamPcPmFk.getOversamplingInitialization() * lconstui_numClusterFk,
+       aiinp_inParamPcPmFk.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamPcPmFk.getFileNameWarmStart(),
+       aiinp_inParamPcPmFk.getFractionWarmStart(),
+       aiinp_inParamPcPmFk.getPerturbationWarmStart(),
+       aiinp_inParamPcPmFk.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for ( auto& lchromfixleng_iter: lvectorchromfixleng_population ) {
       
       /*DECODE CHROMOSOME
@@ -264,11 +322,24 @@ kga_fkcentroid
 	 lchromfixleng_iter.getString()
 	 );
  	 
-      clusteringop::randomInitialize
-	(lmatrixrowt_centroidsChrom,
-	 aiiterator_instfirst,
-	 aiiterator_instlast
-	 );
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else if ( lseeds_initial.isRandom() ) 
+	clusteringop::randomInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else
+	clusteringop::seedsInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   lseeds_initial.select(lconstui_numClusterFk,lcostseeds_instances)
+	   );
 
       lchromfixleng_iter.setFitness
 	(-std::numeric_limits<T_REAL>::max());
@@ -289,11 +360,24 @@ kga_fkcentroid
 
   } /*END INITIALIZE POPULATION P(t)*/
 
+  /*MINI-BATCH: WITH --minibatch-size THE CLUSTERS AND THE FITNESS
+    ARE COMPUTED ON A SAMPLE OF THE INSTANCES THAT CHANGES EACH
+    GENERATION
+   */
+  minibatch::StratifiedSample<INPUT_ITERATOR>
+    lminibatch_sample
+    (aiiterator_instfirst,
+     aiiterator_instlast,
+     aiinp_inParamPcPmFk.getSizeMiniBatch(),
+     aiinp_inParamPcPmFk.getGrowthMiniBatch()
+     );
+
   while ( 1 ) {
     
     /*BEGIN ITERATION
      */
     llfh_listFuntionHist.increaseDomainUpperBound();
+    lminibatch_sample.next();
 
     /*CLUSTERING
       In this step, the cluster are formed according to the center 
@@ -310,6 +394,7 @@ kga_fkcentroid
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
     {/*BEGIN CLUSTERING*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_CLUSTERING);
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "A. THE CLUSTERS ARE FORMED";
       ++geiinparam_verbose;
@@ -345,13 +430,12 @@ kga_fkcentroid
 	    
 	T_CLUSTERIDX lmcidx_numClusterNull;
 	    
-	clusteringop::updateCentroids
+	minibatch::updateCentroids
 	  (lmcidx_numClusterNull,
 	   lmatrixrowt_centroidsChrom,
 	   llmatrixrowt_sumInstancesCluster,
 	   lvectort_numInstancesInClusterK,
-	   aiiterator_instfirst,
-	   aiiterator_instlast,
+	   lminibatch_sample,
 	   aifunc2p_dist
 	   );
       }
@@ -381,6 +465,7 @@ kga_fkcentroid
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002} 
     */
     { /*BEGIN COMPUTED METRIC M AND FITNESS*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_FITNESS);
      
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "B. COMPUTED METRIC M AND FITNESS";
@@ -406,10 +491,9 @@ kga_fkcentroid
 	   );
 
 	std::pair<T_REAL,bool> lpair_SSE =
-	  um::SSE 
+	  minibatch::SSE 
 	  (lmatrixrowt_centroidsChrom,
-	   aiiterator_instfirst,
-	   aiiterator_instlast,
+	   lminibatch_sample,
 	   aifunc2p_dist
 	   );
 	   
@@ -450,6 +534,7 @@ kga_fkcentroid
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
     { /*BEGIN ELITISM REPLACING THE WORST CHROMOSOME*/ 
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_ELITISM);
 
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "ELITISM REPLACING THE WORST CHROMOSOME";
@@ -461,6 +546,26 @@ kga_fkcentroid
       }
 #endif /*__VERBOSE_YES*/
 
+      /*THE BEST STRING IS EVALUATED ON THE SAME SAMPLE AS THE POPULATION
+       */
+      if ( lminibatch_sample.isActive() &&
+	   lochromfixleng_best.getFitness() != -std::numeric_limits<T_REAL>::max() ) {
+	mat::MatrixRow<T_FEATURE> 
+	  lmatrixrowt_centroidsBest
+	  (lconstui_numClusterFk,
+	   data::Instance<T_FEATURE>::getNumDimensions(),
+	   lochromfixleng_best.getString()
+	   );
+	std::pair<T_REAL,bool> lpair_SSE =
+	  minibatch::SSE 
+	  (lmatrixrowt_centroidsBest,
+	   lminibatch_sample,
+	   aifunc2p_dist
+	   );
+	lochromfixleng_best.setObjetiveFunc(lpair_SSE.first);
+	lochromfixleng_best.setFitness(1.0 / lpair_SSE.first);
+      }
+
       auto lit_chromMin =
 	std::min_element   
 	(lvectorchromfixleng_population.begin(),
@@ -495,6 +600,7 @@ kga_fkcentroid
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
     { /*BEGIN PRESERVING THE BEST STRING*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_ELITISM);
 
       auto lchromfixleng_iterMax  =
 	std::max_element
@@ -556,6 +662,7 @@ kga_fkcentroid
 	 lvectorT_statfuncObjetiveFunc
 	 );
       lfileout_plotStatObjetiveFunc << llfh_listFuntionHist;
+      lprofile_phases.endGeneration(llfh_listFuntionHist.getDomainUpperBound());
       lvectorT_statfuncObjetiveFunc.clear();
     }
 #endif /*__WITHOUT_PLOT_STAT*/
@@ -579,11 +686,21 @@ kga_fkcentroid
     --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
    
-    if ( !(llfh_listFuntionHist.getDomainUpperBound() 
-	   < aiinp_inParamPcPmFk.getNumMaxGenerations() ) 
+    if ( lterminationcriteria.isAttained
+	 (llfh_listFuntionHist.getDomainUpperBound(),
+	  runtime::elapsedTime(let_executionTime),
+	  lochromfixleng_best.getFitness()
+	  )
 	 )
       break;
 
+    /*MIGRATION BETWEEN THE ISLANDS
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchromfixleng_population
+       );
+
     /*3.1.4 GENETIC OPERATIONS
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
@@ -598,6 +715,7 @@ kga_fkcentroid
       \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
     { /*BEGIN SELECTION*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_SELECTION);
      
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "SELECTION";
@@ -657,6 +775,7 @@ kga_fkcentroid
       two offspring. \cite{Bandyopadhyay:Maulik:GAclustering:KGA:2002}
     */
     { /*BEGIN CROSSOVER*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_CROSSOVER);
 
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "CROSSOVER";
@@ -706,10 +825,9 @@ kga_fkcentroid
 
 	     std::pair<T_REAL,bool> 
 	       lpair_SSE1 =
-	       um::SSE
+	       minibatch::SSE
 	       (lmatrixrowt_centroidsChromChild1,
-		aiiterator_instfirst,
-		aiiterator_instlast, 
+		lminibatch_sample,
 		aifunc2p_dist
 		);
 	     aochrom_child1.setObjetiveFunc(lpair_SSE1.first);
@@ -729,10 +847,9 @@ kga_fkcentroid
 
 	     std::pair<T_REAL,bool> 
 	       lpair_SSE2 =
-	       um::SSE 
+	       minibatch::SSE 
 	       (lmatrixrowt_centroidsChromChild2,
-		aiiterator_instfirst,
-		aiiterator_instlast,
+		lminibatch_sample,
 		aifunc2p_dist
 		);
 	    
@@ -778,6 +895,7 @@ kga_fkcentroid
       */
     
     { /*BEGIN MUTATION*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_MUTATION);
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "MUTATION";
       ++geiinparam_verbose;
@@ -852,7 +970,31 @@ kga_fkcentroid
    */
   delete [] larray_maxFeactures;
   delete [] larray_minFeactures;
+
+  /*MINI-BATCH: THE BEST STRING IS EVALUATED ON ALL THE INSTANCES
+   */
+  if ( lminibatch_sample.isUsed() ) {
+    mat::MatrixRow<T_FEATURE> 
+      lmatrixrowt_centroidsBest
+      (lconstui_numClusterFk,
+       data::Instance<T_FEATURE>::getNumDimensions(),
+       lochromfixleng_best.getString()
+       );
+    std::pair<T_REAL,bool> lpair_SSE =
+      um::SSE 
+      (lmatrixrowt_centroidsBest,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       aifunc2p_dist
+       );
+    aoop_outParamGAC.setMiniBatch
+      (lochromfixleng_best.getObjetiveFunc(),lpair_SSE.first);
+    lochromfixleng_best.setObjetiveFunc(lpair_SSE.first);
+    lochromfixleng_best.setFitness(1.0 / lpair_SSE.first);
+    lochromfixleng_best.setValidString(lpair_SSE.second);
+  }
     
+  lprofile_phases.close();
   runtime::stop(let_executionTime);
   aoop_outParamGAC.setNumClusterK
     (aiinp_inParamPcPmFk.getNumClusterK());
@@ -862,6 +1004,8 @@ kga_fkcentroid
     (runtime::getTime(let_executionTime));
   aoop_outParamGAC.setFitness
     (lochromfixleng_best.getFitness());
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
  
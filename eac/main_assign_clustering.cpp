@@ -0,0 +1,256 @@
+/*! \file main_assign_clustering.cpp
+ *
+ * \brief Main program for the assignment of new instances to a learned model
+ *
+ * \details This file is part of the LEAC.\n\n
+ * Assign each instance of a file to the nearest centroid or medoid of a\n
+ * model written with the option -C by a clustering algorithm, without\n
+ * running the algorithm again. The instances are read by chunks, optionally\n
+ * standardized with the parameters written by stdvar_milligan_cooper1988\n
+ * --std-var-outfile, and the nearest centroids of each chunk are obtained\n
+ * by blocks of instances distributed among the threads. For each instance\n
+ * a line with its cluster is written, and optionally the distance.\n
+ * \n
+ * Library Evolutionary Algorithms for Clustering (LEAC) is a library\n
+ * for the implementation of evolutionary and genetic algorithms\n
+ * focused on the partition type clustering problem. Based on the\n
+ * current standards of the <a href="http://en.cppreference.com">C++</a> language, as well as on Standard\n
+ * Template Library <a href="http://en.cppreference.com/w/cpp/container">STL</a>
+ * and also  <a href="http://www.openblas.net/">OpenBLAS</a> to have a better performance.\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#include <cstdlib>
+#include <limits>
+#include "datatype_instance_real.hpp"
+#include "instance_view.hpp"
+#include "line_split.hpp"
+#include "outfilename.hpp"
+#include "file_utils.hpp"
+#include "dist_euclidean.hpp"
+#include "nearestcentroids_block.hpp"
+#include "clustering_model.hpp"
+
+#include "inparam_assignclustering.hpp"
+#include "inparamclustering_getparameter.hpp"
+
+#include "verbose.hpp"
+
+/*---< main() >-------------------------------------------------------------
+*/
+int main(int argc, char **argv)
+{
+#ifdef __VERBOSE_YES
+   const char* lpc_labeMain = "main_assign_clustering.cpp";
+   geverbosepc_labelstep = lpc_labeMain;
+#endif /*__VERBOSE_YES*/
+
+  inout::InParamAssignClustering
+    <DATATYPE_FEATURE,
+     DATATYPE_INSTANCES_CLUSTER_K,
+     DATATYPE_CLUSTERIDX
+     >
+    linparam_assign
+    ("ASSIGN",
+     "Nearest centroid",
+     inout::OTHER
+     );
+
+  /*READ PARAMETER
+   */
+  inparamclustering_getParameter
+    (linparam_assign, argc, argv);
+
+#ifdef __VERBOSE_YES
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << "main:  IN"
+	      << '(' << geiinparam_verbose << ')'
+	      << "\nargv: ";
+    std::cout << argv[0] << ' ';
+    for (int li_i = 1; li_i < argc;  li_i++ ) {
+      std::cout << ' '  << argv[li_i];
+    }
+    std::cout << "\n";
+  }
+#endif /*__VERBOSE_YES*/
+
+  if ( linparam_assign.getFileNameModel().empty() ) {
+    throw std::invalid_argument("main_assign_clustering: without --model-infile");
+  }
+
+  /*READ: MODEL, THE INSTANCES HAVE THE DIMENSIONS OF THE CENTROIDS
+   */
+  mat::MatrixRow<DATATYPE_FEATURE> lmatrixrowt_model =
+    inout::readModel<DATATYPE_FEATURE>
+    (linparam_assign.getFileNameModel(),
+     linparam_assign.getNumRunModel()
+     );
+  const uintidx lui_numDimensions = lmatrixrowt_model.getNumColumns();
+  data::Instance<DATATYPE_FEATURE>::setNumDimensions(lui_numDimensions);
+
+  mat::MatrixRow<DATATYPE_FEATURE> lmatrixrowt_stdVar;
+  if ( !linparam_assign.getFileNameStdVar().empty() ) {
+    lmatrixrowt_stdVar =
+      inout::readStdVar<DATATYPE_FEATURE>
+      (linparam_assign.getFileNameStdVar(),
+       lui_numDimensions
+       );
+  }
+  const DATATYPE_FEATURE *larrayt_location =
+    (lmatrixrowt_stdVar.getNumRows() > 0)?lmatrixrowt_stdVar.getRow(0):NULL;
+  const DATATYPE_FEATURE *larrayt_scale =
+    (lmatrixrowt_stdVar.getNumRows() > 0)?lmatrixrowt_stdVar.getRow(1):NULL;
+
+  const std::string lstr_fileInstance(linparam_assign.getCurrentFileInstance());
+  std::ifstream lfp_file(lstr_fileInstance);
+  if (!lfp_file) {
+    throw  std::invalid_argument
+      ("main_assign_clustering: no file input data " + lstr_fileInstance);
+  }
+
+  dist::Euclidean<DATATYPE_REAL,DATATYPE_FEATURE> lfunct2p_distEuclidean;
+
+  /*CHUNK OF INSTANCES, THE VIEWS POINT TO THE ROWS OF THE CHUNK
+   */
+  const uintidx lui_numInstChunk =
+    (linparam_assign.getNumInstChunk() > 0)?linparam_assign.getNumInstChunk():1;
+  mat::MatrixRow<DATATYPE_FEATURE> lmatrixrowt_chunk(lui_numInstChunk,lui_numDimensions);
+  std::vector<data::InstanceView
+	      <DATATYPE_FEATURE,DATATYPE_INSTANCES_CLUSTER_K,DATATYPE_CLUSTERIDX> >
+    lvectorinstview_chunk(lui_numInstChunk);
+  std::vector<data::Instance<DATATYPE_FEATURE>* > lvectorptinst_chunk(lui_numInstChunk);
+  for (uintidx lui_i = 0; lui_i < lui_numInstChunk; lui_i++) {
+    lvectorinstview_chunk[lui_i].setView
+      (lmatrixrowt_chunk.getRow(lui_i),UNKNOWN_CLUSTER_IDX);
+    lvectorptinst_chunk[lui_i] = &lvectorinstview_chunk[lui_i];
+  }
+  std::vector<std::string>         lvectorstr_lines(lui_numInstChunk);
+  std::vector<std::string>         lvectorstr_id
+    (linparam_assign.getIDInstanceColumn()?lui_numInstChunk:0);
+  std::vector<uintidx>             lvectorui_numLine(lui_numInstChunk);
+  std::vector<DATATYPE_CLUSTERIDX> lvectorcidx_nearest(lui_numInstChunk);
+  std::vector<DATATYPE_REAL>       lvectorrt_distMin(lui_numInstChunk);
+
+  inout::OutFileName   lofn_filename;
+  std::ostream& lostream_out =
+    lofn_filename.openFile(linparam_assign.getFileNameTimesRun(),std::ios::out);
+  lostream_out.precision(COMMON_COUT_PRECISION);
+
+  uintidx lui_countLines = 0;
+  bool    lb_skipHeader  = linparam_assign.getHaveHeaderFileInstance();
+
+  while ( lfp_file ) {
+
+    /*READ: THE LINES OF THE NEXT CHUNK
+     */
+    uintidx lui_numInstRead = 0;
+    while ( lui_numInstRead < lui_numInstChunk
+	    && std::getline(lfp_file,lvectorstr_lines[lui_numInstRead]) ) {
+      ++lui_countLines;
+      const std::string& lstr_linedata = lvectorstr_lines[lui_numInstRead];
+      if ( (lstr_linedata.size() > 0)
+	   && !(lstr_linedata.at(0) == '@' ||  lstr_linedata.at(0) == '#') ) {
+	if ( lb_skipHeader )
+	  lb_skipHeader = false;
+	else
+	  lvectorui_numLine[lui_numInstRead++] = lui_countLines;
+      }
+    }
+    if ( lui_numInstRead == 0 )
+      break;
+
+    /*GET INSTANCE: EACH THREAD SPLITS ITS LINES
+     */
+    uintidx lui_lineError = std::numeric_limits<uintidx>::max();
+
+#pragma omp parallel if ( lui_numInstRead >= NEARESTBLOCK_MIN_PARALLEL )
+    {
+      inout::LineSplit
+	lls_lineSplit
+	(linparam_assign.getSeparateAttributes(),
+	 linparam_assign.getSelectAttributes()
+	 );
+
+#pragma omp for schedule(static)
+      for (long ll_i = 0; ll_i < long(lui_numInstRead); ll_i++) {
+	DATATYPE_FEATURE* larrayt_feature = lmatrixrowt_chunk.getRow(uintidx(ll_i));
+	try {
+	  lls_lineSplit.splitReal
+	    (lvectorstr_lines[ll_i],
+	     larrayt_feature,
+	     lui_numDimensions
+	     );
+	  if ( linparam_assign.getIDInstanceColumn() ) {
+	    lls_lineSplit.split(lvectorstr_lines[ll_i]);
+	    lvectorstr_id[ll_i] =
+	      lls_lineSplit.getItem(linparam_assign.getIDInstanceColumn());
+	  }
+	}
+	catch (std::out_of_range &ex) {
+#pragma omp critical
+	  {
+	    if ( lvectorui_numLine[ll_i] < lui_lineError )
+	      lui_lineError = lvectorui_numLine[ll_i];
+	  }
+	}
+	if ( larrayt_location != NULL ) {
+	  for (uintidx lui_j = 0; lui_j < lui_numDimensions; lui_j++) {
+	    larrayt_feature[lui_j] =
+	      (larrayt_feature[lui_j] - larrayt_location[lui_j]) / larrayt_scale[lui_j];
+	  }
+	}
+      }
+    }
+
+    if ( lui_lineError != std::numeric_limits<uintidx>::max() ) {
+      std::ostringstream lostrstream_error;
+      lostrstream_error
+	<< "Error: On line "
+	<< lui_lineError
+	<< " of file "
+	<< lstr_fileInstance
+	<< " incomplete data";
+      throw std::out_of_range(lostrstream_error.str() );
+    }
+
+    /*NEAREST CENTROID OF EACH INSTANCE OF THE CHUNK
+     */
+    nearest::NNBlocks
+      (lvectorcidx_nearest.data(),
+       lvectorrt_distMin.data(),
+       lmatrixrowt_model,
+       lvectorptinst_chunk.begin(),
+       lvectorptinst_chunk.begin() + lui_numInstRead,
+       lfunct2p_distEuclidean
+       );
+
+    /*OUT: ONE LINE FOR EACH INSTANCE
+     */
+    for (uintidx lui_i = 0; lui_i < lui_numInstRead; lui_i++) {
+      if ( linparam_assign.getIDInstanceColumn() )
+	lostream_out << lvectorstr_id[lui_i] << lofn_filename.getDelim();
+      lostream_out << lvectorcidx_nearest[lui_i];
+      if ( linparam_assign.getPrintDistance() )
+	lostream_out << lofn_filename.getDelim() << lvectorrt_distMin[lui_i];
+      lostream_out << '\n';
+    }
+  }
+
+  lostream_out.flush();
+  lofn_filename.closeFile();
+
+#ifdef __VERBOSE_YES
+  geverbosepc_labelstep = lpc_labeMain;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << "main: OUT"
+	      << '(' << geiinparam_verbose << ")\n";
+  }
+  --geiinparam_verbose;
+#endif /*__VERBOSE_YES*/
+
+  return 0;
+}
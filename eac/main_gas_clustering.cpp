@@ -54,17 +54,29 @@
 #endif /*ALG_CBGA_FKCENTROID_FRANTI_ETAL_1997*/
 
 #ifdef  ALG_GAS_FKCENTROID_MAULIK_BANDYOPADHYAY_2000
+#ifdef  __FLOAT_INSTANCES__
+#include "datatype_instance_float.hpp"
+#else
 #include "datatype_instance_real.hpp"
+#endif /*__FLOAT_INSTANCES__*/
 #include "gas_fkcentroid.hpp"
 #endif /*ALG_GAS_FKCENTROID_MAULIK_BANDYOPADHYAY_2000*/
 
 #ifdef  ALG_KGA_FKCENTROID_BANDYOPADHYAY_MAULIK_2002
+#ifdef  __FLOAT_INSTANCES__
+#include "datatype_instance_float.hpp"
+#else
 #include "datatype_instance_real.hpp"
+#endif /*__FLOAT_INSTANCES__*/
 #include "kga_fkcentroid.hpp"
 #endif /*ALG_KGA_FKCENTROID_BANDYOPADHYAY_MAULIK_2002*/
 
 #ifdef  ALG_GAGR_FKCENTROID_CHANG_ETAL_2009
+#ifdef  __FLOAT_INSTANCES__
+#include "datatype_instance_float.hpp"
+#else
 #include "datatype_instance_real.hpp"
+#endif /*__FLOAT_INSTANCES__*/
 #include "gagr_fkcentroid.hpp"
 #endif /*ALG_GAGR_FKCENTROID_CHANG_ETAL_2009*/
 
@@ -123,12 +135,20 @@
 /* Variable-K --- Encode centroids 
  */
 #ifdef ALG_VGA_VKCENTROID_BANDYOPADHYAY_AND_MAULIK_2001
+#ifdef  __FLOAT_INSTANCES__
+#include "datatype_instance_float.hpp"
+#else
 #include "datatype_instance_real.hpp"
+#endif /*__FLOAT_INSTANCES__*/
 #include "vga_vkcentroid.hpp"
 #endif /*ALG_VGA_VKCENTROID_BANDYOPADHYAY_AND_MAULIK_2001*/
 
 #ifdef ALG_GCUK_VKCENTROID_BANDYOPADHYAY_AND_MAULIK_2002
+#ifdef  __FLOAT_INSTANCES__
+#include "datatype_instance_float.hpp"
+#else
 #include "datatype_instance_real.hpp"
+#endif /*__FLOAT_INSTANCES__*/
 #include "gcuk_vkcentroid.hpp"
 #endif /*ALG_GCUK_VKCENTROID_BANDYOPADHYAY_AND_MAULIK_2002*/
 
@@ -161,11 +181,15 @@
 #include <leac.hpp>
 #include "inparamclustering_getparameter.hpp"
 #include "instances_read.hpp"
+#ifdef __INSTANCES_MMAP
+#include "instances_mmap.hpp"
+#endif /*__INSTANCES_MMAP*/
 #include "bar_progress.hpp"
+#include "clustering_worker.hpp"
 
  
-/*---< main() >-------------------------------------------------------------*/
-int main(int argc, char **argv) 
+/*---< mainClustering() >---------------------------------------------------*/
+int mainClustering(int argc, char **argv) 
 {
 
 #ifdef __VERBOSE_YES
@@ -1398,14 +1422,34 @@ int main(int argc, char **argv)
      */
 #ifdef __INSTANCES_WITH_FREQUENCY
 
-    auto lpairvec_dataset =  inout::dataSetReadWithFreq(linparam_ClusteringGA);
+    auto lpairvec_dataset =
+      clusteringworker::dataSetReadResident
+      (linparam_ClusteringGA,
+       [&]() { return inout::dataSetReadWithFreq(linparam_ClusteringGA); }
+       );
  
+#elif defined(__INSTANCES_MMAP)
+
+    /*THE TRAINING INSTANCES ARE TRAVERSED BY BLOCKS FROM A BINARY FILE
+      MAPPED IN MEMORY
+     */
+    auto lpairvec_dataset =  inout::dataSetReadMmap(linparam_ClusteringGA);
+
 #else /* INSTANCES WITHOUT FREQUENCY */
 
-    auto lpairvec_dataset =  inout::dataSetRead(linparam_ClusteringGA);
+    auto lpairvec_dataset =
+      clusteringworker::dataSetReadResident
+      (linparam_ClusteringGA,
+       [&]() { return inout::dataSetRead(linparam_ClusteringGA); }
+       );
  
 #endif /*__INSTANCES_WITH_FREQUENCY*/
 
+    /*THE RESIDENT WORKER ONLY READS THE DATA SETS BEFORE STARTING THE JOB
+     */
+    if ( clusteringworker::isPreparing() )
+      continue;
+
     std::pair<std::vector<std::string>,std::string> 
       lpairvecstrstr_instanceDimName = 
       inout::instancesReadDimName
@@ -1593,6 +1637,14 @@ int main(int argc, char **argv)
       break;
     }
   
+#ifdef __INSTANCES_WITH_FREQUENCY
+    /*CORESET: INSTANCES WITH FREQUENCY WHERE THE ALGORITHM RUNS,
+      THE LABELS ARE ASSIGNED BACK TO THE FULL DATA SET
+     */
+    std::vector<data::Instance<DATATYPE_FEATURE>* > lvectorptinst_coreset;
+    std::vector<DATATYPE_CLUSTERIDX>                lvectorcidx_memberShipFull;
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+
     for (int  li_l = 1; li_l <= linparam_ClusteringGA.getTimesRunAlgorithm(); li_l++) {
 
       if ( linparam_ClusteringGA.getRandomSeed().size() == 0 ||
@@ -1627,6 +1679,80 @@ int main(int argc, char **argv)
       } /*END PRINT PARAMETERS
 	 */
 
+#ifdef __INSTANCES_WITH_FREQUENCY
+      /*BUILD THE CORESET WITH THE SEED OF THE FIRST RUN
+       */
+      if ( li_l == 1 &&
+	   linparam_ClusteringGA.getOpCoreset() != INPARAM_CORESET_NONE ) {
+
+	auto lfunc_frequency =
+	  [](const  data::Instance<DATATYPE_FEATURE>* linst_iter) ->
+	  const DATATYPE_INSTANCE_FREQUENCY
+	  {
+	    data::InstanceFreq<DATATYPE_FEATURE,DATATYPE_INSTANCE_FREQUENCY>*
+	      linstfreq_inst = 
+	      (data::InstanceFreq<DATATYPE_FEATURE,DATATYPE_INSTANCE_FREQUENCY>*)
+	      linst_iter;
+	    return linstfreq_inst->getFrequency();
+	  };
+
+	switch ( linparam_ClusteringGA.getOpCoreset() ) {
+
+	case INPARAM_CORESET_DEDUP:
+	  lvectorptinst_coreset =
+	    coreset::dedup<DATATYPE_FEATURE,DATATYPE_INSTANCE_FREQUENCY>
+	    (lpairvec_dataset.first.begin(),
+	     lpairvec_dataset.first.end(),
+	     lfunc_frequency
+	     );
+	  break;
+
+	case INPARAM_CORESET_GRID:
+	  lvectorptinst_coreset =
+	    coreset::grid<DATATYPE_FEATURE,DATATYPE_INSTANCE_FREQUENCY,DATATYPE_FEATURE_SUM>
+	    (lpairvec_dataset.first.begin(),
+	     lpairvec_dataset.first.end(),
+	     linparam_ClusteringGA.getSizeCoreset(),
+	     lfunc_frequency
+	     );
+	  break;
+
+	case INPARAM_CORESET_SAMPLING:
+	  lvectorptinst_coreset =
+	    coreset::dedup<DATATYPE_FEATURE,DATATYPE_INSTANCE_FREQUENCY>
+	    (lpairvec_dataset.first.begin(),
+	     lpairvec_dataset.first.end(),
+	     lfunc_frequency
+	     );
+	  if ( lvectorptinst_coreset.size() > linparam_ClusteringGA.getSizeCoreset() ) {
+	    std::vector<data::Instance<DATATYPE_FEATURE>* > lvectorptinst_dedup;
+	    lvectorptinst_dedup.swap(lvectorptinst_coreset);
+	    lvectorptinst_coreset =
+	      coreset::sampling<DATATYPE_FEATURE,DATATYPE_INSTANCE_FREQUENCY,DATATYPE_REAL>
+	      (lvectorptinst_dedup.begin(),
+	       lvectorptinst_dedup.end(),
+	       linparam_ClusteringGA.getSizeCoreset(),
+	       (uintidx) std::sqrt(double(linparam_ClusteringGA.getSizeCoreset())),
+	       lfunc_frequency
+	       );
+	    for ( auto  liter_instance: lvectorptinst_dedup ) 
+	      delete liter_instance;
+	  }
+	  break;
+
+	default:
+	  throw  std::invalid_argument("main_gas_clustering: undefined coreset");
+	  break;
+	}
+      }
+
+      if ( lvectorptinst_coreset.size() > 0 ) {
+	lpairvec_dataset.first.swap(lvectorptinst_coreset);
+	linparam_ClusteringGA.setNumInstances
+	  ((uintidx) lpairvec_dataset.first.size());
+      }
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+
 #ifdef ALG_GACLUSTERING_FKCRISPMATRIX_BEZDEK_ETAL_1994
 
       gaencode::ChromosomeCrispMatrix
@@ -1746,11 +1872,32 @@ int main(int argc, char **argv)
 	 data::Instance<DATATYPE_FEATURE>::getNumDimensions(),
 	 lchrom_best.getCodeBook().toArray()
 	 );
+
+      DATATYPE_CLUSTERIDX *lpcidx_memberShip =
+	lchrom_best.getPartition().getMembersShip();
+
+      if ( lvectorptinst_coreset.size() > 0 ) {
+	/*ASSIGN THE LABELS TO THE FULL DATA SET IN ONE PASS
+	 */
+	lpairvec_dataset.first.swap(lvectorptinst_coreset);
+	linparam_ClusteringGA.setNumInstances
+	  ((uintidx) lpairvec_dataset.first.size());
+	lvectorcidx_memberShipFull.assign
+	  (lpairvec_dataset.first.size(),DATATYPE_CLUSTERIDX(-1));
+	clusteringop::reassignCluster
+	  (lvectorcidx_memberShipFull.data(),
+	   lomatrixrowt_centroids,
+	   lpairvec_dataset.first.begin(),
+	   lpairvec_dataset.first.end(),
+	   *pfunct2p_distAlg
+	   );
+	lpcidx_memberShip = lvectorcidx_memberShipFull.data();
+      }
       
       partition::PartitionLabel
 	<DATATYPE_CLUSTERIDX>
 	lpartition_clusters
-	(lchrom_best.getPartition().getMembersShip(),
+	(lpcidx_memberShip,
 	 (uintidx) lpairvec_dataset.first.size(),
 	 linparam_ClusteringGA.getNumClusterK()
 	 );
@@ -1905,12 +2052,20 @@ int main(int argc, char **argv)
 #ifdef ALG_GAS_FKCENTROID_MAULIK_BANDYOPADHYAY_2000
 
       gaencode::ChromFixedLength<DATATYPE_FEATURE,DATATYPE_REAL>&& lchrom_best = 
-	eac::gas_fkcentroid
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::gas_fkcentroid
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 }
 	 );
  	
       mat::MatrixRow<DATATYPE_FEATURE> lomatrixrowt_centroids
@@ -1935,12 +2090,20 @@ int main(int argc, char **argv)
        */
 #ifdef ALG_KGA_FKCENTROID_BANDYOPADHYAY_MAULIK_2002 
       gaencode::ChromFixedLength<DATATYPE_FEATURE,DATATYPE_REAL>&& lchrom_best = 
-	eac::kga_fkcentroid
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::kga_fkcentroid
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 }
 	 );
  	
       mat::MatrixRow<DATATYPE_FEATURE> lomatrixrowt_centroids
@@ -2024,12 +2187,21 @@ int main(int argc, char **argv)
 #endif /*__FITNESS_RAND_INDEX__*/      
 
       auto lchrom_best =
-	eac::feca_vklabel
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::feca_vklabel
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 },
+	 gaisland::ObjetiveFuncResult()
 	 );
       
       mat::MatrixRow<DATATYPE_FEATURE>&&
@@ -2161,12 +2333,20 @@ int main(int argc, char **argv)
 
      gaencode::ChromVariableLength<DATATYPE_FEATURE,DATATYPE_REAL>
 	lchrom_best =
-	eac::vga_vkcentroid
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::vga_vkcentroid
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 }
 	 );
 
      mat::MatrixRow<DATATYPE_FEATURE> lomatrixrowt_centroids
@@ -2191,12 +2371,20 @@ int main(int argc, char **argv)
 
       mat::MatrixRow<DATATYPE_FEATURE> 
 	lomatrixrowt_centroids =
-	eac::gcuk_vkcentroid
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::gcuk_vkcentroid
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 }
 	 );
       mat::MatrixRow<DATATYPE_FEATURE>&  lchrom_best = lomatrixrowt_centroids;
     
@@ -2213,12 +2401,21 @@ int main(int argc, char **argv)
 #ifdef __ALG_GASGO_2023__
       
       auto lchrom_best =
-	eac::gasgo_vkcentroid
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::gasgo_vkcentroid
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 },
+	 gaisland::ObjetiveFuncResult()
 	 );
 
       mat::MatrixRow<DATATYPE_FEATURE> lomatrixrowt_centroids
@@ -2227,11 +2424,32 @@ int main(int argc, char **argv)
 	 lchrom_best.getCodeBook().toArray()
 	 );
 
+      DATATYPE_CLUSTERIDX *lpcidx_memberShip =
+	lchrom_best.getPartition().getMembersShip();
+
+      if ( lvectorptinst_coreset.size() > 0 ) {
+	/*ASSIGN THE LABELS TO THE FULL DATA SET IN ONE PASS
+	 */
+	lpairvec_dataset.first.swap(lvectorptinst_coreset);
+	linparam_ClusteringGA.setNumInstances
+	  ((uintidx) lpairvec_dataset.first.size());
+	lvectorcidx_memberShipFull.assign
+	  (lpairvec_dataset.first.size(),DATATYPE_CLUSTERIDX(-1));
+	clusteringop::reassignCluster
+	  (lvectorcidx_memberShipFull.data(),
+	   lomatrixrowt_centroids,
+	   lpairvec_dataset.first.begin(),
+	   lpairvec_dataset.first.end(),
+	   *pfunct2p_distAlg
+	   );
+	lpcidx_memberShip = lvectorcidx_memberShipFull.data();
+      }
+
 
       partition::PartitionLabel
 	<DATATYPE_CLUSTERIDX>
 	lpartition_clusters
-	(lchrom_best.getPartition().getMembersShip(),
+	(lpcidx_memberShip,
 	 (uintidx) lpairvec_dataset.first.size(),
 	 DATATYPE_CLUSTERIDX(lomatrixrowt_centroids.getNumRows())
 	 );
@@ -2325,12 +2543,20 @@ int main(int argc, char **argv)
 #ifdef  ALG_GAGR_FKCENTROID_CHANG_ETAL_2009
 
       gaencode::ChromFixedLength<DATATYPE_FEATURE,DATATYPE_REAL>&& lchrom_best = 
-	eac::gagr_fkcentroid 
+	gaisland::runIslands
 	(loop_outParamGAC,
 	 linparam_ClusteringGA,
-	 lpairvec_dataset.first.begin(),
-	 lpairvec_dataset.first.end(),
-	 *pfunct2p_distAlg
+	 [&](decltype(loop_outParamGAC)&      aoop_outParamIsland,
+	     decltype(linparam_ClusteringGA)& aiinp_inParamIsland)
+	 {
+	   return eac::gagr_fkcentroid
+	     (aoop_outParamIsland,
+	      aiinp_inParamIsland,
+	      lpairvec_dataset.first.begin(),
+	      lpairvec_dataset.first.end(),
+	      *pfunct2p_distAlg
+	      );
+	 }
 	 );      
 
       mat::MatrixRow<DATATYPE_FEATURE> lomatrixrowt_centroids
@@ -2868,48 +3094,62 @@ int main(int argc, char **argv)
        */
     
       { /*BEGIN PRINT PARAMETERS*/
+
+	/*ONE PASS OVER THE INSTANCES FOR THE MEASURES BASED ON CENTROIDS
+	 */
+	um::ReportCentroids
+	  <DATATYPE_FEATURE,DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+	  lreport_centroids
+	  (lomatrixrowt_centroids,
+	   lpairvec_dataset.first.begin(),
+	   lpairvec_dataset.first.end(),
+	   lpartition_clusters,
+	   *pfunct2p_distEuclidean,
+	   *pfunct2p_distEuclideanSq
+	   );
        
+#ifndef __INSTANCES_MMAP
+	partition::PartitionLabelVector<DATATYPE_CLUSTERIDX>
+	  lpartlabelvector_clusters
+	  (lreport_centroids.getMemberShip(),
+	   DATATYPE_CLUSTERIDX(lomatrixrowt_centroids.getNumRows())
+	   );
+	
 	ds::PartitionLinkedNumInst
 	  <DATATYPE_CLUSTERIDX,DATATYPE_INSTANCES_CLUSTER_K>&&
 	  lpartlinknuminst_memberShip =
 	  ds::getPartitionLinkedNumInst
 	  (lpairvec_dataset.first.begin(),
 	   lpairvec_dataset.first.end(),
-	   lpartition_clusters,
+	   lpartlabelvector_clusters,
 	   [&](data::Instance<DATATYPE_FEATURE>* liter_inst)
 	   {
 	     return DATATYPE_INSTANCES_CLUSTER_K(1);
 	   }
 	   );
+#else
+	std::vector<DATATYPE_INSTANCES_CLUSTER_K>&& lvectort_numInstClusterKMmap =
+	  lmatchmatrix_confusion.getInstClusterK();
+	const bool lb_haveNullCluster =
+	  std::count
+	  (lvectort_numInstClusterKMmap.begin(),
+	   lvectort_numInstClusterKMmap.end(),
+	   DATATYPE_INSTANCES_CLUSTER_K(0)
+	   ) > 0;
+#endif /*__INSTANCES_MMAP*/
 	
 	/* SED (0)
 	   */
-	  std::pair<DATATYPE_REAL,bool> lpair_sed =
-	    um::SSE
-	    (lomatrixrowt_centroids,
-	     lpairvec_dataset.first.begin(),
-	     lpairvec_dataset.first.end(),
-	     *pfunct2p_distEuclidean
-	     );
-	    
 	  loop_outParamlusteringMetric.setMetricFunc
 	    (inout::SED,
-	     lpair_sed.first
+	     lreport_centroids.getSED()
 	     );
 
 	/* SSE (1)
 	   */
-	  std::pair<DATATYPE_REAL,bool> lpair_sse =
-	     um::SSE
-	    (lomatrixrowt_centroids,
-	     lpairvec_dataset.first.begin(),
-	     lpairvec_dataset.first.end(),
-	     *pfunct2p_distEuclideanSq
-	     );
-
 	  loop_outParamlusteringMetric.setMetricFunc
 	    (inout::SSE,
-	     lpair_sse.first
+	     lreport_centroids.getSSE()
 	     );
 
 	  /* Distortion (2)
@@ -2918,7 +3158,7 @@ int main(int argc, char **argv)
 	    (inout::Distortion,
 	     (lmatchmatrix_confusion.getNumObjetos()  * 
 	      data::Instance<DATATYPE_FEATURE>::getNumDimensions() != 0)? 
-	      lpair_sse.first / 
+	      lreport_centroids.getSSE() / 
 	     ((DATATYPE_REAL) lmatchmatrix_confusion.getNumObjetos() * 
 	      (DATATYPE_REAL) data::Instance<DATATYPE_FEATURE>::getNumDimensions())
 	     :measuare_undefSSE(DATATYPE_REAL)
@@ -2928,7 +3168,7 @@ int main(int argc, char **argv)
 	   */
 	   loop_outParamlusteringMetric.setMetricFunc
 	    (inout::J1,
-	     lpair_sse.first
+	     lreport_centroids.getSSE()
 	     );
 	
 	/*
@@ -2944,6 +3184,10 @@ int main(int argc, char **argv)
 	  );
 	*/
 
+#ifndef __INSTANCES_MMAP
+	/*THE MEASURES THAT NEED ALL THE PARTITION IN MEMORY
+	  ARE NOT COMPUTED FOR A MAPPED DATA SET
+	 */
 	/*CS measure (5) OK
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
@@ -2955,28 +3199,33 @@ int main(int argc, char **argv)
 	    *pfunct2p_distEuclidean
 	    )
 	   );
+#endif /*__INSTANCES_MMAP*/
+
+	/*THE MEASURES O(n^2) ARE COMPUTED BY TILES, OR WITH A SAMPLE
+	 */
+	um::ReportPairwise
+	  <DATATYPE_FEATURE,DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+	  lreport_pairwise
+	  (lpairvec_dataset.first.begin(),
+	   lpairvec_dataset.first.end(),
+	   lreport_centroids.getMemberShip(),
+	   DATATYPE_CLUSTERIDX(lomatrixrowt_centroids.getNumRows()),
+	   *pfunct2p_distEuclidean,
+	   linparam_ClusteringGA.getSizeSamplePairwise()
+	   );
 
 	/*DunnIndex (6) OK
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::DunnIndex,
-	   um::DunnIndex
-	   (lpairvec_dataset.first.begin(),
-	    lpartlinknuminst_memberShip,
-	    *pfunct2p_distEuclidean
-	    )
+	   lreport_pairwise.DunnIndex()
 	   );
 	
 	/*SDunnIndex (7)
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::SDunnIndex,
-	   um::simplifiedDunnIndex
-	   (lomatrixrowt_centroids,
-	    lpairvec_dataset.first.begin(),
-	    lpartlinknuminst_memberShip,
-	    *pfunct2p_distEuclidean
-	    )
+	   lreport_centroids.simplifiedDunnIndex()
            );
 	/*	
 #ifdef __VERBOSE_YES
@@ -2988,12 +3237,13 @@ int main(int argc, char **argv)
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::Silhouette,
-	   um::silhouette
-	   (lpairvec_dataset.first.begin(),
-	    lpartlinknuminst_memberShip,
-	    *pfunct2p_distEuclidean
-	    )
+	   lreport_pairwise.silhouette()
 	   );
+	if ( lreport_pairwise.isSample() ) 
+	  loop_outParamlusteringMetric.setSilhouetteBounds
+	    (lreport_pairwise.getSilhouetteLower(),
+	     lreport_pairwise.getSilhouetteUpper()
+	     );
 	
 	/*
 #ifdef __VERBOSE_YES
@@ -3021,14 +3271,7 @@ int main(int argc, char **argv)
 	  lmatchmatrix_confusion.getInstClusterK();
 
 	  std::vector<DATATYPE_REAL>&&  lvectort_partialSilhouette =
-	    um::simplifiedSilhouette
-	    (lomatrixrowt_centroids,
-	     lpairvec_dataset.first.begin(),
-	     lpairvec_dataset.first.end(),
-	     lpartition_clusters,
-	     lvectort_numInstClusterK,
-	     *pfunct2p_distEuclidean
-	     );
+	    lreport_centroids.simplifiedSilhouette(lvectort_numInstClusterK);
 
 	  DATATYPE_REAL lmetrict_sumPartialSilhouette = 
 	    interfacesse::sum
@@ -3048,40 +3291,21 @@ int main(int argc, char **argv)
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::DBindex,
-	   um::dbindex
-	   (lomatrixrowt_centroids,
-	    lpairvec_dataset.first.begin(),
-	    lpairvec_dataset.first.end(),
-	    lpartition_clusters,
-	    *pfunct2p_distEuclidean
-	    )
+	   lreport_centroids.dbindex()
 	   );
 
 	/*Variance Ratio Criterion (11) OK
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::VRC,
-	   um::VRC
-	   (lomatrixrowt_centroids,
-            lpairvec_dataset.first.begin(),
-	    lpairvec_dataset.first.end(),   
-	    lpartition_clusters,
-	    *pfunct2p_distEuclideanSq,
-	    true
-	    )
+	   lreport_centroids.VRC(true)
 	   );  
 
 	/*WB-index (12)*/
 
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::WBIndex,
-	   um::WBIndex
-	   (lomatrixrowt_centroids,
-            lpairvec_dataset.first.begin(),
-	    lpairvec_dataset.first.end(),   
-	    lpartition_clusters,
-	    *pfunct2p_distEuclideanSq
-	    )
+	   lreport_centroids.WBIndex()
 	   );
 
 	/*SSB (13)*/
@@ -3107,13 +3331,7 @@ int main(int argc, char **argv)
 	*/
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::ScoreFunction, 
-	   um::scoreFunction
-	   (lomatrixrowt_centroids,
-            lpairvec_dataset.first.begin(),
-	    lpairvec_dataset.first.end(),   
-	    lpartition_clusters,
-	    *pfunct2p_distEuclidean
-	    )
+	   lreport_centroids.scoreFunction()
 	   );
 	
 	/*Rand Index (15): 
@@ -3226,6 +3444,7 @@ int main(int argc, char **argv)
 	   );
 	
 
+#ifndef __INSTANCES_MMAP
 	/* Fuzzy measures 26-29
 	 */
 	mat::MatrixRow<DATATYPE_REAL>&& lmatrixt_u =
@@ -3252,19 +3471,16 @@ int main(int argc, char **argv)
 	   );
 
 
+#endif /*__INSTANCES_MMAP*/
+
 	/*INDEX I (27) OK
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::IndexI,
-	   um::indexI
-	   (lomatrixrowt_centroids,
-	    lpairvec_dataset.first.begin(),
-	    lpairvec_dataset.first.end(),
-	    lpartition_clusters,
-	    *pfunct2p_distEuclidean
-	    )
+	   lreport_centroids.indexI()
 	   );
 
+#ifndef __INSTANCES_MMAP
 	/*INDEX I (26) OK
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
@@ -3291,18 +3507,15 @@ int main(int argc, char **argv)
 	    )
 	   );
 
+#endif /*__INSTANCES_MMAP*/
+
 	loop_outParamlusteringMetric.setMetricFunc
 	  (inout::XieBeniIndex_crisp,
-	   um::xb
-	   (lomatrixrowt_centroids,
-	    lpairvec_dataset.first.begin(),
-	    lpairvec_dataset.first.end(),
-	    lpartition_clusters,
-	    *pfunct2p_distEuclideanSq
-	    )
+	   lreport_centroids.xb()
 	   );
 
 
+#ifndef __INSTANCES_MMAP
 	/*Entropy (28)
 	 */
 	loop_outParamlusteringMetric.setMetricFunc
@@ -3326,19 +3539,38 @@ int main(int argc, char **argv)
 	    lpairvec_dataset.first.begin(),
 	    lpairvec_dataset.first.end(),
 	    lpartlinknuminst_memberShip,
+	    lreport_centroids.getRadiusClusterK(),
 	    *pfunct2p_distEuclidean
 	    )
 	   );
+#endif /*__INSTANCES_MMAP*/
     
 	if ( linparam_ClusteringGA.getNumFilesInstanceTest() > 0 ) {
 
+	  um::ReportCentroids
+	    <DATATYPE_FEATURE,DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+	    lreport_centroidsTest
+	    (lomatrixrowt_centroids,
+	     lpairvec_dataset.second.begin(),
+	     lpairvec_dataset.second.end(),
+	     lpartition_clustersTest,
+	     *pfunct2p_distEuclidean,
+	     *pfunct2p_distEuclideanSq
+	     );
+
+	  partition::PartitionLabelVector<DATATYPE_CLUSTERIDX>
+	    lpartlabelvector_clustersTest
+	    (lreport_centroidsTest.getMemberShip(),
+	     DATATYPE_CLUSTERIDX(lomatrixrowt_centroids.getNumRows())
+	     );
+
 	  ds::PartitionLinkedNumInst
 	    <DATATYPE_CLUSTERIDX,DATATYPE_INSTANCES_CLUSTER_K>&&
 	    lpartlinknuminst_memberShipTest =
 	    ds::getPartitionLinkedNumInst
 	    (lpairvec_dataset.second.begin(),
 	     lpairvec_dataset.second.end(),
-	     lpartition_clustersTest,
+	     lpartlabelvector_clustersTest,
 	     [&](data::Instance<DATATYPE_FEATURE>* liter_inst)
 	     {
 	       return DATATYPE_INSTANCES_CLUSTER_K(1);
@@ -3348,30 +3580,16 @@ int main(int argc, char **argv)
 
 	  /* SED (0)
 	   */
-	  std::pair<DATATYPE_REAL,bool> lpair_sedTest =
-	    um::SSE
-	    (lomatrixrowt_centroids,
-	     lpairvec_dataset.second.begin(),
-	     lpairvec_dataset.second.end(),
-	     *pfunct2p_distEuclidean
-	     );
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::SED,
-	     lpair_sedTest.first
+	     lreport_centroidsTest.getSED()
 	     );
 
 	  /* SSE (1)
 	   */
-	  std::pair<DATATYPE_REAL,bool> lpair_sseTest =
-	    um::SSE
-	    (lomatrixrowt_centroids,
-	     lpairvec_dataset.second.begin(),
-	     lpairvec_dataset.second.end(),
-	     *pfunct2p_distEuclideanSq
-	     );
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::SSE,
-	     lpair_sseTest.first
+	     lreport_centroidsTest.getSSE()
 	     );
 
 	  /* Distortion (2)
@@ -3379,7 +3597,7 @@ int main(int argc, char **argv)
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::Distortion,
 	     (lmatchmatrix_confusionTest.getNumObjetos()  * data::Instance<DATATYPE_FEATURE>::getNumDimensions() != 0)? 
-	      lpair_sseTest.first / 
+	      lreport_centroidsTest.getSSE() / 
 	     ((DATATYPE_REAL) lmatchmatrix_confusionTest.getNumObjetos()* 
 	      (DATATYPE_REAL) data::Instance<DATATYPE_FEATURE>::getNumDimensions())
 	     :measuare_undefSSE(DATATYPE_REAL)
@@ -3389,7 +3607,7 @@ int main(int argc, char **argv)
 	   */
 	   loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::J1,
-	     lpair_sseTest.first
+	     lreport_centroidsTest.getSSE()
 	     );
 
 	  /*CS measure (5) OK
@@ -3406,39 +3624,40 @@ int main(int argc, char **argv)
 
 	  /*DunnIndex (6) OK
 	   */
+	  um::ReportPairwise
+	    <DATATYPE_FEATURE,DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+	    lreport_pairwiseTest
+	    (lpairvec_dataset.second.begin(),
+	     lpairvec_dataset.second.end(),
+	     lreport_centroidsTest.getMemberShip(),
+	     DATATYPE_CLUSTERIDX(lomatrixrowt_centroids.getNumRows()),
+	     *pfunct2p_distEuclidean,
+	     linparam_ClusteringGA.getSizeSamplePairwise()
+	     );
+
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::DunnIndex,
-	     um::DunnIndex
-	     (lpairvec_dataset.second.begin(),
-	      lpartlinknuminst_memberShipTest,
-	      *pfunct2p_distEuclidean,
-	      true
-	      )
+	     lreport_pairwiseTest.DunnIndex(true)
 	     );
 	  
 	  /*SDunnIndex (7)
 	   */
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::SDunnIndex,
-	     um::simplifiedDunnIndex
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpartlinknuminst_memberShipTest,
-	      *pfunct2p_distEuclidean,
-	      true
-	      )
+	     lreport_centroidsTest.simplifiedDunnIndex(true)
 	     );
 	 
 	  /*Silhouette (8) OK
 	   */  
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::Silhouette,
-	     um::silhouette
-	     (lpairvec_dataset.second.begin(),
-	      lpartlinknuminst_memberShipTest,
-	      *pfunct2p_distEuclidean
-	      )
+	     lreport_pairwiseTest.silhouette()
 	     );
+	  if ( lreport_pairwiseTest.isSample() ) 
+	    loop_outParamlusteringMetric.setSilhouetteBoundsTest
+	      (lreport_pairwiseTest.getSilhouetteLower(),
+	       lreport_pairwiseTest.getSilhouetteUpper()
+	       );
 	  
 	  {/*SSilhouette (9) OK
 	    */
@@ -3446,14 +3665,7 @@ int main(int argc, char **argv)
 	      lmatchmatrix_confusionTest.getInstClusterK();
 
 	    std::vector<DATATYPE_REAL>&&  lvectort_partialSilhouetteTest =
-	      um::simplifiedSilhouette
-	      (lomatrixrowt_centroids,
-	       lpairvec_dataset.second.begin(),
-	       lpairvec_dataset.second.end(),
-	       lpartition_clustersTest,
-	       lvectort_numInstClusterKTest,
-	       *pfunct2p_distEuclidean
-	       );
+	      lreport_centroidsTest.simplifiedSilhouette(lvectort_numInstClusterKTest);
 
 	    DATATYPE_REAL lmetrict_partialSilhouetteTest = 
 	      interfacesse::sum
@@ -3473,26 +3685,20 @@ int main(int argc, char **argv)
 	   */
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::DBindex,
-	     um::dbindex
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpairvec_dataset.second.end(),
-	      lpartition_clustersTest,
-	      *pfunct2p_distEuclidean
-	      )
+	     lreport_centroidsTest.dbindex()
 	     );
 
 	  /*Variance Ratio Criterion (11) OK
 	   */
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::VRC,
-	     um::VRCreeval
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpairvec_dataset.second.end(),   
-	      lpartition_clustersTest,
-	      *pfunct2p_distEuclideanSq,
+	     lreport_centroidsTest.VRC
+	     (
+#ifdef __INSTANCES_MMAP
+	      true && !lb_haveNullCluster
+#else
 	      true && !lpartlinknuminst_memberShip.haveNullCluster()
+#endif /*__INSTANCES_MMAP*/
 	      )
 	     );
 
@@ -3500,13 +3706,7 @@ int main(int argc, char **argv)
 	   */
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::WBIndex,
-	     um::WBIndexreeval
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpairvec_dataset.second.end(),  
-	      lpartition_clustersTest,
-	      *pfunct2p_distEuclideanSq
-	      )
+	     lreport_centroidsTest.WBIndex()
 	     );
 
 	  /*SSB (13)*/
@@ -3516,10 +3716,9 @@ int main(int argc, char **argv)
 
 	    loop_outParamlusteringMetric.setMetricFuncTest
 	      (inout::SSB,
-	       um::ssbreeval
+	       um::ssb
 	       (lomatrixrowt_centroids,
-		lpairvec_dataset.second.begin(),
-		lpairvec_dataset.second.end(),
+		lreport_centroidsTest.getMeanInstances().data(),
 		lvectort_numInstClusterKTest,
 		*pfunct2p_distEuclideanSq
 		)
@@ -3534,13 +3733,7 @@ int main(int argc, char **argv)
 	  */
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::ScoreFunction,
-	     um::scoreFunctionreeval
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpairvec_dataset.second.end(),   
-	      lpartition_clustersTest,
-	      *pfunct2p_distEuclidean
-	      )
+	     lreport_centroidsTest.scoreFunction()
 	     );
 
 	  /*Rand Index (15) OK
@@ -3678,13 +3871,7 @@ int main(int argc, char **argv)
 	   */
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::IndexI,
-	     um::indexIreeval
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpairvec_dataset.second.end(),
-	      lpartition_clustersTest,
-	      *pfunct2p_distEuclidean
-	      ) 
+	     lreport_centroidsTest.indexI() 
 	     );
 
 	   loop_outParamlusteringMetric.setMetricFuncTest
@@ -3713,13 +3900,7 @@ int main(int argc, char **argv)
 
 	  loop_outParamlusteringMetric.setMetricFuncTest
 	    (inout::XieBeniIndex_crisp,
-	     um::xb
-	     (lomatrixrowt_centroids,
-	      lpairvec_dataset.second.begin(),
-	      lpairvec_dataset.second.end(),
-	      lpartition_clustersTest,
-	      *pfunct2p_distEuclideanSq
-	      )
+	     lreport_centroidsTest.xb()
 	     );
 	  
 	  /*Entropy (28)
@@ -3745,6 +3926,7 @@ int main(int argc, char **argv)
 	      lpairvec_dataset.second.begin(),
 	      lpairvec_dataset.second.end(),
 	      lpartlinknuminst_memberShipTest,
+	      lreport_centroidsTest.getRadiusClusterK(),
 	      *pfunct2p_distEuclidean
 	      )
 	     );
@@ -4532,12 +4714,19 @@ int main(int argc, char **argv)
     delete [] larray_meanFeactures;
     delete [] larray_desvstdFeactures;
     
+#ifndef __INSTANCES_MMAP
     for ( auto  liter_instance: lpairvec_dataset.first ) 
       delete liter_instance;
+#endif /*__INSTANCES_MMAP*/
 
     for ( auto  liter_instanceTest: lpairvec_dataset.second ) 
       delete liter_instanceTest;
 
+#ifdef __INSTANCES_WITH_FREQUENCY
+    for ( auto  liter_instance: lvectorptinst_coreset ) 
+      delete liter_instance;
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+
     delete pfunct2p_distAlg;
     delete pfunct2p_distEuclidean;
     delete pfunct2p_distEuclideanSq;
@@ -4555,5 +4744,12 @@ int main(int argc, char **argv)
     
   return 0;
  
+} /*END mainClustering*/
+
+
+/*---< main() >-------------------------------------------------------------*/
+int main(int argc, char **argv) 
+{
+  return clusteringworker::runMain(argc, argv, mainClustering);
 } /*END MAIN*/
 
@@ -29,6 +29,7 @@
 #include "linear_algebra_level1.hpp"
 #include "linear_algebra_level2.hpp"
 
+#include "clustering_model.hpp"
 #include "inparam_stdvar.hpp"
 #include "inparamclustering_getparameter.hpp"
 
@@ -319,6 +320,14 @@ int main(int argc, char **argv)
 	 );
       break;
     case STD_VAR_Z6:
+
+      stats::sumFeactures
+	(larray_sumFeature,
+	 lvectorptinst_instances.begin(),
+	 lvectorptinst_instances.end(),
+	 DATATYPE_FEATURE(0)
+	 );
+
        std::for_each
 	(lvectorptinst_instances.begin(),
 	 lvectorptinst_instances.end(),
@@ -379,6 +388,65 @@ int main(int argc, char **argv)
     }
   }
 
+  /*PARAMETERS OF THE STANDARDIZATION, TO STANDARDIZE OTHER INSTANCES
+    WITH THE SAME VALUES, see assign_clustering
+   */
+  if ( lvectorptinst_instances.size() > 0
+       && !listdvar_inParam.getOutFileStdVar().empty() ) {
+
+    const uintidx lui_numDimensions =
+      data::Instance<DATATYPE_FEATURE>::getNumDimensions();
+    std::vector<DATATYPE_FEATURE> lvectort_location(lui_numDimensions,DATATYPE_FEATURE(0));
+    std::vector<DATATYPE_FEATURE> lvectort_scale(lui_numDimensions,DATATYPE_FEATURE(1));
+
+    for (uintidx lui_i = 0; lui_i < lui_numDimensions; lui_i++) {
+      switch ( listdvar_inParam.getStandardizationVar() ) {
+      case STD_VAR_Z0:
+	break;
+      case STD_VAR_Z1:
+	lvectort_location[lui_i] = larray_meanFeactures[lui_i];
+	lvectort_scale[lui_i]    = larray_desvstdFeactures[lui_i];
+	break;
+      case STD_VAR_Z2:
+	lvectort_scale[lui_i]    = larray_desvstdFeactures[lui_i];
+	break;
+      case STD_VAR_Z3:
+	lvectort_scale[lui_i]    = larray_maxFeactures[lui_i];
+	break;
+      case STD_VAR_Z4:
+	lvectort_scale[lui_i]    = larray_maxFeactures[lui_i] - larray_minFeactures[lui_i];
+	break;
+      case STD_VAR_Z5:
+	lvectort_location[lui_i] = larray_minFeactures[lui_i];
+	lvectort_scale[lui_i]    = larray_maxFeactures[lui_i] - larray_minFeactures[lui_i];
+	break;
+      case STD_VAR_Z6:
+	lvectort_scale[lui_i]    = larray_sumFeature[lui_i];
+	break;
+      default:
+	throw std::invalid_argument
+	  ("main_stdvar_milligan_cooper1988: the ranks Z7 can not be applied to other instances");
+	break;
+      }
+    }
+
+    const char  *las_optStandardizationVar[] = STD_VAR_NAME;
+    std::ofstream lofstream_stdVar(listdvar_inParam.getOutFileStdVar());
+    if ( !lofstream_stdVar ) {
+      throw std::invalid_argument
+	("main_stdvar_milligan_cooper1988: unable to open file: "
+	 + listdvar_inParam.getOutFileStdVar());
+    }
+    lofstream_stdVar.precision(COMMON_COUT_PRECISION);
+    inout::writeStdVar
+      (lofstream_stdVar,
+       las_optStandardizationVar[listdvar_inParam.getStandardizationVar()],
+       lvectort_location.data(),
+       lvectort_scale.data(),
+       lui_numDimensions
+       );
+  }
+
   delete [] larray_meanFeactures;
   delete [] larray_desvstdFeactures;
   delete [] larray_sumFeature;
@@ -31,6 +31,7 @@
 #include <cmath>
 #include <stdexcept>
 #include <map>
+#include <memory>
 
 #include <leac.hpp>
 #include "clustering_operator_hierarchical.hpp"
@@ -40,6 +41,13 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_checkpoint.hpp"
+
+/*THE STATE OF THE ALGORITHM CAN BE SAVED AND THE RUN RESUMED,
+  see ga_checkpoint.hpp
+ */
+#define __INPARAM_CHECKPOINT__
 
 
 /*! \namespace eac
@@ -70,10 +78,16 @@ __localVRC
 {
   const uintidx  lui_numInstances = uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
   
-  static T_FEATURE *larray_centroid1 =
-    new T_FEATURE[data::Instance<T_FEATURE>::getNumDimensions()];
+  /*THE CENTROID OF THE DATA SET IS COMPUTED ONCE BY PROBLEM
+   */
+  static const char lc_keyCentroid1 = 0;
+  T_FEATURE *larray_centroid1 =
+    data::ProblemContext::current().getCached<std::vector<T_FEATURE> >
+    (&lc_keyCentroid1,
+     [&]() {
+      std::vector<T_FEATURE> lovector_centroid1
+	(data::Instance<T_FEATURE>::getNumDimensions());
 
-  static utils::RunOnce runOnce ([&]() {
       decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
 	*larray_sumFeatureTmp =
 	new decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
@@ -87,14 +101,16 @@ __localVRC
 	 );
   
       stats::meanVector
-	(larray_centroid1,
+	(lovector_centroid1.data(),
 	 lui_numInstances,
 	 larray_sumFeatureTmp
 	 );
 
       delete [] larray_sumFeatureTmp;
+
+      return lovector_centroid1;
     }
-    );
+    ).data();
   
 #ifdef __VERBOSE_YES
   const char* lpc_labelFunc = "um::VRC";
@@ -170,100 +186,6 @@ __localVRC
 }
   
 
-/*! \fn auto tgca_getKSegments(const CONTAINER_ITERINST aiiterator_instfirst, const CONTAINER_ITERINST aiiterator_instlast, partition::PartitionDisjSets<T_CLUSTERIDX> &aipartitionDisjSets_clusters, FUNCTION_GETATTRIBUTE function_getAttribute)
-  \brief tgca_getKSegments \cite He:Tan:GAclusteringVarK:TGCA:2012
-  \details The attribute with maximum range is partitioned into ki segments by hierarchical agglomerative clustering algorithm. Then initial values of cluster centers are produced through uniformly random selection in every segment. 
-  \returns the coordinate of a centroid.
-  \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
-  \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
-  \param aipartitionDisjSets_clusters a partition::PartitionDisjSets of the attribute with maximum range maximum ki segments is partitioned into  by hierarchical agglomerative clustering algorithm.
-  \param function_getAttribute a function to obtain the attributes of an instance
-*/
-template < typename CONTAINER_ITERINST,
-	   typename T_CLUSTERIDX,
-	   typename FUNCTION_GETATTRIBUTE
-	   >
-auto
-tgca_getKSegments
-(const CONTAINER_ITERINST       aiiterator_instfirst,
- const CONTAINER_ITERINST       aiiterator_instlast,
- partition::PartitionDisjSets   
- <T_CLUSTERIDX>                 &aipartitionDisjSets_clusters,
- FUNCTION_GETATTRIBUTE          function_getAttribute
- ) -> mat::MatrixRow<decltype(function_getAttribute(*aiiterator_instfirst))>
-{
-#ifdef __VERBOSE_YES
-  const char* lpc_labelFunc = "tgca_getKSegments";
-  ++geiinparam_verbose;
-  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-    std::cout << lpc_labelFunc 
-              << ":  IN(" << geiinparam_verbose << ")\n"
-	      << "(input  aiiterator_instfirst[" <<  *aiiterator_instfirst << "]\n"
-	      << " input  aiiterator_instlast[" <<  *aiiterator_instlast << "]\n"
-	      << " input aipartitionDisjSets_clusters[" << &aipartitionDisjSets_clusters << "]\n"
-	      << ')'
-	      << std::endl;
-  }
-#endif //__VERBOSE_YES
-
-  typedef decltype(function_getAttribute(*aiiterator_instfirst)) ResultType;
-  
-  uintidx lui_slinkK =
-    uintidx(aipartitionDisjSets_clusters.getNumCluster());
-	
-  mat::MatrixRow<ResultType> 
-    lomatrixrowt_newMinMaxKSegments
-    (lui_slinkK,
-     uintidx(2)
-     );
-
-  /*CALCULATE  KSEGMENTS
-   */ 
-  for (uintidx lui_iRow = 0;
-       lui_iRow < lomatrixrowt_newMinMaxKSegments.getNumRows();
-       lui_iRow++)
-    {
-      lomatrixrowt_newMinMaxKSegments(lui_iRow,0) = std::numeric_limits<ResultType>::max();
-      lomatrixrowt_newMinMaxKSegments(lui_iRow,1) = -std::numeric_limits<ResultType>::max();
-    }
-
-  uintidx lui_idxInst = 0;
-  for  (auto linst_iter = aiiterator_instfirst;
-	linst_iter != aiiterator_instlast;
-	linst_iter++)
-    {
-      const ResultType lt_valueDim = function_getAttribute(*linst_iter); 
-      if (lomatrixrowt_newMinMaxKSegments
-	  (aipartitionDisjSets_clusters.getClusterIdx(lui_idxInst),0) > lt_valueDim) {
-	lomatrixrowt_newMinMaxKSegments(aipartitionDisjSets_clusters.getClusterIdx(lui_idxInst),0)
-	  = lt_valueDim; 
-      }
-      if (lomatrixrowt_newMinMaxKSegments
-	  (aipartitionDisjSets_clusters.getClusterIdx(lui_idxInst),1) < lt_valueDim) {
-	lomatrixrowt_newMinMaxKSegments(aipartitionDisjSets_clusters.getClusterIdx(lui_idxInst),1)
-	  = lt_valueDim; 
-      }
-      ++lui_idxInst;
-    }
-	
-#ifdef __VERBOSE_YES
-  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
-    std::cout << lpc_labelFunc
-	      << ": OUT(" << geiinparam_verbose << ")\n";
-    std::ostringstream lostrstream_labelKiSegments;
-    lostrstream_labelKiSegments << "<KISEGMENTS:" << lpc_labelFunc;
-    lomatrixrowt_newMinMaxKSegments.print
-      (std::cout,lostrstream_labelKiSegments.str().c_str(),',',';');
-    
-    std::cout << std::endl;
-  }
-  --geiinparam_verbose;
-#endif //__VERBOSE_YES
-  
-  return lomatrixrowt_newMinMaxKSegments;
-} /* End */
-
-
 /*! \fn gaencode::ChromVariableLength<T_FEATURE,T_METRIC> tgca_vkcentroid(inout::OutParamGAC<T_METRIC,
  T_CLUSTERIDX> &aoop_outParamGAC,inout::InParamTGCA<T_CLUSTERIDX,T_METRIC,T_FEATURE,T_FEATURE_SUM,T_INSTANCES_CLUSTER_K> &aiinp_inParamTGCA, const INPUT_ITERATOR  aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const dist::Dist<T_METRIC,T_FEATURE>  &aifunc2p_dist)
   \brief TGCA \cite He:Tan:GAclusteringVarK:TGCA:2012
@@ -353,6 +275,12 @@ tgca_vkcentroid
     llfh_listFuntionHist
     (aiinp_inParamTGCA.getNumMaxGenerations(), "Iterations", "Clustering metrics");
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamTGCA.getNumMaxGenerations(),
+     aiinp_inParamTGCA
+     );
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -462,19 +390,9 @@ tgca_vkcentroid
 #ifndef __INITIALIZATION_RANDOM_SAMPLING__
   
   uintidx  lui_idxAttMaxRange;
-  uintidx* larrayiu_pi = NULL;
-  T_METRIC*  larrayrt_lambda = NULL;
 
-  std::vector<std::pair<uintidx,T_METRIC> > lvector_pairIdxLambda;
+  std::unique_ptr<clusteringop::SingleLinkSegments1D<T_FEATURE> > lpsegments1d_attMaxRange;
   std::map<T_CLUSTERIDX,mat::MatrixRow<T_FEATURE> > lmap_kSegments;
-  
-  try {
-    larrayiu_pi     = new uintidx[lui_numInstances];
-    larrayrt_lambda = new T_METRIC[lui_numInstances];
-  }
-  catch (std::bad_alloc& ba) {
-    std::cerr << "bad_alloc caught in alg_slink_sibson1973.hpp: " << ba.what() << '\n';
-  }
 
 #endif /*__INITIALIZATION RANDOM SAMPLING__*/
 
@@ -563,25 +481,19 @@ tgca_vkcentroid
 	}
       }
 
-    clusteringop::slink
-      (larrayiu_pi,
-       larrayrt_lambda,
-       aiiterator_instfirst,
-       aiiterator_instlast,
-       [&](const data::Instance<T_FEATURE>* aiinst_a, const data::Instance<T_FEATURE>* aiinst_b)
-       {
-	 return std::abs
-	   (aiinst_a->getAttribute(lui_idxAttMaxRange) -
-	    aiinst_b->getAttribute(lui_idxAttMaxRange)
-	    );
-       }
-       );
-
-    lvector_pairIdxLambda = 
-      clusteringop::sortLambda
-      (larrayiu_pi,
-       larrayrt_lambda,
-       lui_numInstances
+    /*THE SINGLE-LINK HIERARCHY OF ONE ATTRIBUTE IS GIVEN BY ITS
+      SORTED VALUES, THE SEGMENTS OF ANY Ki ARE BETWEEN THE Ki-1
+      LARGEST GAPS
+     */
+    lpsegments1d_attMaxRange.reset
+      (new clusteringop::SingleLinkSegments1D<T_FEATURE>
+       (aiiterator_instfirst,
+	aiiterator_instlast,
+	[&](const data::Instance<T_FEATURE>* aiinst_iter)
+	{
+	  return aiinst_iter->getAttribute(lui_idxAttMaxRange);
+	}
+	)
        );
 
     for (uintidx luintidx_i = 0; 
@@ -597,30 +509,11 @@ tgca_vkcentroid
 	
 	if ( !(lmapitem_kSegments != lmap_kSegments.end()) ) {
 
-	  partition::PartitionDisjSets<T_CLUSTERIDX>
-	    lpartitionDisjSets_clusters
-	    (clusteringop::pointerToDisjSets
-	     (lvector_pairIdxLambda,
-	      larrayiu_pi,
-	      (uintidx) lmmidx_krand 
-	      )
-	     );
-	   
-	  mat::MatrixRow<T_FEATURE>  
-	    lmatrixrowt_newMinMaxKSegments = 
-	    tgca_getKSegments
-	    (aiiterator_instfirst,
-	     aiiterator_instlast,
-	     lpartitionDisjSets_clusters,
-	     [&](const data::Instance<T_FEATURE>* aiinst_iter)
-	     {
-	       return aiinst_iter->getAttribute(lui_idxAttMaxRange);
-	     }
-	     );
-	  
-	  lmap_kSegments.emplace(lmmidx_krand,lmatrixrowt_newMinMaxKSegments);
-
-	  lmapitem_kSegments = lmap_kSegments.find(lmmidx_krand);	  
+	  lmapitem_kSegments =
+	    lmap_kSegments.emplace
+	    (lmmidx_krand,
+	     lpsegments1d_attMaxRange->getKSegments((uintidx) lmmidx_krand)
+	     ).first;
 	}
 	gaencode::ChromVariableLength<T_FEATURE,T_METRIC> *lchrom_new=
 	  gaclusteringop::newChromosome
@@ -648,8 +541,95 @@ tgca_vkcentroid
 
 
    llfh_listFuntionHist.increaseDomainUpperBound();
+
+  /*RESUME: THE INITIALIZATION IS REPLACED BY THE STATE OF THE CHECKPOINT,
+    IT WAS WRITTEN AT THE BEGINNING OF A GENERATION
+   */
+  if ( !aiinp_inParamTGCA.getFileNameResume().empty() ) {
+    gacheckpoint::Snapshot lsnapshot_resume;
+    lsnapshot_resume.load(aiinp_inParamTGCA.getFileNameResume());
+    if ( lsnapshot_resume.readHeader
+	 (aiinp_inParamTGCA.getAlgorithmoName(),
+	  aoop_outParamGAC.getNumRunningAlgorithm(),
+	  lui_numInstances,
+	  data::Instance<T_FEATURE>::getNumDimensions()
+	  )
+	 ) {
+      COMMON_IDOMAIN         lidomain_generation;
+      runtime::ExecutionTime let_elapsed;
+      uintidx                lui_generationsStagnant;
+      double                 ld_fitnessReference;
+      COMMON_IDOMAIN         lidomain_iterationGetsBest;
+      runtime::ExecutionTime let_runTimeGetsBest;
+      long                   ll_totalInvalidOffspring;
+      uintidx                lui_sizePopulation;
+
+      lsnapshot_resume.read(lidomain_generation);
+      lsnapshot_resume.read(let_elapsed);
+      lsnapshot_resume.readRandomEngine();
+      lsnapshot_resume.read(lui_generationsStagnant);
+      lsnapshot_resume.read(ld_fitnessReference);
+      lsnapshot_resume.read(lidomain_iterationGetsBest);
+      lsnapshot_resume.read(let_runTimeGetsBest);
+      lsnapshot_resume.read(ll_totalInvalidOffspring);
+      gacheckpoint::readChromosome(lsnapshot_resume,lochrom_best);
+      lsnapshot_resume.read(lui_sizePopulation);
+      
+      for (auto  liter_chrom: lvectorchrom_population)
+	delete liter_chrom;
+      lvectorchrom_population.clear();
+      for (uintidx lui_i = 0; lui_i < lui_sizePopulation; lui_i++) {
+	gaencode::ChromVariableLength<T_FEATURE,T_METRIC> *lchrom_read =
+	  new gaencode::ChromVariableLength<T_FEATURE,T_METRIC>();
+	gacheckpoint::readChromosome(lsnapshot_resume,*lchrom_read);
+	lvectorchrom_population.push_back(lchrom_read);
+      }
+
+      llfh_listFuntionHist.setDomainUpperBound(lidomain_generation);
+      let_executionTime -= let_elapsed;
+      lterminationcriteria.setStagnation
+	(lui_generationsStagnant,ld_fitnessReference);
+      aoop_outParamGAC.setIterationGetsBest(lidomain_iterationGetsBest);
+      aoop_outParamGAC.setRunTimeGetsBest(let_runTimeGetsBest);
+      aoop_outParamGAC.setTotalInvalidOffspring(ll_totalInvalidOffspring);
+    }
+  }
+
+  std::unique_ptr<gacheckpoint::CheckpointWriter> lptr_checkpointWriter;
+  if ( !aiinp_inParamTGCA.getFileNameCheckpoint().empty() )
+    lptr_checkpointWriter.reset
+      (new gacheckpoint::CheckpointWriter(aiinp_inParamTGCA.getFileNameCheckpoint()));
+  
   while ( 1 ) {
 
+    /*CHECKPOINT: THE STATE IS COPIED HERE, THE FILE IS WRITTEN IN
+      THE BACKGROUND
+     */
+    if ( lptr_checkpointWriter
+	 && llfh_listFuntionHist.getDomainUpperBound()
+	 % aiinp_inParamTGCA.getCheckpointInterval() == 0 ) {
+      gacheckpoint::Snapshot lsnapshot_checkpoint;
+      lsnapshot_checkpoint.writeHeader
+	(aiinp_inParamTGCA.getAlgorithmoName(),
+	 aoop_outParamGAC.getNumRunningAlgorithm(),
+	 lui_numInstances,
+	 data::Instance<T_FEATURE>::getNumDimensions()
+	 );
+      lsnapshot_checkpoint.write(llfh_listFuntionHist.getDomainUpperBound());
+      lsnapshot_checkpoint.write(runtime::elapsedTime(let_executionTime));
+      lsnapshot_checkpoint.writeRandomEngine();
+      lsnapshot_checkpoint.write(lterminationcriteria.getGenerationsStagnant());
+      lsnapshot_checkpoint.write(lterminationcriteria.getFitnessReference());
+      lsnapshot_checkpoint.write(aoop_outParamGAC.getIterationGetsBest());
+      lsnapshot_checkpoint.write(aoop_outParamGAC.getRunTimeGetsBest());
+      lsnapshot_checkpoint.write(aoop_outParamGAC.getTotalInvalidOffspring());
+      gacheckpoint::writeChromosome(lsnapshot_checkpoint,lochrom_best);
+      lsnapshot_checkpoint.write(uintidx(lvectorchrom_population.size()));
+      for (auto lchrom_iter: lvectorchrom_population)
+	gacheckpoint::writeChromosome(lsnapshot_checkpoint,*lchrom_iter);
+      lptr_checkpointWriter->post(std::move(lsnapshot_checkpoint));
+    }
+
     /*2. Evaluation of individuals
       a) Obtain new cluster centers by k-means;
       b) Cluster the objects according to new cluster centers and
@@ -1601,30 +1581,11 @@ tgca_vkcentroid
 	
 	      if ( !(lmapitem_kSegments != lmap_kSegments.end()) ) {
 
-		partition::PartitionDisjSets<T_CLUSTERIDX>
-		  lpartitionDisjSets_clusters
-		  (clusteringop::pointerToDisjSets
-		   (lvector_pairIdxLambda,
-		    larrayiu_pi,
-		    (uintidx) lmmidx_krandNew
-		    )
-		   );
-	   
-		mat::MatrixRow<T_FEATURE>  
-		  lmatrixrowt_newMinMaxKSegments = 
-		  tgca_getKSegments
-		  (aiiterator_instfirst,
-		   aiiterator_instlast,
-		   lpartitionDisjSets_clusters,
-		   [&](const data::Instance<T_FEATURE>* aiinst_iter)
-		   {
-		     return aiinst_iter->getAttribute(lui_idxAttMaxRange);
-		   }
-		   );
-	  
-		lmap_kSegments.emplace(lmmidx_krandNew,lmatrixrowt_newMinMaxKSegments);
-
-		lmapitem_kSegments = lmap_kSegments.find(lmmidx_krandNew);
+		lmapitem_kSegments =
+		  lmap_kSegments.emplace
+		  (lmmidx_krandNew,
+		   lpsegments1d_attMaxRange->getKSegments((uintidx) lmmidx_krandNew)
+		   ).first;
 	    
 	      } //THERE IS NO SEGMENT Ki
 
@@ -1785,8 +1746,11 @@ tgca_vkcentroid
       --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
     
-      if ( !(llfh_listFuntionHist.getDomainUpperBound() 
-	     < aiinp_inParamTGCA.getNumMaxGenerations() ) 
+      if ( lterminationcriteria.isAttained
+	   (llfh_listFuntionHist.getDomainUpperBound(),
+	    runtime::elapsedTime(let_executionTime),
+	    lochrom_best.getFitness()
+	    )
 	   )
 	break;
       llfh_listFuntionHist.increaseDomainUpperBound();
@@ -1807,6 +1771,8 @@ tgca_vkcentroid
     (lochrom_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -1872,13 +1838,6 @@ tgca_vkcentroid
   --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
 
-#ifndef __INITIALIZATION_RANDOM_SAMPLING__
-  if ( larrayiu_pi != NULL )
-    delete [] larrayiu_pi;
-  if ( larrayiu_pi != NULL )
-    delete [] larrayrt_lambda;
-#endif /*__INITIALIZATION RANDOM SAMPLING__*/
-  
   /*DELETE VARIBLES EXTRAS OF THE ALGORITHM
    */
   delete[] larray_minFeactures;
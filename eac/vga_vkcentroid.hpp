@@ -34,6 +34,29 @@
 #include "outparam_gac.hpp"
 
 #include "plot_runtime_function.hpp"
+#include "termination_criteria.hpp"
+#include "ga_warmstart.hpp"
+#include "runtime_profile.hpp"
+#include "ga_island.hpp"
+
+/*THE FITNESS CAN BE ESTIMATED ON A MINI-BATCH OF THE INSTANCES,
+  see minibatch.hpp
+ */
+#define __INPARAM_MINIBATCH__
+
+/*THE SUB-POPULATIONS CAN EVOLVE IN ISLANDS, see ga_island.hpp
+ */
+#define __INPARAM_ISLANDS__
+
+/*THE INITIAL POPULATION CAN BE SEEDED WITH k-means++ OR k-means||,
+  see clusteringop::Seeds
+ */
+#define __INPARAM_INITIALIZATION__
+
+/*PART OF THE INITIAL POPULATION CAN BE READ FROM THE SOLUTIONS SAVED
+  BY AN EARLIER RUN, see gawarmstart::WarmStart
+ */
+#define __INPARAM_WARMSTART__
 
 /*! \namespace eac
   \brief Evolutionary Algorithms for Clustering
@@ -152,6 +175,15 @@ vga_vkcentroid
      "Clustering metrics"
      );
 
+  runtime::TerminationCriteria
+    lterminationcriteria
+    (aiinp_inParamPcPmVk.getNumMaxGenerations(),
+     aiinp_inParamPcPmVk
+     );
+
+  /*TIME, CALLS AND DISTANCES OF EACH PHASE, ENABLED WITH THE PLOT-STAT FILE*/
+  runtime::ProfilePhases lprofile_phases;
+
   /*DECLARATION OF VARIABLES: COMPUTING STATISTICAL AND METRIC OF THE ALGORITHM
    */
 #ifndef __WITHOUT_PLOT_STAT
@@ -198,6 +230,11 @@ vga_vkcentroid
 
     lfileout_plotStatObjetiveFunc.precision(COMMON_COUT_PRECISION);
 
+    lprofile_phases.open
+      (aoop_outParamGAC.getFileNameOutPlotStatObjetiveFunc(),
+       llfh_listFuntionHist.getPlotStatSeparator()
+       );
+
     //FUNCTION HEADER
 
     lfileout_plotStatObjetiveFunc 
@@ -265,6 +302,7 @@ vga_vkcentroid
     in the range [Kmin;Kmax] is generated.
   */    
   { /*BEGIN POPULATION INITIALIZATION*/
+    runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_INITIALIZE);
       
 #ifdef __VERBOSE_YES
     const char *geverbosepc_labelstep = "POPULATION INITIALIZATION:";
@@ -277,6 +315,26 @@ vga_vkcentroid
 #endif /*__VERBOSE_YES*/
    
     
+    const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+      lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+    const clusteringop::Seeds<T_REAL>
+      lseeds_initial
+      (aiinp_inParamPcPmVk.getOpInitialization(),
+       uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)),
+       aiinp_inParamPcPmVk.getOversamplingInitialization() * aiinp_inParamPcPmVk.getNumClusterKMaximum(),
+       aiinp_inParamPcPmVk.getRoundsInitialization(),
+       lcostseeds_instances
+       );
+    gawarmstart::WarmStart<T_FEATURE>
+      lwarmstart_population
+      (aiinp_inParamPcPmVk.getFileNameWarmStart(),
+       aiinp_inParamPcPmVk.getFractionWarmStart(),
+       aiinp_inParamPcPmVk.getPerturbationWarmStart(),
+       aiinp_inParamPcPmVk.getSizePopulation(),
+       aiiterator_instfirst,
+       aiiterator_instlast
+       );
+
     for ( auto &&liter_iChrom: lvectorchrom_population ) {
 
       uintidx lui_numClusterK = 
@@ -289,11 +347,24 @@ vga_vkcentroid
 	 liter_iChrom.getString()
 	 );
      
-      clusteringop::randomInitialize
-	(lmatrixrowt_centroidsChrom, 
-	 aiiterator_instfirst,
-	 aiiterator_instlast
-	 );
+      if ( lwarmstart_population.hasNext() )
+	lwarmstart_population.initialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else if ( lseeds_initial.isRandom() ) 
+	clusteringop::randomInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   aiiterator_instlast
+	   );
+      else
+	clusteringop::seedsInitialize
+	  (lmatrixrowt_centroidsChrom,
+	   aiiterator_instfirst,
+	   lseeds_initial.select(lui_numClusterK,lcostseeds_instances)
+	   );
 
       liter_iChrom.setFitness( measuare_undefIndexI(T_REAL) );	
       liter_iChrom.setObjetiveFunc( measuare_undefObjetiveFunc(T_REAL) );	
@@ -321,13 +392,27 @@ vga_vkcentroid
     
   } /*END POPULATION INITIALIZATION*/
 
+  /*MINI-BATCH: WITH --minibatch-size THE CLUSTERS AND THE FITNESS
+    ARE COMPUTED ON A SAMPLE OF THE INSTANCES THAT CHANGES EACH
+    GENERATION
+   */
+  minibatch::StratifiedSample<INPUT_ITERATOR>
+    lminibatch_sample
+    (aiiterator_instfirst,
+     aiiterator_instlast,
+     aiinp_inParamPcPmVk.getSizeMiniBatch(),
+     aiinp_inParamPcPmVk.getGrowthMiniBatch()
+     );
 
   while ( 1 ) {
 
+    lminibatch_sample.next();
+
     /*Fitness computation
     */
 
     {/*BEGIN FITNESS COMPUTATION*/
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_FITNESS);
       
 #ifdef __VERBOSE_YES
       geverbosepc_labelstep = "FITNESS COMPUTATION";
@@ -369,33 +454,21 @@ vga_vkcentroid
 	    
 	    T_CLUSTERIDX lmcidx_numClusterNull;
 	    
-	    clusteringop::updateCentroids
+	    minibatch::updateCentroids
 	      (lmcidx_numClusterNull,
 	       lmatrixrowt_centroidsChrom,
 	       llmatrixrowt_sumInstancesCluster,
 	       lvectort_numInstancesInClusterK,
-	       aiiterator_instfirst,
-	       aiiterator_instlast,
+	       lminibatch_sample,
 	       aifunc2p_dist
 	       );
 	    
 	    if (lmcidx_numClusterNull == 0 ) {
-	      
-	      auto lpartition_clusters = 
-		partition::makePartition
-		(lmatrixrowt_centroidsChrom,
-		 aiiterator_instfirst,
-		 aiiterator_instlast,
-		 T_CLUSTERIDX(lmatrixrowt_centroidsChrom.getNumRows()),
-		 aifunc2p_dist
-		 );
 
 	      T_REAL lm_indexI = 
-		um::indexI
+		minibatch::indexI<T_CLUSTERIDX>
 		(lmatrixrowt_centroidsChrom,
-		 aiiterator_instfirst,
-		 aiiterator_instlast,
-		 lpartition_clusters,
+		 lminibatch_sample,
 		 aifunc2p_dist
 		 );
 	    
@@ -414,6 +487,26 @@ vga_vkcentroid
 #endif /*__WITHOUT_PLOT_STAT*/
 	   
 	 }
+	  else if ( lminibatch_sample.isActive() &&
+		    liter_iChrom.getFitness() != measuare_undefIndexI(T_REAL) ) {
+	    /*THE FITNESS OF THE PREVIOUS SAMPLE IS NOT COMPARABLE,
+	      THE STRING IS EVALUATED AGAIN WITHOUT CHANGING ITS CENTROIDS
+	    */
+	    mat::MatrixRow<T_FEATURE> 
+	      lmatrixrowt_centroidsChrom
+	      (lui_numClusterK,
+	       data::Instance<T_FEATURE>::getNumDimensions(),
+	       liter_iChrom.getString()
+	       );
+	    T_REAL lm_indexI = 
+	      minibatch::indexI<T_CLUSTERIDX>
+	      (lmatrixrowt_centroidsChrom,
+	       lminibatch_sample,
+	       aifunc2p_dist
+	       );
+	    liter_iChrom.setObjetiveFunc(lm_indexI); 
+	    liter_iChrom.setFitness(lm_indexI);
+	  }
 	} /*lui_numClusterK >= 2*/
 	else {
 	  liter_iChrom.setObjetiveFunc(measuare_undefIndexI(T_REAL)); 
@@ -436,6 +529,7 @@ vga_vkcentroid
    
     { /*BEGIN PRESERVING THE BEST STRING
        */
+      runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_ELITISM);
 #ifdef __VERBOSE_YES
       const char *geverbosepc_labelstep = "ELITISM PRESERVING THE BEST";
       ++geiinparam_verbose;
@@ -446,6 +540,30 @@ vga_vkcentroid
       }
 #endif /*__VERBOSE_YES*/
 
+      /*THE BEST STRING IS EVALUATED ON THE SAME SAMPLE AS THE POPULATION
+       */
+      uintidx lui_numClusterKBest = 
+	lochrom_best.getStringSize() / data::Instance<T_FEATURE>::getNumDimensions();
+      if ( lminibatch_sample.isActive() &&
+	   lochrom_best.getFitness() != -std::numeric_limits<T_REAL>::max() &&
+	   lochrom_best.getFitness() != measuare_undefIndexI(T_REAL) &&
+	   lui_numClusterKBest >= 2 ) {
+	mat::MatrixRow<T_FEATURE> 
+	  lmatrixrowt_centroidsBest
+	  (lui_numClusterKBest,
+	   data::Instance<T_FEATURE>::getNumDimensions(),
+	   lochrom_best.getString()
+	   );
+	T_REAL lm_indexI = 
+	  minibatch::indexI<T_CLUSTERIDX>
+	  (lmatrixrowt_centroidsBest,
+	   lminibatch_sample,
+	   aifunc2p_dist
+	   );
+	lochrom_best.setObjetiveFunc(lm_indexI); 
+	lochrom_best.setFitness(lm_indexI);
+      }
+
       auto lit_chromMax = std::max_element
 	(lvectorchrom_population.begin(), 
 	 lvectorchrom_population.end(), 
@@ -497,6 +615,7 @@ vga_vkcentroid
 	 lvectort_statfuncObjetiveFunc
 	 );
       lfileout_plotStatObjetiveFunc << llfh_listFuntionHist;
+      lprofile_phases.endGeneration(llfh_listFuntionHist.getDomainUpperBound());
       lvectort_statfuncObjetiveFunc.clear();
     }
 #endif /*__WITHOUT_PLOT_STAT*/
@@ -522,14 +641,24 @@ vga_vkcentroid
       --geiinparam_verbose;
 #endif /*__VERBOSE_YES*/
     
-      if ( !(llfh_listFuntionHist.getDomainUpperBound() 
-	     < aiinp_inParamPcPmVk.getNumMaxGenerations() ) 
+      if ( lterminationcriteria.isAttained
+	   (llfh_listFuntionHist.getDomainUpperBound(),
+	    runtime::elapsedTime(let_executionTime),
+	    lochrom_best.getFitness()
+	    )
 	   )
 	break;
       
       llfh_listFuntionHist.increaseDomainUpperBound();
     } /*END TERMINATION CRITERION*/
 
+    /*MIGRATION BETWEEN THE ISLANDS
+     */
+    gaisland::migrate
+      (llfh_listFuntionHist.getDomainUpperBound(),
+       lvectorchrom_population
+       );
+
     
     /*GENETIC OPERATIONS
      */
@@ -539,6 +668,7 @@ vga_vkcentroid
 	applied on the population of strings.
       */
       { /*BEGIN SELECTION*/
+	runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_SELECTION);
 
 #ifdef __VERBOSE_YES
 	geverbosepc_labelstep = "SELECTION";
@@ -600,6 +730,7 @@ vga_vkcentroid
       /*Crossover
        */
       { /*BEGIN CROSSOVER*/
+	runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_CROSSOVER);
 
 #ifdef __VERBOSE_YES
 	geverbosepc_labelstep = "CROSSOVER";
@@ -668,6 +799,7 @@ vga_vkcentroid
 	in a chromosome is mutated with probability $\mu_m$.
       */
       { /*BEGIN MUTATION*/
+	runtime::ScopedProfilePhase lscopedprofile_phase(lprofile_phases,runtime::PROFILE_MUTATION);
 
 #ifdef __VERBOSE_YES
 	geverbosepc_labelstep = "MUTATION";
@@ -711,6 +843,38 @@ vga_vkcentroid
   uintidx lui_numClusterKBest = 
 	 lochrom_best.getStringSize() / data::Instance<T_FEATURE>::getNumDimensions();
 
+  /*MINI-BATCH: THE BEST STRING IS EVALUATED ON ALL THE INSTANCES
+   */
+  if ( lminibatch_sample.isUsed() && lui_numClusterKBest >= 2 ) {
+    mat::MatrixRow<T_FEATURE> 
+      lmatrixrowt_centroidsBest
+      (lui_numClusterKBest,
+       data::Instance<T_FEATURE>::getNumDimensions(),
+       lochrom_best.getString()
+       );
+    auto lpartition_clusters = 
+      partition::makePartition
+      (lmatrixrowt_centroidsBest,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       T_CLUSTERIDX(lui_numClusterKBest),
+       aifunc2p_dist
+       );
+    T_REAL lm_indexI = 
+      um::indexI
+      (lmatrixrowt_centroidsBest,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       lpartition_clusters,
+       aifunc2p_dist
+       );
+    aoop_outParamGAC.setMiniBatch
+      (lochrom_best.getObjetiveFunc(),lm_indexI);
+    lochrom_best.setObjetiveFunc(lm_indexI); 
+    lochrom_best.setFitness(lm_indexI);
+  }
+
+  lprofile_phases.close();
   runtime::stop(let_executionTime);
   aoop_outParamGAC.setNumClusterK
     ((T_CLUSTERIDX)lui_numClusterKBest);
@@ -720,6 +884,8 @@ vga_vkcentroid
     (lochrom_best.getFitness());
   aoop_outParamGAC.setAlgorithmRunTime
     (runtime::getTime(let_executionTime));
+  aoop_outParamGAC.setTerminationCriterion
+    (lterminationcriteria.getNameCriterion());
   aoop_outParamGAC.setNumTotalGenerations
     (llfh_listFuntionHist.getDomainUpperBound());
 
@@ -246,10 +246,8 @@ public:
 
     for(uintidx i = 0; i < this->_uintidx_numWords; i++) {
       lt_word = _arrayuit_data[i];
-      for(unsigned short int j = 0; j < ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords; j++) {
-	if ( lt_word & 0x1) ++louintidx_numBitOn;  
-	lt_word >>= 1;
-      }
+      if ( lt_word )
+	louintidx_numBitOn += ds::BitContainer<T_BITSIZE>::popCount(lt_word);
     }
     
 #ifdef __VERBOSE_YES
@@ -284,10 +282,11 @@ public:
 
     for(uintidx i = 0; i < this->_uintidx_numWords; i++) {
       lt_word = _arrayuit_data[i];
-      for(unsigned short int j = 0; j < ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords; j++) {
-	if ( lt_word & 0x1 )
-	  lostui_idxInstance.push_back((uintidx)(ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords * i + j));
-	lt_word >>= 1;
+      while ( lt_word ) {
+	lostui_idxInstance.push_back
+	  ((uintidx)(ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords * i
+		     + ds::BitContainer<T_BITSIZE>::countTrailingZeros(lt_word)));
+	lt_word &= lt_word - 1;
       }
     }
     
@@ -506,6 +505,38 @@ public:
      
   }
 
+  //!popCount
+  /*!
+    Number of bits on in a word
+  */
+  static inline unsigned short int popCount(T_BITSIZE aiT_word)
+  {
+#if defined(__GNUC__)
+    return (unsigned short int) __builtin_popcountll((unsigned long long) aiT_word);
+#else
+    unsigned short int lusi_numBitOn = 0;
+    for ( ; aiT_word; aiT_word &= aiT_word - 1 )
+      ++lusi_numBitOn;
+    return lusi_numBitOn;
+#endif
+  }
+
+  //!countTrailingZeros
+  /*!
+    Offset of the lowest bit on in a word, the word must not be zero
+  */
+  static inline unsigned short int countTrailingZeros(T_BITSIZE aiT_word)
+  {
+#if defined(__GNUC__)
+    return (unsigned short int) __builtin_ctzll((unsigned long long) aiT_word);
+#else
+    unsigned short int lusi_offset = 0;
+    for ( ; !(aiT_word & 0x1); aiT_word >>= 1 )
+      ++lusi_offset;
+    return lusi_offset;
+#endif
+  }
+
   //!_getNumWords
   /*!
     Number of words required to store a given number of bits
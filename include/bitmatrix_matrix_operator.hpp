@@ -17,6 +17,13 @@
 #include "matrix.hpp"
 #include "linear_algebra_level1.hpp"
 
+/*BITGEMM_MIN_ELEMS_PARALLEL: minimum size of the product A x B, in 
+  bits of A times columns of B, to compute the rows in parallel
+ */
+#ifndef BITGEMM_MIN_ELEMS_PARALLEL
+#define BITGEMM_MIN_ELEMS_PARALLEL  (uintidx) 1048576
+#endif
+
 /*! \namespace mat
   \brief Matrix module and associated operations
   \details Implementation of the data type Matrix and operations, uses OpenBLAS when compiling with this option, otherwise functions that are not based in the Interface to Streaming SIMD Extensions (SSE).
@@ -33,7 +40,7 @@ namespace mat {
 /*! \fn void mulRowsIColumns0N(T_C *aoarrayT_rowC, uintidx aiuintidx_idxBegin, uintidx aiuintidx_idxEnd, mat::BitArray<T_BITSIZE>  &aibarray_rowA, MatrixRow<T_B> &aimatrixrowt_B
  )
     \brief mulRowsIColumns0N:
-    \details
+    \details Sum of the rows of B whose bit is on in the row of A. The bits are visited word by word, the zero words are skipped and within a word only the bits on are visited, in increasing order of index
     \param aoarrayT_rowC a array of type T_C
     \param aiuintidx_idxBegin a uintidx 
     \param aiuintidx_idxEnd a uintidx 
@@ -58,15 +65,34 @@ mulRowsIColumns0N
       T_C(0), 
       aimatrixrowt_B.getNumColumns()
       );  
-  for ( uintidx li_i = aiuintidx_idxBegin; li_i < aiuintidx_idxEnd; li_i++) {
-    if ( aibarray_rowA.getBit(li_i) ) {
-      
+  if ( aiuintidx_idxBegin >= aiuintidx_idxEnd )
+    return;
+
+  const unsigned short int lusi_numBitsWords =
+    ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords;
+  const T_BITSIZE *larrayT_words  = aibarray_rowA.toArray();
+  const uintidx   lui_wordBegin   = aiuintidx_idxBegin / lusi_numBitsWords;
+  const uintidx   lui_wordEnd     = (aiuintidx_idxEnd - 1) / lusi_numBitsWords;
+  
+  for ( uintidx lui_w = lui_wordBegin; lui_w <= lui_wordEnd; lui_w++) {
+    T_BITSIZE lt_word = larrayT_words[lui_w];
+    if ( lui_w == lui_wordBegin )
+      lt_word &= ds::BitContainer<T_BITSIZE>::t_wordMax
+	<< (aiuintidx_idxBegin % lusi_numBitsWords);
+    if ( lui_w == lui_wordEnd && (aiuintidx_idxEnd % lusi_numBitsWords) != 0 )
+      lt_word &= ds::BitContainer<T_BITSIZE>::t_wordMax
+	>> (lusi_numBitsWords - (aiuintidx_idxEnd % lusi_numBitsWords));
+    
+    while ( lt_word ) {
+      uintidx li_i = lui_w * lusi_numBitsWords
+	+ ds::BitContainer<T_BITSIZE>::countTrailingZeros(lt_word);
       interfacesse::axpy
 	(aoarrayT_rowC,
 	 1.0,
 	 aimatrixrowt_B.getRow(li_i),
 	 aimatrixrowt_B.getNumColumns()
 	 );
+      lt_word &= lt_word - 1;
     }
   }
 }
@@ -78,6 +104,7 @@ mulRowsIColumns0N
     \f[
      C = A  \times B,
     \f]
+    The rows of C are independent, so they are computed in parallel when the product is large enough (see BITGEMM_MIN_ELEMS_PARALLEL)
     \param aomatrixrowt_C a The resulting matrix  mat::MatrixRow<T_C>
     \param aibitmatrixT_A a matrix of bits mat::BitMatrix
     \param aimatrixrowt_B a matrix of integers or real MatrixRow<T_B>
@@ -93,8 +120,6 @@ bitgemm
  MatrixRow<T_B>               &aimatrixrowt_B
  )
 {
-  mat::BitArray<T_BITSIZE> lbarray_row(aibitmatrixT_A.getNumColumns(),NULL);
-
 #ifdef __VERBOSE_YES
   const char* lpc_labelFunc = "mat::bitgemm";
   ++geiinparam_verbose;
@@ -114,8 +139,17 @@ bitgemm
 	 "the number of columns of the first matrix is different than the second"
 	 );
 
-  for ( uintidx luintidx_i = 0; luintidx_i < aibitmatrixT_A.getNumRows(); luintidx_i++) {
-    lbarray_row.setArray(aibitmatrixT_A.getRow(luintidx_i));
+  const bool lb_parallel =
+    aibitmatrixT_A.getNumRows() > 1 &&
+    aibitmatrixT_A.getNumElems() * aimatrixrowt_B.getNumColumns()
+    >= BITGEMM_MIN_ELEMS_PARALLEL;
+  
+  const long ll_numRows = (long) aibitmatrixT_A.getNumRows();
+#pragma omp parallel for schedule(static) if(lb_parallel)
+  for ( long ll_i = 0; ll_i < ll_numRows; ll_i++) {
+    const uintidx luintidx_i = (uintidx) ll_i;
+    mat::BitArray<T_BITSIZE> lbarray_row
+      (aibitmatrixT_A.getNumColumns(),aibitmatrixT_A.getRow(luintidx_i));
     mulRowsIColumns0N
       (aomatrixrowt_C.getRow(luintidx_i),
        (uintidx) 0,
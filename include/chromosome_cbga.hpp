@@ -396,7 +396,7 @@ public:
     this->_t_objetiveFunc = ait_objetiveFunc;
   }
 
-  inline T_REAL getObjetiveFunc() 
+  inline T_REAL getObjetiveFunc() const
   {
     return this->_t_objetiveFunc;
   }
@@ -55,6 +55,9 @@ public:
     , _vectorT_partialFcC()
     , _enum_feacOperatorApplied(FEAC_OPERATOR_UNKNOWN)
     , _t_lastObjetiveFunc(-std::numeric_limits<T_METRIC>::max())
+    , _vectorT_upperBound()
+    , _vectorT_lowerBound()
+    , _vectorT_driftCentroids()
   {
     this->setObjetiveFunc(-std::numeric_limits<T_METRIC>::max());
   }
@@ -69,6 +72,9 @@ public:
     , _vectorT_partialFcC(aiuintidx_numClusterK)
     , _enum_feacOperatorApplied(FEAC_OPERATOR_UNKNOWN)
     , _t_lastObjetiveFunc(-std::numeric_limits<T_METRIC>::max())
+    , _vectorT_upperBound()
+    , _vectorT_lowerBound()
+    , _vectorT_driftCentroids()
   {}
 
   //copy constructor
@@ -87,6 +93,9 @@ public:
     , _vectorT_partialFcC(ichromfeac_b._vectorT_partialFcC)
     , _enum_feacOperatorApplied(ichromfeac_b._enum_feacOperatorApplied)
     , _t_lastObjetiveFunc(ichromfeac_b._t_lastObjetiveFunc)
+    , _vectorT_upperBound(ichromfeac_b._vectorT_upperBound)
+    , _vectorT_lowerBound(ichromfeac_b._vectorT_lowerBound)
+    , _vectorT_driftCentroids(ichromfeac_b._vectorT_driftCentroids)
   {
 
 #ifdef __VERBOSE_YES
@@ -131,6 +140,9 @@ public:
     , _vectorT_partialFcC(ichromfeac_b._vectorT_partialFcC)
     , _enum_feacOperatorApplied(ichromfeac_b._enum_feacOperatorApplied)
     , _t_lastObjetiveFunc(ichromfeac_b._t_lastObjetiveFunc)
+    , _vectorT_upperBound(ichromfeac_b._vectorT_upperBound)
+    , _vectorT_lowerBound(ichromfeac_b._vectorT_lowerBound)
+    , _vectorT_driftCentroids(ichromfeac_b._vectorT_driftCentroids)
   {
 #ifdef __VERBOSE_YES
     const char* lpc_labelFunc = "Move:ChromosomeFEAC::ChromosomeFEAC";
@@ -196,6 +208,9 @@ public:
       _vectorT_partialFcC = ichromfeac_b._vectorT_partialFcC;
       _enum_feacOperatorApplied = ichromfeac_b._enum_feacOperatorApplied;
       _t_lastObjetiveFunc = ichromfeac_b._t_lastObjetiveFunc;
+      _vectorT_upperBound = ichromfeac_b._vectorT_upperBound;
+      _vectorT_lowerBound = ichromfeac_b._vectorT_lowerBound;
+      _vectorT_driftCentroids = ichromfeac_b._vectorT_driftCentroids;
     }
     
 #ifdef __VERBOSE_YES
@@ -235,6 +250,9 @@ public:
       _vectorT_partialFcC = ichromfeac_b._vectorT_partialFcC;
       _enum_feacOperatorApplied = ichromfeac_b._enum_feacOperatorApplied;
       _t_lastObjetiveFunc = ichromfeac_b._t_lastObjetiveFunc;
+      _vectorT_upperBound = ichromfeac_b._vectorT_upperBound;
+      _vectorT_lowerBound = ichromfeac_b._vectorT_lowerBound;
+      _vectorT_driftCentroids = ichromfeac_b._vectorT_driftCentroids;
     }
     return *this;
   }
@@ -288,6 +306,91 @@ public:
     return _enum_feacOperatorApplied;
   }
   
+  /*! \fn std::vector<T_METRIC>& getUpperBound()
+    \brief Upper bound of the distance from each instance to the centroid of its cluster
+   */
+  inline
+  std::vector<T_METRIC>& getUpperBound()
+  {
+    return this->_vectorT_upperBound;
+  }
+
+  /*! \fn std::vector<T_METRIC>& getLowerBound()
+    \brief Lower bound of the distance from each instance to each centroid, the bound of the instance i and the centroid k is at \f$ i \cdot k_{g} + k \f$
+   */
+  inline
+  std::vector<T_METRIC>& getLowerBound()
+  {
+    return this->_vectorT_lowerBound;
+  }
+
+  /*! \fn std::vector<T_METRIC>& getDriftCentroids()
+    \brief Distance that each centroid has moved since the bounds were last updated
+   */
+  inline
+  std::vector<T_METRIC>& getDriftCentroids()
+  {
+    return this->_vectorT_driftCentroids;
+  }
+
+  /*! \fn bool hasBounds() const
+    \brief If the bounds are kept, see gaclusteringop::kmeansfeac
+   */
+  inline
+  bool hasBounds() const
+  {
+    return !this->_vectorT_driftCentroids.empty();
+  }
+
+  inline
+  void clearBounds()
+  {
+    this->_vectorT_upperBound.clear();
+    this->_vectorT_lowerBound.clear();
+    this->_vectorT_driftCentroids.clear();
+  }
+
+  /*! \fn void keepClustersBounds(const std::vector<uintidx> &aivectorui_clustersKeep)
+    \brief Keep the lower bounds and the drift of the clusters in aivectorui_clustersKeep, in increasing order
+   */
+  void keepClustersBounds(const std::vector<uintidx> &aivectorui_clustersKeep)
+  {
+    const uintidx lui_numInstances = this->_vectorT_upperBound.size();
+    const uintidx lui_numClusterK  = this->_vectorT_driftCentroids.size();
+    const uintidx lui_numKeep      = aivectorui_clustersKeep.size();
+    
+    for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++) {
+      const T_METRIC *larrayt_old = this->_vectorT_lowerBound.data() + lui_i * lui_numClusterK;
+      T_METRIC       *larrayt_new = this->_vectorT_lowerBound.data() + lui_i * lui_numKeep;
+      for (uintidx lui_k = 0; lui_k < lui_numKeep; lui_k++)
+	larrayt_new[lui_k] = larrayt_old[aivectorui_clustersKeep[lui_k]];
+    }
+    this->_vectorT_lowerBound.resize(lui_numInstances * lui_numKeep);
+    for (uintidx lui_k = 0; lui_k < lui_numKeep; lui_k++)
+      this->_vectorT_driftCentroids[lui_k] =
+	this->_vectorT_driftCentroids[aivectorui_clustersKeep[lui_k]];
+    this->_vectorT_driftCentroids.resize(lui_numKeep);
+  }
+
+  /*! \fn void copyClusterBounds(const uintidx aiui_k)
+    \brief Add the lower bounds and the drift of a new cluster equal to those of cluster aiui_k
+   */
+  void copyClusterBounds(const uintidx aiui_k)
+  {
+    const uintidx lui_numInstances = this->_vectorT_upperBound.size();
+    const uintidx lui_numClusterK  = this->_vectorT_driftCentroids.size();
+    
+    this->_vectorT_lowerBound.resize(lui_numInstances * (lui_numClusterK + 1));
+    for (uintidx lui_i = lui_numInstances; lui_i-- > 0; ) {
+      const T_METRIC *larrayt_old = this->_vectorT_lowerBound.data() + lui_i * lui_numClusterK;
+      T_METRIC       *larrayt_new = this->_vectorT_lowerBound.data() + lui_i * (lui_numClusterK + 1);
+      larrayt_new[lui_numClusterK] = larrayt_old[aiui_k];
+      for (uintidx lui_k = lui_numClusterK; lui_k-- > 0; )
+	larrayt_new[lui_k] = larrayt_old[lui_k];
+    }
+    this->_vectorT_driftCentroids.push_back(this->_vectorT_driftCentroids[aiui_k]);
+  }
+  
   void saveLastObjetiveFunc() 
   {
     _t_lastObjetiveFunc = this->_t_objetiveFunc;
@@ -386,6 +489,11 @@ protected:
   std::vector<T_METRIC>          _vectorT_partialFcC;
   EnumFeacOperatorApplied        _enum_feacOperatorApplied;
   T_METRIC                       _t_lastObjetiveFunc;
+  /*BOUNDS OF THE K-MEANS INHERITED BY THE OFFSPRING
+   */
+  std::vector<T_METRIC>          _vectorT_upperBound;
+  std::vector<T_METRIC>          _vectorT_lowerBound;
+  std::vector<T_METRIC>          _vectorT_driftCentroids;
 
 }; /*ChromosomeFEAC*/
 
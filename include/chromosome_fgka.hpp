@@ -125,13 +125,13 @@ public:
 protected:
   T_CLUSTERIDX         _cidx_numClusterNotNull;
   bool                        _b_selected; /*used*/
-  static T_CLUSTERIDX  _stcidx_numClusterK;
+  static thread_local T_CLUSTERIDX  _stcidx_numClusterK;
 }; /*END  ChromosomeFGKA */
 
 template <class T_CLUSTERIDX,
 	  class T_METRIC
 	  >
-T_CLUSTERIDX ChromosomeFGKA<T_CLUSTERIDX,T_METRIC>::_stcidx_numClusterK = 0;
+thread_local T_CLUSTERIDX ChromosomeFGKA<T_CLUSTERIDX,T_METRIC>::_stcidx_numClusterK = 0;
 
 } /*END namespace gaencode*/
   
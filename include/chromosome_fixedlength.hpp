@@ -50,17 +50,33 @@ public:
   ChromFixedLength()
     :  ChromosomeString<T_GENE,T_METRIC>()
     , _pts_string(new T_GENE[_stcui_stringSize])
+    , _b_externalString(false)
+    , _ui_stringSize(_stcui_stringSize)
   { }
 
   ChromFixedLength(const T_METRIC airt_objetiveFunc, const T_METRIC airt_fitness)
     :  ChromosomeString<T_GENE,T_METRIC>(airt_objetiveFunc, airt_fitness)
     ,  _pts_string(new T_GENE[_stcui_stringSize])
+    , _b_externalString(false)
+    , _ui_stringSize(_stcui_stringSize)
+  { }
+
+  /*Chromosome whose string is stored outside, eg. in a
+    gaencode::PopulationArena, it is not deleted by the chromosome
+   */
+  explicit ChromFixedLength(T_GENE *aiarrayt_string)
+    :  ChromosomeString<T_GENE,T_METRIC>()
+    , _pts_string(aiarrayt_string)
+    , _b_externalString(true)
+    , _ui_stringSize(_stcui_stringSize)
   { }
   
   //move constructor 
   ChromFixedLength(ChromFixedLength<T_GENE,T_METRIC> &&aichrom_b)
     :  ChromosomeString<T_GENE,T_METRIC>(aichrom_b)
     ,  _pts_string(aichrom_b._pts_string)
+    ,  _b_externalString(aichrom_b._b_externalString)
+    ,  _ui_stringSize(aichrom_b._ui_stringSize)
   {
 #ifdef __VERBOSE_YES
     const char* lpc_labelFunc = "gaencode::ChromFixedLength::ChromFixedLength:move";
@@ -92,11 +108,13 @@ public:
   ChromFixedLength
   (const ChromFixedLength<T_GENE,T_METRIC> &aichrom_b)
     :  ChromosomeString<T_GENE,T_METRIC>(aichrom_b)
-    , _pts_string(new T_GENE[_stcui_stringSize])
+    , _pts_string(new T_GENE[aichrom_b._ui_stringSize])
+    , _b_externalString(false)
+    , _ui_stringSize(aichrom_b._ui_stringSize)
   {
     if (_pts_string != NULL) {
       interfacesse::copy
-	(this->_pts_string, aichrom_b._pts_string, _stcui_stringSize);
+	(this->_pts_string, aichrom_b._pts_string, this->_ui_stringSize);
     }
   }
 
@@ -113,7 +131,7 @@ public:
     }
 #endif //__VERBOSE_YES
 
-    if ( this->_pts_string != NULL ) {
+    if ( this->_pts_string != NULL && !this->_b_externalString ) {
       delete[] _pts_string; 
     }
 
@@ -149,7 +167,7 @@ public:
       interfacesse::copy
 	(this->_pts_string, 
 	 aichrom_b._pts_string, 
-	 _stcui_stringSize
+	 this->_ui_stringSize
 	 );
     }
     
@@ -173,16 +191,30 @@ public:
   {
     if ( this != &aichrom_b ) {
       ChromosomeString<T_GENE,T_METRIC>::operator=(aichrom_b);
-      if ( this->_pts_string != NULL ) {
-	delete[] _pts_string; 
+      if ( this->_b_externalString || aichrom_b._b_externalString ) {
+	/*THE STRINGS STAY IN THEIR STORAGE*/
+	interfacesse::copy
+	  (this->_pts_string, 
+	   aichrom_b._pts_string, 
+	   this->_ui_stringSize
+	   );
+      }
+      else {
+	if ( this->_pts_string != NULL ) {
+	  delete[] _pts_string; 
+	}
+	this->_pts_string = aichrom_b._pts_string;
+	this->_ui_stringSize = aichrom_b._ui_stringSize;
+	aichrom_b._pts_string = NULL;
       }
-      this->_pts_string = aichrom_b._pts_string;
-      aichrom_b._pts_string = NULL;
     }
 
     return *this;
   }
 
+  /*! \fn static void setStringSize(uintidx aiuintidx_stringSize)
+    \brief Length of the chromosomes created on the calling thread, each chromosome keeps its own length, so it can be copied on another thread
+  */
   inline static void setStringSize(uintidx aiuintidx_stringSize) 
   {
     _stcui_stringSize = aiuintidx_stringSize;
@@ -195,7 +227,7 @@ public:
 
   virtual const uintidx getStringSize() const 
   {
-    return _stcui_stringSize;
+    return this->_ui_stringSize;
   }
 
   virtual void setString(T_GENE *aips_string) 
@@ -203,7 +235,7 @@ public:
     interfacesse::copy
       (this->_pts_string, 
        aips_string, 
-       _stcui_stringSize
+       this->_ui_stringSize
        );
   }
   
@@ -224,12 +256,12 @@ public:
 
   inline T_GENE* end()
   {
-    return this->_pts_string + _stcui_stringSize;
+    return this->_pts_string + this->_ui_stringSize;
   }
   
   virtual const T_GENE getGene(const uintidx aiuintidx_idxGene) const 
   {   
-    assert(0 <= aiuintidx_idxGene && aiuintidx_idxGene < _stcui_stringSize );
+    assert(0 <= aiuintidx_idxGene && aiuintidx_idxGene < this->_ui_stringSize );
     return this->_pts_string[aiuintidx_idxGene];
   }
 
@@ -249,7 +281,7 @@ public:
     }
 #endif //__VERBOSE_YES
     
-    assert(0 <= aiuintidx_idxGene && aiuintidx_idxGene < _stcui_stringSize );
+    assert(0 <= aiuintidx_idxGene && aiuintidx_idxGene < this->_ui_stringSize );
     this->_pts_string[aiuintidx_idxGene] = ait_newGene;
 
 #ifdef __VERBOSE_YES
@@ -280,22 +312,24 @@ public:
 #endif
     
     if ( this->_pts_string != NULL ) {
-      for(uintidx li_j = 0; li_j < ( this->_stcui_stringSize - 1 ); li_j++) {
+      for(uintidx li_j = 0; li_j < ( this->_ui_stringSize - 1 ); li_j++) {
 	os << this->_pts_string[li_j] << aic_delimCoef;
       }
-      os << this->_pts_string[(this->_stcui_stringSize-1)];
+      os << this->_pts_string[(this->_ui_stringSize-1)];
     }
   }
 
 protected:
 
-  T_GENE         *_pts_string;
-  static uintidx _stcui_stringSize;
+  T_GENE                       *_pts_string;
+  bool                         _b_externalString;
+  uintidx                      _ui_stringSize;
+  static thread_local uintidx  _stcui_stringSize;
 
 }; //End ChromFixedLength
 
 template <class T_GENE, class T_METRIC>
-uintidx gaencode::ChromFixedLength<T_GENE,T_METRIC>::_stcui_stringSize = 0;
+thread_local uintidx gaencode::ChromFixedLength<T_GENE,T_METRIC>::_stcui_stringSize = 0;
 
 
 } /*END namespace gaencode*/
@@ -314,7 +314,7 @@ public:
   void deleteGroupNull(T_CLUSTERIDX aicidx_k)
   {
     T_CLUSTERIDX *larraycidx_iChrom = this->getString();
-    const T_CLUSTERIDX *larraycidx_iChromEnd = this->getString() + this->_stcui_stringSize;
+    const T_CLUSTERIDX *larraycidx_iChromEnd = this->getString() + this->_ui_stringSize;
    
     while (larraycidx_iChrom != larraycidx_iChromEnd) {
       if ( aicidx_k < *larraycidx_iChrom )
@@ -342,7 +342,7 @@ public:
 
       const T_CLUSTERIDX *larraycidx_iChrom = this->getString();
 	    
-      for (uintidx lui_i = 0; lui_i <  this->_stcui_stringSize; lui_i++) {
+      for (uintidx lui_i = 0; lui_i <  this->_ui_stringSize; lui_i++) {
 	  ++lvectorui_countgene.at(*larraycidx_iChrom);
 	  ++larraycidx_iChrom;
 	}
@@ -385,10 +385,10 @@ public:
 
     
     if ( this->_pts_string != NULL ) {
-      for(uintidx li_j = 0; li_j < ( this->_stcui_stringSize - 1 ); li_j++) {
+      for(uintidx li_j = 0; li_j < ( this->_ui_stringSize - 1 ); li_j++) {
 	os << this->_pts_string[li_j] << aic_delimCoef;
       }
-      os << this->_pts_string[(this->_stcui_stringSize-1)];
+      os << this->_pts_string[(this->_ui_stringSize-1)];
     }
         
     if ( this->_pts_groupSecString != NULL ) {
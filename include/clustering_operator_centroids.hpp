@@ -19,6 +19,7 @@
 #include <utility>      // std::move
 #include <stdexcept>
 #include <unordered_set>
+#include <numeric>      // std::accumulate
 
 #include "random_ext.hpp"
 #include "instance_frequency.hpp"
@@ -30,12 +31,16 @@
 #include "bit_array.hpp"
 #include "stats_instances.hpp"
 #include "probability_selection.hpp"
+#include "probability_distribution.hpp"
+#include "ga_selection.hpp"
+#include "dist_euclidean.hpp"
 #include "nearestcentroids_operator.hpp"
+#include "nearestcentroids_block.hpp"
 #include "partition_label.hpp"
 
 #include "verbose_global.hpp"
 
-extern StdMT19937  gmt19937_eng;
+extern thread_local StdMT19937  gmt19937_eng;
 
 /*! \namespace clusteringop
   \brief Clustering operators
@@ -278,6 +283,402 @@ randomInitialize
 } /*initialize*/
 
 
+#define CLUSTERINGOP_SEEDS_RANDOM         0
+#define CLUSTERINGOP_SEEDS_KMEANSPP       1
+#define CLUSTERINGOP_SEEDS_KMEANSPARALLEL 2
+
+/*CLUSTERINGOP_SEEDS_MIN_PARALLEL: the costs to a new seed of fewer
+  instances are updated by one thread
+ */
+#ifndef CLUSTERINGOP_SEEDS_MIN_PARALLEL
+#define CLUSTERINGOP_SEEDS_MIN_PARALLEL 4096
+#endif /*CLUSTERINGOP_SEEDS_MIN_PARALLEL*/
+
+/*! \fn std::vector<uintidx> kmeansppSelect(const uintidx aiui_numSeeds, const std::vector<T_REAL> &aivectort_weight, FUNCTION_COST aifunc_cost)
+    \brief Select seeds with the D² weighting of k-means++ \cite Arthur:Vassilvitskii:kmeanspp:2007
+    \details The first seed is selected with probability proportional to the weight of the instance, each next seed with probability proportional to the weight times the cost to its nearest seed. The seeds are different while there are instances with cost greater than 0, then the remaining seeds are selected at random among the instances that are not seeds
+    \param aiui_numSeeds number of seeds to select, at most the number of instances
+    \param aivectort_weight weight of each instance
+    \param aifunc_cost function (i,j) with the cost of the instance i to the seed j, eg. the squared distance, it is called by several threads
+*/
+template < typename T_REAL,
+	   typename FUNCTION_COST
+	   >
+std::vector<uintidx>
+kmeansppSelect
+(const uintidx             aiui_numSeeds,
+ const std::vector<T_REAL> &aivectort_weight,
+ FUNCTION_COST             aifunc_cost
+ )
+{
+  const uintidx lui_numInstances = (uintidx) aivectort_weight.size();
+  const uintidx lui_numSeeds     = std::min(aiui_numSeeds,lui_numInstances);
+
+  std::vector<uintidx> lovectorui_idxSeeds;
+  lovectorui_idxSeeds.reserve(lui_numSeeds);
+
+  std::vector<T_REAL> lvectort_costNearest
+    (lui_numInstances,std::numeric_limits<T_REAL>::max());
+  std::vector<T_REAL> lvectort_weightCost(aivectort_weight);
+  std::vector<bool>   lvectorb_isSeed(lui_numInstances,false);
+  std::uniform_int_distribution<uintidx> luniformdis_uiidxInstances0n
+    (0,(lui_numInstances > 0)?lui_numInstances-1:0);
+  
+  while ( lovectorui_idxSeeds.size() < lui_numSeeds ) {
+
+    uintidx lui_idxSeed = lui_numInstances;
+    if ( std::any_of
+	 (lvectort_weightCost.begin(),
+	  lvectort_weightCost.end(),
+	  [](const T_REAL airt_weightCost) { return airt_weightCost > T_REAL(0); }
+	  ) ) {
+      std::vector<T_REAL>&& lvectort_probDistRouletteWheel =
+	prob::makeDistRouletteWheel
+	(lvectort_weightCost.begin(),
+	 lvectort_weightCost.end(),
+	 [](const T_REAL airt_weightCost) -> T_REAL
+	 {
+	   return airt_weightCost;
+	 }
+	 );
+      lui_idxSeed =
+	gaselect::getIdxRouletteWheel
+	(lvectort_probDistRouletteWheel,
+	 uintidx(0)
+	 );
+    }
+    /*THE INSTANCES WITH COST GREATER THAN 0 ARE SEEDS, OR THE ROUNDING
+      OF THE WHEEL SELECTED AN INSTANCE WITHOUT PROBABILITY
+     */
+    if ( lui_idxSeed >= lui_numInstances
+	 || !(lvectort_weightCost[lui_idxSeed] > T_REAL(0)) ) {
+      do {
+	lui_idxSeed = luniformdis_uiidxInstances0n(gmt19937_eng);
+      } while ( lvectorb_isSeed[lui_idxSeed] );
+    }
+    
+    lovectorui_idxSeeds.push_back(lui_idxSeed);
+    lvectorb_isSeed[lui_idxSeed] = true;
+    if ( lovectorui_idxSeeds.size() == lui_numSeeds )
+      break;
+
+    const long ll_numInstances = (long) lui_numInstances;
+#pragma omp parallel for schedule(static) if(lui_numInstances >= CLUSTERINGOP_SEEDS_MIN_PARALLEL)
+    for ( long ll_i = 0; ll_i < ll_numInstances; ll_i++) {
+      const uintidx lui_i = (uintidx) ll_i;
+      const T_REAL  lrt_cost = 
+	( lvectorb_isSeed[lui_i] )?T_REAL(0):aifunc_cost(lui_i,lui_idxSeed);
+      if ( lrt_cost < lvectort_costNearest[lui_i] )
+	lvectort_costNearest[lui_i] = lrt_cost;
+      lvectort_weightCost[lui_i] =
+	aivectort_weight[lui_i] * lvectort_costNearest[lui_i];
+    }
+  }
+
+  return lovectorui_idxSeeds;
+  
+} /*kmeansppSelect*/
+
+
+/*! \class CostSeedsInstances
+  \brief Cost of an instance to a seed for clusteringop::kmeansppSelect, the squared distance
+  \details The value of dist::EuclideanSquared and dist::Induced is used as it is, the value of the other distances is squared
+*/
+template < typename T_FEATURE,
+	   typename T_REAL,
+	   typename INPUT_ITERATOR
+	   >
+class CostSeedsInstances {
+public:
+  CostSeedsInstances
+  (const INPUT_ITERATOR               aiiterator_instfirst,
+   const dist::Dist<T_REAL,T_FEATURE> &aifunc2p_dist
+   )
+    : _iterator_instfirst(aiiterator_instfirst)
+    , _func2p_dist(aifunc2p_dist)
+    , _b_squared
+      ( dynamic_cast<const dist::EuclideanSquared<T_REAL,T_FEATURE>*>(&aifunc2p_dist) != NULL
+#if  DATATYPE_CENTROIDS_ROUND == 0
+	|| ( dynamic_cast<const dist::Induced<T_REAL,T_FEATURE>*>(&aifunc2p_dist) != NULL
+	     && dynamic_cast<const dist::InducedSquareRoot<T_REAL,T_FEATURE>*>(&aifunc2p_dist) == NULL )
+#endif /*DATATYPE_CENTROIDS_ROUND*/
+	)
+  {}
+  
+  inline T_REAL operator() (const uintidx aiui_i, const uintidx aiui_j) const
+  {
+    const T_REAL lrt_dist =
+      this->_func2p_dist
+      ((*std::next(this->_iterator_instfirst,aiui_i))->getFeatures(),
+       (*std::next(this->_iterator_instfirst,aiui_j))->getFeatures(),
+       data::Instance<T_FEATURE>::getNumDimensions()
+       );
+    return ( this->_b_squared )?lrt_dist:lrt_dist * lrt_dist;
+  }
+
+protected:
+  INPUT_ITERATOR                     _iterator_instfirst;
+  const dist::Dist<T_REAL,T_FEATURE> &_func2p_dist;
+  bool                               _b_squared;
+  
+}; /*CostSeedsInstances*/
+
+
+/*! \class Seeds
+  \brief Seeds of the initial population of an algorithm, random, k-means++ \cite Arthur:Vassilvitskii:kmeanspp:2007 or k-means|| \cite Bahmani:etal:kmeansparallel:2012
+  \details For k-means|| the candidates are sampled once in the constructor, in a few rounds that each add about aid_oversampling instances with probability proportional to their cost, and weighted with the number of instances nearest to them. Each call to select reduces the candidates to the seeds of a chromosome with k-means++, so the chromosomes of a population share the passes over the data set
+
+  \code{.cpp}
+  const clusteringop::CostSeedsInstances<T_FEATURE,T_REAL,INPUT_ITERATOR>
+    lcostseeds_instances(aiiterator_instfirst,aifunc2p_dist);
+  const clusteringop::Seeds<T_REAL>
+    lseeds_initial
+    (aiinp_inParamPcPmFk.getOpInitialization(),
+     lui_numInstances,
+     aiinp_inParamPcPmFk.getOversamplingInitialization() * lui_numClusterK,
+     aiinp_inParamPcPmFk.getRoundsInitialization(),
+     lcostseeds_instances
+     );
+
+  clusteringop::seedsInitialize
+    (lmatrixrowt_centroidsChrom,
+     aiiterator_instfirst,
+     lseeds_initial.select(lui_numClusterK,lcostseeds_instances)
+     );
+  \endcode
+*/
+template < typename T_REAL >
+class Seeds {
+public:
+  /*! \fn Seeds(const int aii_opSeeds, const uintidx aiui_numInstances, const double aid_oversampling, const uintidx aiui_numRounds, FUNCTION_COST aifunc_cost)
+    \param aii_opSeeds CLUSTERINGOP_SEEDS_RANDOM, CLUSTERINGOP_SEEDS_KMEANSPP or CLUSTERINGOP_SEEDS_KMEANSPARALLEL
+    \param aiui_numInstances number of instances
+    \param aid_oversampling expected number of candidates added in each round of k-means||
+    \param aiui_numRounds number of rounds of k-means||
+    \param aifunc_cost function (i,j) with the cost of the instance i to the instance j, see kmeansppSelect
+  */
+  template < typename FUNCTION_COST >
+  Seeds
+  (const int      aii_opSeeds,
+   const uintidx  aiui_numInstances,
+   const double   aid_oversampling,
+   const uintidx  aiui_numRounds,
+   FUNCTION_COST  aifunc_cost
+   )
+    : _i_opSeeds(aii_opSeeds)
+    , _ui_numInstances(aiui_numInstances)
+    , _vectorui_idxCandidates()
+    , _vectort_weightCandidates()
+  {
+    if ( aii_opSeeds == CLUSTERINGOP_SEEDS_KMEANSPARALLEL && aiui_numInstances > 0 )
+      this->sampleCandidates(aid_oversampling,aiui_numRounds,aifunc_cost);
+  }
+
+  inline bool isRandom() const
+  {
+    return this->_i_opSeeds == CLUSTERINGOP_SEEDS_RANDOM;
+  }
+
+  inline uintidx getNumCandidates() const
+  {
+    return (uintidx) this->_vectorui_idxCandidates.size();
+  }
+
+  /*! \fn std::vector<uintidx> select(const uintidx aiui_numSeeds, FUNCTION_COST aifunc_cost) const
+    \brief Indices of the instances selected as seeds, different while there are instances with cost greater than 0
+  */
+  template < typename FUNCTION_COST >
+  std::vector<uintidx>
+  select(const uintidx aiui_numSeeds, FUNCTION_COST aifunc_cost) const
+  {
+    if ( this->_i_opSeeds == CLUSTERINGOP_SEEDS_RANDOM ) {
+      std::uniform_int_distribution<uintidx> luniformdis_uiidxInstances0n
+	(0,this->_ui_numInstances-1);
+      std::unordered_set<uintidx>&& lunorderedset_idxRandInstances =
+	prob::getWithoutRepeatsSet
+	( std::min(aiui_numSeeds,this->_ui_numInstances)
+	  ,[&]() -> uintidx
+	  { 
+	    return luniformdis_uiidxInstances0n(gmt19937_eng);
+	  }
+	  );
+      return std::vector<uintidx>
+	(lunorderedset_idxRandInstances.begin(),lunorderedset_idxRandInstances.end());
+    }
+
+    /*k-means|| WITHOUT ENOUGH CANDIDATES SELECTS FROM ALL INSTANCES
+     */
+    if ( this->_i_opSeeds == CLUSTERINGOP_SEEDS_KMEANSPP
+	 || this->_vectorui_idxCandidates.size() < aiui_numSeeds ) {
+      return kmeansppSelect
+	(aiui_numSeeds,
+	 std::vector<T_REAL>(this->_ui_numInstances,T_REAL(1)),
+	 aifunc_cost
+	 );
+    }
+
+    std::vector<uintidx>&& lvectorui_idxSeeds =
+      kmeansppSelect
+      (aiui_numSeeds,
+       this->_vectort_weightCandidates,
+       [&](const uintidx aiui_i, const uintidx aiui_j) -> T_REAL
+       {
+	 return aifunc_cost
+	   (this->_vectorui_idxCandidates[aiui_i],
+	    this->_vectorui_idxCandidates[aiui_j]
+	    );
+       }
+       );
+    for ( auto& lui_idxSeed: lvectorui_idxSeeds )
+      lui_idxSeed = this->_vectorui_idxCandidates[lui_idxSeed];
+    
+    return lvectorui_idxSeeds;
+  }
+
+protected:
+
+  template < typename FUNCTION_COST >
+  void sampleCandidates
+  (const double   aid_oversampling,
+   const uintidx  aiui_numRounds,
+   FUNCTION_COST  aifunc_cost
+   )
+  {
+    std::vector<T_REAL>  lvectort_costNearest
+      (this->_ui_numInstances,std::numeric_limits<T_REAL>::max());
+    std::vector<uintidx> lvectorui_idxNearest(this->_ui_numInstances,0);
+    std::uniform_int_distribution<uintidx> luniformdis_uiidxInstances0n
+      (0,this->_ui_numInstances-1);
+    std::uniform_real_distribution<double> luniformdis_real01(0.0,1.0);
+    const long ll_numInstances = (long) this->_ui_numInstances;
+
+    std::vector<uintidx> lvectorui_idxNew
+      (1,luniformdis_uiidxInstances0n(gmt19937_eng));
+    
+    for (uintidx lui_round = 0; lui_round <= aiui_numRounds; lui_round++) {
+
+      /*COST OF EACH INSTANCE TO THE NEAREST CANDIDATE
+       */
+      const uintidx lui_idxFirstNew = (uintidx) this->_vectorui_idxCandidates.size();
+      this->_vectorui_idxCandidates.insert
+	(this->_vectorui_idxCandidates.end(),lvectorui_idxNew.begin(),lvectorui_idxNew.end());
+#pragma omp parallel for schedule(static) if(this->_ui_numInstances >= CLUSTERINGOP_SEEDS_MIN_PARALLEL)
+      for ( long ll_i = 0; ll_i < ll_numInstances; ll_i++) {
+	const uintidx lui_i = (uintidx) ll_i;
+	for ( uintidx lui_c = lui_idxFirstNew; lui_c < this->_vectorui_idxCandidates.size(); lui_c++) {
+	  const uintidx lui_idxCandidate = this->_vectorui_idxCandidates[lui_c];
+	  const T_REAL  lrt_cost =
+	    ( lui_idxCandidate == lui_i )?T_REAL(0):aifunc_cost(lui_i,lui_idxCandidate);
+	  if ( lrt_cost < lvectort_costNearest[lui_i] ) {
+	    lvectort_costNearest[lui_i] = lrt_cost;
+	    lvectorui_idxNearest[lui_i] = lui_c;
+	  }
+	}
+      }
+      if ( lui_round == aiui_numRounds )
+	break;
+      
+      /*EACH INSTANCE IS A NEW CANDIDATE WITH PROBABILITY
+	l * cost / total cost
+       */
+      const T_REAL lrt_costTotal =
+	std::accumulate(lvectort_costNearest.begin(),lvectort_costNearest.end(),T_REAL(0));
+      if ( !(lrt_costTotal > T_REAL(0)) )
+	break;
+      lvectorui_idxNew.clear();
+      for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) {
+	if ( luniformdis_real01(gmt19937_eng) * lrt_costTotal
+	     < aid_oversampling * lvectort_costNearest[lui_i] )
+	  lvectorui_idxNew.push_back(lui_i);
+      }
+    }
+
+    /*WEIGHT OF A CANDIDATE, THE INSTANCES NEAREST TO IT
+     */
+    this->_vectort_weightCandidates.assign(this->_vectorui_idxCandidates.size(),T_REAL(0));
+    for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) 
+      this->_vectort_weightCandidates[lvectorui_idxNearest[lui_i]] += T_REAL(1);
+  }
+  
+  int                  _i_opSeeds;
+  uintidx              _ui_numInstances;
+  std::vector<uintidx> _vectorui_idxCandidates;
+  std::vector<T_REAL>  _vectort_weightCandidates;
+  
+}; /*Seeds*/
+
+
+/*! \fn void seedsInitialize(mat::MatrixBase<T_FEATURE> &aomatrixt_centroids, const INPUT_ITERATOR aiiterator_instfirst, const std::vector<uintidx> &aivectorui_idxSeeds)
+    \brief Initialize the centroids with the instances selected as seeds, see clusteringop::Seeds
+    \param aomatrixt_centroids a mat::MatrixBase with the centroids of each cluster
+    \param aiiterator_instfirst a iterator with the instances
+    \param aivectorui_idxSeeds the index of an instance for each centroid
+ */
+template < typename T_FEATURE,
+	   typename INPUT_ITERATOR
+	   > 
+void
+seedsInitialize
+(mat::MatrixBase<T_FEATURE>  &aomatrixt_centroids,
+ const INPUT_ITERATOR        aiiterator_instfirst,
+ const std::vector<uintidx>  &aivectorui_idxSeeds
+ )
+{
+  for (uintidx li_j = 0; li_j < aomatrixt_centroids.getNumRows(); li_j++) { 
+    data::Instance<T_FEATURE>* liter_iInstance =
+      *std::next(aiiterator_instfirst,aivectorui_idxSeeds.at(li_j));
+    interfacesse::copy
+      (aomatrixt_centroids.getRow(li_j),
+       liter_iInstance->getFeatures(),
+       data::Instance<T_FEATURE>::getNumDimensions()
+       );
+  }
+} /*seedsInitialize*/
+
+
+/*! \fn void seedsInitialize(mat::MatrixBase<T_FEATURE> &aomatrixt_centroids, T_CLUSTERIDX *aoarraycidx_memberShip, std::vector<T_INSTANCES_CLUSTER_K> &aovectorit_numInstClusterK, const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const std::vector<uintidx> &aivectorui_idxSeeds)
+    \brief Initialize the centroids and labels with the instances selected as seeds, as randomInitialize
+    \param aomatrixt_centroids a mat::MatrixBase with the centroids of each cluster
+    \param aoarraycidx_memberShip a T_CLUSTERIDX
+    \param aovectorit_numInstClusterK a std::vector
+    \param aiiterator_instfirst a input iterator of the instances
+    \param aiiterator_instlast a  const input iterator of the instances
+    \param aivectorui_idxSeeds the index of an instance for each centroid
+ */
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX,
+	   typename INPUT_ITERATOR
+	   > 
+void
+seedsInitialize
+(mat::MatrixBase<T_FEATURE>         &aomatrixt_centroids,
+ T_CLUSTERIDX                       *aoarraycidx_memberShip,
+ std::vector<T_INSTANCES_CLUSTER_K> &aovectorit_numInstClusterK,
+ const INPUT_ITERATOR               aiiterator_instfirst,
+ const INPUT_ITERATOR               aiiterator_instlast,
+ const std::vector<uintidx>         &aivectorui_idxSeeds
+ )
+{
+  interfacesse::copya
+    (aoarraycidx_memberShip,
+     T_CLUSTERIDX(NEARESTCENTROID_UNKNOWN),
+     uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast))
+     );
+
+  seedsInitialize
+    (aomatrixt_centroids,
+     aiiterator_instfirst,
+     aivectorui_idxSeeds
+     );
+
+  for (uintidx li_j = 0; li_j < aomatrixt_centroids.getNumRows(); li_j++) {
+    aoarraycidx_memberShip[aivectorui_idxSeeds[li_j]] = (T_CLUSTERIDX) li_j;
+    aovectorit_numInstClusterK[li_j] = 1;
+  }
+} /*seedsInitialize*/
+
+
 
 /*! \fn void randomInitialize(mat::MatrixBase<T_FEATURE> &aomatrixt_centroids, T_CLUSTERIDX *aoarraycidx_memberShip, std::vector<T_INSTANCES_CLUSTER_K> &aovectorit_numInstClusterK, INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast)
     \brief Initialize the centroids and labels by selecting random instances.
@@ -426,7 +827,6 @@ reassignCluster
  ) 
 {
   uintidx      louintidx_threshold = 0; 
-  T_DIST       lT_distMinCentInst;
   
 #ifdef __VERBOSE_YES
   const uintidx  lui_numInstances =
@@ -447,24 +847,28 @@ reassignCluster
   }
 #endif //__VERBOSE_YES 
 
-  for (; aiiterator_instfirst != aiiterator_instlast;
-       aiiterator_instfirst++, aioarraycidx_memberShip++)
-    {
-    data::Instance<T_FEATURE>* linst_inter =
-      (data::Instance<T_FEATURE>*) *aiiterator_instfirst;
-    T_CLUSTERIDX lmgidx_j = 
-      nearest::NN
-      <T_CLUSTERIDX,T_FEATURE,T_DIST>
-      (lT_distMinCentInst,
-       aimatrixt_centroids,
-       linst_inter->getFeatures(),
-       aifunc2p_dist
+  nearest::DistBlock<T_FEATURE,T_DIST>
+    ldistblock_centInst(aimatrixt_centroids,aifunc2p_dist);
+  std::vector<T_CLUSTERIDX> lvectorcidx_nearest(ldistblock_centInst.getNumInstBlock());
+  std::vector<T_DIST>       lvectorT_distMinCentInst(ldistblock_centInst.getNumInstBlock());
+  
+  while ( aiiterator_instfirst != aiiterator_instlast ) {
+    uintidx lui_numInstBlock =
+      ldistblock_centInst.NN
+      (lvectorcidx_nearest.data(),
+       lvectorT_distMinCentInst.data(),
+       aiiterator_instfirst,
+       aiiterator_instlast
        );
-    if ( *aioarraycidx_memberShip != lmgidx_j ) {
-      *aioarraycidx_memberShip = lmgidx_j;
-      ++louintidx_threshold;
+    for (uintidx lui_i = 0; lui_i < lui_numInstBlock;
+	 lui_i++, aioarraycidx_memberShip++) {
+      T_CLUSTERIDX lmgidx_j = lvectorcidx_nearest[lui_i];
+      if ( *aioarraycidx_memberShip != lmgidx_j ) {
+	*aioarraycidx_memberShip = lmgidx_j;
+	++louintidx_threshold;
+      }
     }
-  } //END FOR
+  } //END WHILE
 
 #ifdef __VERBOSE_YES
   if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -1063,32 +1467,37 @@ updateCentroids
   }
 #endif /*__VERBOSE_YES*/
  
-  T_DIST  lT_distMinCentInst;
- 
   const T_FEATURE lT_alpha = T_FEATURE(1);
+
+  nearest::DistBlock<T_FEATURE,T_DIST>
+    ldistblock_centInst(aiomatrixt_centroids,aifunc2p_dist);
+  std::vector<T_CLUSTERIDX> lvectorcidx_nearest(ldistblock_centInst.getNumInstBlock());
+  std::vector<T_DIST>       lvectorT_distMinCentInst(ldistblock_centInst.getNumInstBlock());
   
-  for (; aiiterator_instfirst != aiiterator_instlast; ++aiiterator_instfirst) {
-    
-    const T_FEATURE* linst_inter =
-      ((data::Instance<T_FEATURE>*) *aiiterator_instfirst)->getFeatures();
+  while ( aiiterator_instfirst != aiiterator_instlast ) {
 
-    T_CLUSTERIDX lmgidx_j = 
-      nearest::NN
-      <T_CLUSTERIDX,T_FEATURE,T_DIST>
-      (lT_distMinCentInst,
-       aiomatrixt_centroids,
-       linst_inter,
-       aifunc2p_dist
-       );
-    aovectort_numInstancesInClusterK[lmgidx_j]++;
-    T_FEATURE_SUM   *larrarrowt_sumInstancesCluster = 
-      aomatrixt_sumInstancesCluster.getRow(lmgidx_j);
-    interfacesse::axpy
-      (larrarrowt_sumInstancesCluster,
-       lT_alpha,
-       linst_inter,
-       data::Instance<T_FEATURE>::getNumDimensions()
+    INPUT_ITERATOR liiterator_block = aiiterator_instfirst;
+    uintidx lui_numInstBlock =
+      ldistblock_centInst.NN
+      (lvectorcidx_nearest.data(),
+       lvectorT_distMinCentInst.data(),
+       aiiterator_instfirst,
+       aiiterator_instlast
        );
+    for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++, ++liiterator_block) {
+      const T_FEATURE* linst_inter =
+	((data::Instance<T_FEATURE>*) *liiterator_block)->getFeatures();
+      T_CLUSTERIDX lmgidx_j = lvectorcidx_nearest[lui_i];
+      aovectort_numInstancesInClusterK[lmgidx_j]++;
+      T_FEATURE_SUM   *larrarrowt_sumInstancesCluster = 
+	aomatrixt_sumInstancesCluster.getRow(lmgidx_j);
+      interfacesse::axpy
+	(larrarrowt_sumInstancesCluster,
+	 lT_alpha,
+	 linst_inter,
+	 data::Instance<T_FEATURE>::getNumDimensions()
+	 );
+    }
   }
    
   meanCentroids
@@ -23,7 +23,7 @@
 
 #include "verbose_global.hpp"
 
-extern StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace clusteringop
   \brief Clustering operators
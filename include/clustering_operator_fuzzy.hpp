@@ -15,10 +15,11 @@
 
 #include "random_ext.hpp"
 #include "matrix_operation.hpp"
+#include "nearestcentroids_block.hpp"
 #include "verbose_global.hpp"
 
 
-extern StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace clusteringop
   \brief Clustering operators
@@ -145,58 +146,34 @@ fuzzyPartition
      lui_numInstances
      );
     
-  T_REAL lrt_Dik;
-  T_REAL lrt_Djk;
-  T_REAL lrt_DikU;
-  T_REAL lrt_sumDjkU;
+  nearest::DistBlock<T_FEATURE,T_REAL>
+    ldistblock_centInst(aimatrixt_centroids,aifunc2p_distSquare);
+  std::vector<T_REAL> lvectorrt_DjiU(aimatrixt_centroids.getNumRows());
   
+  /*i \in {1, 2, ...,n}*/
+  uintidx lui_i = 0;
+  while ( aiiterator_instfirst != aiiterator_instlast ) {
 
-  /*j \in {1, 2, ...,k}*/
-  for ( uintidx lui_j = 0; lui_j < aimatrixt_centroids.getNumRows(); lui_j++)  {
+    uintidx lui_numInstBlock =
+      ldistblock_centInst.tile(aiiterator_instfirst,aiiterator_instlast);
+    const mat::MatrixRow<T_REAL>& lmatrixrt_D = ldistblock_centInst.getTile();
     
-    T_REAL*   lmrt_uRow_j     = aomatrixt_u.getRow(lui_j);
-    const T_FEATURE*  lmrt_centroid_j = aimatrixt_centroids.getRow(lui_j); 
-
-    /*i \in {1, 2, ...,n}*/
-    uintidx lui_i = 0;
-    for ( INPUT_ITERATOR liiterator_instfirst = aiiterator_instfirst;
-	 liiterator_instfirst != aiiterator_instlast;
-	 ++liiterator_instfirst, lui_i++)
-      {
-
-      T_FEATURE* linst_features_i =
-	((data::Instance<T_FEATURE>*) *liiterator_instfirst)->getFeatures();
-      
-      lrt_Dik = aifunc2p_distSquare
-	(lmrt_centroid_j,
-	 linst_features_i,
-	 data::Instance<T_FEATURE>::getNumDimensions()
-	 );
-
-      if ( lrt_Dik == T_REAL(0.0) ) 
-	lrt_Dik = std::numeric_limits<T_REAL>::epsilon();
-  
-      lrt_DikU = 1.0 / std::pow(lrt_Dik, lrt_p);
-      lrt_sumDjkU = 0.0;
+    for (uintidx lui_b = 0; lui_b < lui_numInstBlock; lui_b++, lui_i++) {
+      const T_REAL* lmrt_Di = lmatrixrt_D.getRow(lui_b);
+      T_REAL        lrt_sumDjkU = 0.0;
       /*l \in {1, 2, ...,k}*/
       for ( uintidx lui_l = 0; lui_l < aimatrixt_centroids.getNumRows(); lui_l++)  { 
-	const T_FEATURE*  lmrT_centroid_l = aimatrixt_centroids.getRow(lui_l); 
-	
-        lrt_Djk =
-	  aifunc2p_distSquare
-	  (lmrT_centroid_l,
-	   linst_features_i,
-	   data::Instance<T_FEATURE>::getNumDimensions()
-	   );
-
-	if ( lrt_Djk == T_REAL(0.0) ) 
-	  lrt_Djk = std::numeric_limits<T_REAL>::epsilon();
-
-	lrt_sumDjkU += 1.0 / std::pow(lrt_Djk, lrt_p);
+	T_REAL lrt_Dlk = lmrt_Di[lui_l];
+	if ( lrt_Dlk == T_REAL(0.0) ) 
+	  lrt_Dlk = std::numeric_limits<T_REAL>::epsilon();
+	lvectorrt_DjiU[lui_l] = 1.0 / std::pow(lrt_Dlk, lrt_p);
+	lrt_sumDjkU += lvectorrt_DjiU[lui_l];
       } /*END for lui_l*/
-      lmrt_uRow_j[lui_i] = lrt_DikU / lrt_sumDjkU;
-    } /*END for lui_i*/
-  } /*END for lui_j*/
+      /*j \in {1, 2, ...,k}*/
+      for ( uintidx lui_j = 0; lui_j < aimatrixt_centroids.getNumRows(); lui_j++)
+	aomatrixt_u(lui_j,lui_i) = lvectorrt_DjiU[lui_j] / lrt_sumDjkU;
+    } /*END for lui_b*/
+  } /*END while block*/
 
 #ifdef __VERBOSE_YES
   if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -15,7 +15,13 @@
 #include <iostream>
 #include <new>
 #include <iterator>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 #include "disjsets.hpp"
+#include "matrix.hpp"
 #include "container_out.hpp"
 #include "verbose_global.hpp"
 
@@ -344,6 +350,194 @@ slink
   
 }
 
+/*! \fn void slink1D(uintidx *aoarrayiu_pi, T_REAL *aoarrayrt_lambda, const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, FUNCTION_GETATTRIBUTE function_getAttribute)
+  \brief Pointer representation of the single-link hierarchy when the distance is the difference of one attribute
+  \details The pointer representation of slink with the distance |a - b| in O(n log n) instead of O(n^2). In one dimension a cluster is an interval of the sorted values, the intervals are joined at the gaps between neighbors from the smallest gap. When an instance stops being the last (largest index) of its cluster at the level lambda, pi is the last instance of the cluster at that level \cite{Sibson1973:HierarchicalCluster:SLINK:1973}. Without ties in the gaps pi and lambda are those of slink, with ties slink can point to another instance of the same cluster, both give the same hierarchy with pointerToDisjSets
+  \param aoarrayiu_pi array of n indices, the output pi
+  \param aoarrayrt_lambda array of n levels, the output lambda
+  \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+  \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+  \param function_getAttribute a function to obtain the attribute of an instance
+*/
+template  <typename T_REAL,
+	   typename INPUT_ITERATOR,
+	   typename FUNCTION_GETATTRIBUTE
+	   >
+void 
+slink1D
+(uintidx                   *aoarrayiu_pi,
+ T_REAL                    *aoarrayrt_lambda,
+ const INPUT_ITERATOR      aiiterator_instfirst,
+ const INPUT_ITERATOR      aiiterator_instlast,
+ FUNCTION_GETATTRIBUTE     function_getAttribute
+ )
+{
+  typedef typename std::decay
+    <decltype(function_getAttribute(*aiiterator_instfirst))>::type T_FEATURE;
+  
+  const uintidx lui_nobj(uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)));
+
+  std::vector<T_FEATURE> lvectort_attribute;
+  lvectort_attribute.reserve(lui_nobj);
+  for (auto liter_inst = aiiterator_instfirst; liter_inst != aiiterator_instlast; ++liter_inst)
+    lvectort_attribute.push_back(function_getAttribute(*liter_inst));
+
+  std::vector<uintidx> lvectorui_sorted(lui_nobj);
+  std::iota(lvectorui_sorted.begin(),lvectorui_sorted.end(),0);
+  std::stable_sort
+    (lvectorui_sorted.begin(),
+     lvectorui_sorted.end(),
+     [&](const uintidx aiui_a, const uintidx aiui_b)
+     {
+       return lvectort_attribute[aiui_a] < lvectort_attribute[aiui_b];
+     }
+     );
+
+  /*GAPS BETWEEN NEIGHBORS IN THE SORTED ORDER, FROM THE SMALLEST
+   */
+  std::vector<std::pair<T_REAL,uintidx> > lvectorpair_gapPos;
+  lvectorpair_gapPos.reserve(lui_nobj);
+  for (uintidx lui_p = 1; lui_p < lui_nobj; lui_p++)
+    lvectorpair_gapPos.emplace_back
+      (T_REAL(std::abs(lvectort_attribute[lvectorui_sorted[lui_p]]
+		       - lvectort_attribute[lvectorui_sorted[lui_p-1]])),
+       lui_p);
+  std::sort(lvectorpair_gapPos.begin(),lvectorpair_gapPos.end());
+
+  /*UNION-FIND OF THE INSTANCES WITH THE LAST INSTANCE OF EACH CLUSTER
+   */
+  std::vector<uintidx> lvectorui_parent(lui_nobj);
+  std::vector<uintidx> lvectorui_last(lui_nobj);
+  std::iota(lvectorui_parent.begin(),lvectorui_parent.end(),0);
+  std::iota(lvectorui_last.begin(),lvectorui_last.end(),0);
+  auto lfunc_find =
+    [&](uintidx aiui_x)
+    {
+      while ( lvectorui_parent[aiui_x] != aiui_x ) {
+	lvectorui_parent[aiui_x] = lvectorui_parent[lvectorui_parent[aiui_x]];
+	aiui_x = lvectorui_parent[aiui_x];
+      }
+      return aiui_x;
+    };
+  
+  for (uintidx lui_i = 0; lui_i < lui_nobj; lui_i++) {
+    aoarrayiu_pi[lui_i]     = lui_i;
+    aoarrayrt_lambda[lui_i] = std::numeric_limits<T_REAL>::max();
+  }
+
+  /*THE GAPS OF THE SAME SIZE JOIN THE CLUSTERS AT THE SAME LEVEL
+   */
+  std::vector<uintidx> lvectorui_lastJoined;
+  uintidx lui_g = 0;
+  while ( lui_g < lvectorpair_gapPos.size() ) {
+    const T_REAL lrt_level = lvectorpair_gapPos[lui_g].first;
+    lvectorui_lastJoined.clear();
+    for ( ; lui_g < lvectorpair_gapPos.size() &&
+	    !(lrt_level < lvectorpair_gapPos[lui_g].first); lui_g++ ) {
+      const uintidx lui_p = lvectorpair_gapPos[lui_g].second;
+      const uintidx lui_rootA = lfunc_find(lvectorui_sorted[lui_p-1]);
+      const uintidx lui_rootB = lfunc_find(lvectorui_sorted[lui_p]);
+      lvectorui_lastJoined.push_back(lvectorui_last[lui_rootA]);
+      lvectorui_lastJoined.push_back(lvectorui_last[lui_rootB]);
+      lvectorui_parent[lui_rootA] = lui_rootB;
+      lvectorui_last[lui_rootB] =
+	std::max(lvectorui_last[lui_rootA],lvectorui_last[lui_rootB]);
+    }
+    for ( const uintidx lui_last: lvectorui_lastJoined ) {
+      const uintidx lui_lastCluster = lvectorui_last[lfunc_find(lui_last)];
+      if ( lui_lastCluster != lui_last ) {
+	aoarrayiu_pi[lui_last]     = lui_lastCluster;
+	aoarrayrt_lambda[lui_last] = lrt_level;
+      }
+    }
+  }
+  
+}
+
+/*! \class SingleLinkSegments1D
+  \brief Single-link clusters of the instances by one attribute, for any number of clusters K
+  \details The values of the attribute are sorted once, the clusters for K are the intervals between the K-1 largest gaps of neighbors. As pointerToDisjSets, the gaps of the same size are joined together, so there are fewer than K clusters when a tie crosses K
+*/
+template  <typename T_FEATURE>
+class SingleLinkSegments1D {
+public:
+  template <typename INPUT_ITERATOR,
+	    typename FUNCTION_GETATTRIBUTE
+	    >
+  SingleLinkSegments1D
+  (const INPUT_ITERATOR  aiiterator_instfirst,
+   const INPUT_ITERATOR  aiiterator_instlast,
+   FUNCTION_GETATTRIBUTE function_getAttribute
+   )
+  {
+    for (auto liter_inst = aiiterator_instfirst; liter_inst != aiiterator_instlast; ++liter_inst)
+      this->_vectort_sorted.push_back(function_getAttribute(*liter_inst));
+    std::sort(this->_vectort_sorted.begin(),this->_vectort_sorted.end());
+
+    /*FROM THE LARGEST GAP
+     */
+    this->_vectorpair_gapPos.reserve(this->_vectort_sorted.size());
+    for (uintidx lui_p = 1; lui_p < this->_vectort_sorted.size(); lui_p++)
+      this->_vectorpair_gapPos.emplace_back
+	(this->_vectort_sorted[lui_p] - this->_vectort_sorted[lui_p-1],lui_p);
+    std::stable_sort
+      (this->_vectorpair_gapPos.begin(),
+       this->_vectorpair_gapPos.end(),
+       [](const std::pair<T_FEATURE,uintidx> &aipair_a, const std::pair<T_FEATURE,uintidx> &aipair_b)
+       {
+	 return aipair_b.first < aipair_a.first;
+       }
+       );
+  }
+
+  /*! \fn mat::MatrixRow<T_FEATURE> getKSegments(const uintidx aiui_numClusterK) const
+    \brief Minimum and maximum of the attribute in each cluster, a row per cluster in increasing order of the attribute
+    \details O(K log K)
+    \param aiui_numClusterK number of clusters
+  */
+  mat::MatrixRow<T_FEATURE> getKSegments(const uintidx aiui_numClusterK) const
+  {
+    const uintidx lui_numGaps = uintidx(this->_vectorpair_gapPos.size());
+    uintidx lui_numCuts = lui_numGaps;
+
+    if ( this->_vectort_sorted.empty() )
+      return mat::MatrixRow<T_FEATURE>(0,2);
+    
+    if ( aiui_numClusterK <= lui_numGaps ) {
+      /*THE GAPS UP TO THE LEVEL OF THE (n-K)-TH SMALLEST ARE JOINED
+       */
+      lui_numCuts = aiui_numClusterK > 0?aiui_numClusterK - 1:0;
+      const T_FEATURE lt_level = this->_vectorpair_gapPos[lui_numCuts].first;
+      while ( lui_numCuts > 0 &&
+	      !(lt_level < this->_vectorpair_gapPos[lui_numCuts-1].first) )
+	--lui_numCuts;
+    }
+
+    std::vector<uintidx> lvectorui_cuts;
+    lvectorui_cuts.reserve(lui_numCuts + 1);
+    for (uintidx lui_c = 0; lui_c < lui_numCuts; lui_c++)
+      lvectorui_cuts.push_back(this->_vectorpair_gapPos[lui_c].second);
+    std::sort(lvectorui_cuts.begin(),lvectorui_cuts.end());
+    lvectorui_cuts.push_back(uintidx(this->_vectort_sorted.size()));
+
+    mat::MatrixRow<T_FEATURE> lomatrixrowt_minMaxKSegments
+      (uintidx(lvectorui_cuts.size()),uintidx(2));
+    uintidx lui_begin = 0;
+    for (uintidx lui_s = 0; lui_s < lvectorui_cuts.size(); lui_s++) {
+      lomatrixrowt_minMaxKSegments(lui_s,0) = this->_vectort_sorted[lui_begin];
+      lomatrixrowt_minMaxKSegments(lui_s,1) = this->_vectort_sorted[lvectorui_cuts[lui_s]-1];
+      lui_begin = lvectorui_cuts[lui_s];
+    }
+    
+    return lomatrixrowt_minMaxKSegments;
+  }
+
+protected:
+  std::vector<T_FEATURE>                   _vectort_sorted;
+  std::vector<std::pair<T_FEATURE,uintidx> > _vectorpair_gapPos;
+  
+}; /*SingleLinkSegments1D*/
+
 } /*END namespace clusteringop*/
 
 #endif /*__CLUSTERING_OPERATOR_HIERARCHICAL_HPP*/
@@ -14,6 +14,7 @@
 
 #include <utility>      // std::pair
 #include "dist_matrix_dissimilarity.hpp"
+#include "nearestinstance_operator.hpp"
 #include "instance.hpp"
 #include "partition_linked.hpp"
 
@@ -432,6 +433,13 @@ updateMedoids
   T_DIST lor_cost = T_DIST(0);
   bool lb_medoidChange;
 
+  /*THE TWO NEAREST MEDOIDS OF THE INSTANCES ARE FOUND ONCE, EACH
+    ITERATION ONLY LOOKS AT THE MEDOIDS THAT CHANGED
+   */
+  nearest::MedoidsTwoNN<T_CLUSTERIDX,T_DIST>
+    lmedoidstwonn_medoids(aimattriag_dissimilarity);
+  lmedoidstwonn_medoids.initialize(aioarrayui_idxMedoids,aicidx_numKMedoids);
+  
   do {
 
     lb_medoidChange = false;
@@ -439,13 +447,17 @@ updateMedoids
     /* Assign each object in X to the cluster Cj with the
       closest medoid under Euclidean distance metric.
     */
-    ds::PartitionLinked  <T_CLUSTERIDX>  lpartlink_partition;
-    std::tie(lor_cost, lpartlink_partition) =
-      nearestRepresentative
-      (aioarrayui_idxMedoids,
-       aicidx_numKMedoids,
-       aimattriag_dissimilarity
+    ds::PartitionLinked  <T_CLUSTERIDX>
+      lpartlink_partition
+      (aimattriag_dissimilarity.getNumRows(),
+       (uintidx) aicidx_numKMedoids
        );
+    lor_cost = T_DIST(0);
+    for (uintidx lui_i = 0; lui_i < aimattriag_dissimilarity.getNumRows(); lui_i++) {
+      lpartlink_partition.addInstanceToCluster
+	(lmedoidstwonn_medoids.getNearest(lui_i),lui_i);
+      lor_cost += lmedoidstwonn_medoids.getDistNearest(lui_i);
+    }
     lbitarray_medoidEvaluate.initialize();
     
     ds::IteratorPartitionLinked<T_CLUSTERIDX>   literpart_j(&lpartlink_partition);
@@ -559,6 +571,7 @@ updateMedoids
 	 */
 	if ( lui_idxInstNewMj != aioarrayui_idxMedoids[lcidx_Cj]  ) {
 	  aioarrayui_idxMedoids[lcidx_Cj] =  lui_idxInstNewMj; 
+	  lmedoidstwonn_medoids.changeMedoid(lcidx_Cj,lui_idxInstNewMj);
 	  lb_medoidChange = true;
 	}
 
@@ -0,0 +1,476 @@
+/*! \file coreset.hpp
+ *
+ * \brief coreset of weighted instances
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * Compress a large data set into a small set of instances with
+ * frequency, so the clustering algorithms for instances with
+ * frequency run on the compressed data set.
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __CORESET_HPP
+#define __CORESET_HPP
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <random>
+#include <limits>
+#include <cmath>
+#include <type_traits>
+#include "instance_frequency.hpp"
+#include "dist_euclidean.hpp"
+#include "random_ext.hpp"
+
+#include "verbose_global.hpp"
+
+extern thread_local StdMT19937  gmt19937_eng;
+
+/*! \namespace coreset
+  \brief Compression of a data set into weighted instances
+  \details Each instance of a coreset is a data::InstanceFreq, its frequency is the number of instances it represents
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace coreset {
+
+/*! \fn data::Instance<T_FEATURE>* newInstanceFreq(const T_FEATURE *aiarrayt_feature, const T_INSTANCE_FREQUENCY ait_frequency)
+    \brief Create a data::InstanceFreq with a copy of the features
+    \param aiarrayt_feature an array with the features
+    \param ait_frequency frequency of the instance
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCE_FREQUENCY
+	   >
+data::Instance<T_FEATURE>*
+newInstanceFreq
+(const T_FEATURE             *aiarrayt_feature,
+ const T_INSTANCE_FREQUENCY  ait_frequency
+ )
+{
+  data::InstanceFreq<T_FEATURE,T_INSTANCE_FREQUENCY>* lptinstfreq_new =
+    new data::InstanceFreq<T_FEATURE,T_INSTANCE_FREQUENCY>(ait_frequency);
+
+  std::copy
+    (aiarrayt_feature,
+     aiarrayt_feature + data::Instance<T_FEATURE>::getNumDimensions(),
+     lptinstfreq_new->getFeatures()
+     );
+
+  return lptinstfreq_new;
+}
+
+
+/*! \fn std::vector<data::Instance<T_FEATURE>* > dedup(INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const FUNCTIONFREQ func_freq)
+    \brief Merge the duplicated instances
+    \details The instances are sorted lexicographically, each run of equal instances is replaced by one instance whose frequency is the sum of the frequencies of the run. The result is exact for any objective weighted by frequency
+    \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+    \param func_freq a function that gets the frequency of an instance
+    \return a vector with new data::InstanceFreq, the caller deletes them
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCE_FREQUENCY,
+	   typename INPUT_ITERATOR,
+	   typename FUNCTIONFREQ
+	   >
+std::vector<data::Instance<T_FEATURE>* >
+dedup
+(INPUT_ITERATOR         aiiterator_instfirst,
+ const INPUT_ITERATOR   aiiterator_instlast,
+ const FUNCTIONFREQ     func_freq
+ )
+{
+#ifdef __VERBOSE_YES
+  const char* lpc_labelFunc = "coreset::dedup";
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+              << ":  IN(" << geiinparam_verbose << ")\n"
+	      << "(input INPUT_ITERATOR aiiterator_instfirst["
+	      << *aiiterator_instfirst << "]\n"
+	      << " input INPUT_ITERATOR aiiterator_instlast["
+	      << *aiiterator_instlast << "]\n"
+	      << ")"
+	      << std::endl;
+  }
+#endif //__VERBOSE_YES
+
+  const uintidx lui_numDim = data::Instance<T_FEATURE>::getNumDimensions();
+
+  std::vector<data::Instance<T_FEATURE>* >
+    lvectorptinst_sort(aiiterator_instfirst,aiiterator_instlast);
+  std::vector<data::Instance<T_FEATURE>* > lovectorptinst_coreset;
+
+  std::sort
+    (lvectorptinst_sort.begin(),
+     lvectorptinst_sort.end(),
+     [lui_numDim](const data::Instance<T_FEATURE>* aiinst_a,
+		  const data::Instance<T_FEATURE>* aiinst_b)
+     {
+       return std::lexicographical_compare
+	 (aiinst_a->getFeatures(),
+	  aiinst_a->getFeatures() + lui_numDim,
+	  aiinst_b->getFeatures(),
+	  aiinst_b->getFeatures() + lui_numDim
+	  );
+     }
+     );
+
+  auto literator_run = lvectorptinst_sort.begin();
+  while ( literator_run != lvectorptinst_sort.end() ) {
+    const T_FEATURE* lpt_featureRun = (*literator_run)->getFeatures();
+    T_INSTANCE_FREQUENCY lt_frequency = T_INSTANCE_FREQUENCY(0);
+    auto literator_inst = literator_run;
+    for ( ; literator_inst != lvectorptinst_sort.end() &&
+	    std::equal
+	    (lpt_featureRun,
+	     lpt_featureRun + lui_numDim,
+	     (*literator_inst)->getFeatures()
+	     );
+	  ++literator_inst ) {
+      lt_frequency += func_freq(*literator_inst);
+    }
+    lovectorptinst_coreset.push_back
+      (newInstanceFreq(lpt_featureRun,lt_frequency));
+    literator_run = literator_inst;
+  }
+
+#ifdef __VERBOSE_YES
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ": OUT(" << geiinparam_verbose << ")\n"
+	      << "size coreset = " << lovectorptinst_coreset.size()
+	      << std::endl;
+  }
+  --geiinparam_verbose;
+#endif //__VERBOSE_YES
+
+  return lovectorptinst_coreset;
+
+} /*END dedup*/
+
+
+/*! \struct HashCell
+  \brief Hash of the coordinates of a cell of the grid
+*/
+struct HashCell {
+  std::size_t operator()(const std::vector<long long> &aivectorll_cell) const
+  {
+    std::size_t lst_hash = 14695981039346656037ULL;
+    for ( auto ll_coord: aivectorll_cell ) {
+      lst_hash ^= std::hash<long long>()(ll_coord) + 0x9e3779b97f4a7c15ULL
+	+ (lst_hash << 6) + (lst_hash >> 2);
+    }
+    return lst_hash;
+  }
+}; /*HashCell*/
+
+
+/*! \fn std::vector<data::Instance<T_FEATURE>* > grid(INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const uintidx aiui_sizeCoreset, const FUNCTIONFREQ func_freq)
+    \brief Grid bucketing of the instances
+    \details The width of the cells is the same fraction of the range of each attribute. The fraction is searched by bisection, so the number of occupied cells is the largest that does not exceed aiui_sizeCoreset. Each occupied cell is replaced by the mean of its instances weighted by frequency, with the sum of the frequencies
+    \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+    \param aiui_sizeCoreset maximum number of instances of the coreset
+    \param func_freq a function that gets the frequency of an instance
+    \return a vector with new data::InstanceFreq, the caller deletes them
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCE_FREQUENCY,
+	   typename T_FEATURE_SUM,
+	   typename INPUT_ITERATOR,
+	   typename FUNCTIONFREQ
+	   >
+std::vector<data::Instance<T_FEATURE>* >
+grid
+(INPUT_ITERATOR         aiiterator_instfirst,
+ const INPUT_ITERATOR   aiiterator_instlast,
+ const uintidx          aiui_sizeCoreset,
+ const FUNCTIONFREQ     func_freq
+ )
+{
+#ifdef __VERBOSE_YES
+  const char* lpc_labelFunc = "coreset::grid";
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+              << ":  IN(" << geiinparam_verbose << ")\n"
+	      << "(input INPUT_ITERATOR aiiterator_instfirst["
+	      << *aiiterator_instfirst << "]\n"
+	      << " input INPUT_ITERATOR aiiterator_instlast["
+	      << *aiiterator_instlast << "]\n"
+	      << " input uintidx aiui_sizeCoreset[" << aiui_sizeCoreset << "]\n"
+	      << ")"
+	      << std::endl;
+  }
+#endif //__VERBOSE_YES
+
+  typedef std::unordered_map<std::vector<long long>,uintidx,HashCell> MapCell;
+
+  const uintidx lui_numDim = data::Instance<T_FEATURE>::getNumDimensions();
+
+  std::vector<double> lvectord_min
+    (lui_numDim,std::numeric_limits<double>::max());
+  std::vector<double> lvectord_range
+    (lui_numDim,std::numeric_limits<double>::lowest());
+
+  for (INPUT_ITERATOR literator_inst = aiiterator_instfirst;
+       literator_inst != aiiterator_instlast; ++literator_inst) {
+    const T_FEATURE* lpt_feature = (*literator_inst)->getFeatures();
+    for (uintidx lui_j = 0; lui_j < lui_numDim; lui_j++) {
+      lvectord_min[lui_j]   = std::min(lvectord_min[lui_j],double(lpt_feature[lui_j]));
+      lvectord_range[lui_j] = std::max(lvectord_range[lui_j],double(lpt_feature[lui_j]));
+    }
+  }
+  for (uintidx lui_j = 0; lui_j < lui_numDim; lui_j++)
+    lvectord_range[lui_j] -= lvectord_min[lui_j];
+
+  std::vector<long long> lvectorll_cell(lui_numDim);
+  auto lfunc_cell =
+    [&](const data::Instance<T_FEATURE>* aiinst_inst, const double aid_fraction)
+    {
+      const T_FEATURE* lpt_feature = aiinst_inst->getFeatures();
+      for (uintidx lui_j = 0; lui_j < lui_numDim; lui_j++) {
+	const double ld_width = aid_fraction * lvectord_range[lui_j];
+	lvectorll_cell[lui_j] = ( ld_width > 0.0 )?
+	  (long long) std::floor((double(lpt_feature[lui_j]) - lvectord_min[lui_j]) / ld_width)
+	  :0;
+      }
+    };
+
+  auto lfunc_numCells =
+    [&](const double aid_fraction) -> uintidx
+    {
+      MapCell lmap_cells;
+      for (INPUT_ITERATOR literator_inst = aiiterator_instfirst;
+	   literator_inst != aiiterator_instlast; ++literator_inst) {
+	lfunc_cell(*literator_inst,aid_fraction);
+	lmap_cells.emplace(lvectorll_cell,0);
+	if ( lmap_cells.size() > aiui_sizeCoreset )
+	  break;
+      }
+      return (uintidx) lmap_cells.size();
+    };
+
+  /*BISECTION OVER THE LOGARITHM OF THE FRACTION OF THE RANGE*/
+  double ld_fractionLow  = 1e-9;
+  double ld_fractionHigh = 1.0;
+  for (int li_iter = 0; li_iter < 24; li_iter++) {
+    const double ld_fractionMid = std::sqrt(ld_fractionLow * ld_fractionHigh);
+    if ( lfunc_numCells(ld_fractionMid) > aiui_sizeCoreset )
+      ld_fractionLow  = ld_fractionMid;
+    else
+      ld_fractionHigh = ld_fractionMid;
+  }
+
+  /*MEAN OF THE INSTANCES OF EACH CELL*/
+  MapCell lmap_cells;
+  std::vector<T_FEATURE_SUM>        lvectort_sum;
+  std::vector<T_INSTANCE_FREQUENCY> lvectort_frequency;
+
+  for (INPUT_ITERATOR literator_inst = aiiterator_instfirst;
+       literator_inst != aiiterator_instlast; ++literator_inst) {
+    lfunc_cell(*literator_inst,ld_fractionHigh);
+    auto lpair_cell = lmap_cells.emplace(lvectorll_cell,(uintidx) lvectort_frequency.size());
+    if ( lpair_cell.second ) {
+      lvectort_sum.resize(lvectort_sum.size() + lui_numDim, T_FEATURE_SUM(0));
+      lvectort_frequency.push_back(T_INSTANCE_FREQUENCY(0));
+    }
+    const uintidx         lui_cell     = lpair_cell.first->second;
+    const T_INSTANCE_FREQUENCY lt_freq = func_freq(*literator_inst);
+    const T_FEATURE*      lpt_feature  = (*literator_inst)->getFeatures();
+    T_FEATURE_SUM*        lpt_sum      = &lvectort_sum[lui_cell * lui_numDim];
+    for (uintidx lui_j = 0; lui_j < lui_numDim; lui_j++)
+      lpt_sum[lui_j] += T_FEATURE_SUM(lt_freq) * T_FEATURE_SUM(lpt_feature[lui_j]);
+    lvectort_frequency[lui_cell] += lt_freq;
+  }
+
+  std::vector<data::Instance<T_FEATURE>* > lovectorptinst_coreset;
+  lovectorptinst_coreset.reserve(lvectort_frequency.size());
+  std::vector<T_FEATURE> lvectort_mean(lui_numDim);
+
+  for (uintidx lui_cell = 0; lui_cell < lvectort_frequency.size(); lui_cell++) {
+    const T_FEATURE_SUM* lpt_sum = &lvectort_sum[lui_cell * lui_numDim];
+    for (uintidx lui_j = 0; lui_j < lui_numDim; lui_j++) {
+      const T_FEATURE_SUM lt_mean =
+	lpt_sum[lui_j] / T_FEATURE_SUM(lvectort_frequency[lui_cell]);
+      lvectort_mean[lui_j] = std::is_integral<T_FEATURE>::value?
+	T_FEATURE(std::round(lt_mean)):T_FEATURE(lt_mean);
+    }
+    lovectorptinst_coreset.push_back
+      (newInstanceFreq(lvectort_mean.data(),lvectort_frequency[lui_cell]));
+  }
+
+#ifdef __VERBOSE_YES
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ": OUT(" << geiinparam_verbose << ")\n"
+	      << "fraction of the range = " << ld_fractionHigh
+	      << "\nsize coreset = " << lovectorptinst_coreset.size()
+	      << std::endl;
+  }
+  --geiinparam_verbose;
+#endif //__VERBOSE_YES
+
+  return lovectorptinst_coreset;
+
+} /*END grid*/
+
+
+/*! \fn std::vector<data::Instance<T_FEATURE>* > sampling(INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const uintidx aiui_sizeCoreset, const uintidx aiui_numSeeds, const FUNCTIONFREQ func_freq)
+    \brief Importance sampling of the instances with k-means++ seeds
+    \details The seeds are chosen with probability proportional to the frequency times the squared distance to the nearest seed. Each instance \f$x\f$ with frequency \f$w_x\f$ and nearest seed \f$c(x)\f$ is sampled with probability
+    \f[ q(x) = \frac{1}{2} \frac{w_x d(x,c(x))^2}{\sum_y w_y d(y,c(y))^2} + \frac{1}{2} \frac{w_x}{k' W_{c(x)}} \f]
+    where \f$W_c\f$ is the frequency of the seed \f$c\f$. aiui_sizeCoreset draws with replacement are done, the frequency of an instance drawn \f$m_x\f$ times is \f$m_x w_x / (n q(x))\f$ rounded, at least 1
+    \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+    \param aiui_sizeCoreset number of draws
+    \param aiui_numSeeds number of seeds \f$k'\f$
+    \param func_freq a function that gets the frequency of an instance
+    \return a vector with new data::InstanceFreq, the caller deletes them
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCE_FREQUENCY,
+	   typename T_REAL,
+	   typename INPUT_ITERATOR,
+	   typename FUNCTIONFREQ
+	   >
+std::vector<data::Instance<T_FEATURE>* >
+sampling
+(INPUT_ITERATOR         aiiterator_instfirst,
+ const INPUT_ITERATOR   aiiterator_instlast,
+ const uintidx          aiui_sizeCoreset,
+ const uintidx          aiui_numSeeds,
+ const FUNCTIONFREQ     func_freq
+ )
+{
+#ifdef __VERBOSE_YES
+  const char* lpc_labelFunc = "coreset::sampling";
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+              << ":  IN(" << geiinparam_verbose << ")\n"
+	      << "(input INPUT_ITERATOR aiiterator_instfirst["
+	      << *aiiterator_instfirst << "]\n"
+	      << " input INPUT_ITERATOR aiiterator_instlast["
+	      << *aiiterator_instlast << "]\n"
+	      << " input uintidx aiui_sizeCoreset[" << aiui_sizeCoreset << "]\n"
+	      << " input uintidx aiui_numSeeds[" << aiui_numSeeds << "]\n"
+	      << ")"
+	      << std::endl;
+  }
+#endif //__VERBOSE_YES
+
+  const uintidx lui_numDim = data::Instance<T_FEATURE>::getNumDimensions();
+  const std::vector<data::Instance<T_FEATURE>* >
+    lvectorptinst_instances(aiiterator_instfirst,aiiterator_instlast);
+  const uintidx lui_numInstances = (uintidx) lvectorptinst_instances.size();
+
+  dist::EuclideanSquared<T_REAL,T_FEATURE> lfunc2p_distEuclideanSq;
+  std::vector<T_REAL>  lvectort_frequency(lui_numInstances);
+  std::vector<T_REAL>  lvectort_distMin
+    (lui_numInstances,std::numeric_limits<T_REAL>::max());
+  std::vector<uintidx> lvectorui_nearestSeed(lui_numInstances,0);
+
+  for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++)
+    lvectort_frequency[lui_i] = T_REAL(func_freq(lvectorptinst_instances[lui_i]));
+
+  /*K-MEANS++ SEEDS, THE FIRST IS CHOSEN WITH PROBABILITY PROPORTIONAL TO
+    THE FREQUENCY
+  */
+  const uintidx lui_numSeeds =
+    std::max(uintidx(1),std::min(aiui_numSeeds,lui_numInstances));
+  std::vector<T_REAL> lvectort_weightSeed(lvectort_frequency);
+
+  for (uintidx lui_s = 0; lui_s < lui_numSeeds; lui_s++) {
+    std::discrete_distribution<uintidx> ldiscrdis_seed
+      (lvectort_weightSeed.begin(),lvectort_weightSeed.end());
+    const T_FEATURE* lpt_seed =
+      lvectorptinst_instances[ldiscrdis_seed(gmt19937_eng)]->getFeatures();
+
+    bool lb_positive = false;
+    for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++) {
+      const T_REAL lt_dist =
+	lfunc2p_distEuclideanSq
+	(lvectorptinst_instances[lui_i]->getFeatures(),lpt_seed,lui_numDim);
+      if ( lt_dist < lvectort_distMin[lui_i] ) {
+	lvectort_distMin[lui_i] = lt_dist;
+	lvectorui_nearestSeed[lui_i] = lui_s;
+      }
+      lvectort_weightSeed[lui_i] = lvectort_frequency[lui_i] * lvectort_distMin[lui_i];
+      lb_positive = lb_positive || ( lvectort_weightSeed[lui_i] > T_REAL(0) );
+    }
+    if ( !lb_positive ) /*ALL INSTANCES ARE SEEDS*/
+      break;
+  }
+
+  /*SAMPLING PROBABILITY
+   */
+  std::vector<T_REAL> lvectort_freqSeed(lui_numSeeds,T_REAL(0));
+  T_REAL lt_sumCost = T_REAL(0);
+  for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++) {
+    lvectort_freqSeed[lvectorui_nearestSeed[lui_i]] += lvectort_frequency[lui_i];
+    lt_sumCost += lvectort_frequency[lui_i] * lvectort_distMin[lui_i];
+  }
+  uintidx lui_numSeedsUsed = (uintidx)
+    std::count_if
+    (lvectort_freqSeed.begin(),lvectort_freqSeed.end(),
+     [](const T_REAL lt_freq) { return lt_freq > T_REAL(0); }
+     );
+
+  std::vector<T_REAL> lvectort_prob(lui_numInstances);
+  for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++) {
+    const T_REAL lt_probSeed =
+      lvectort_frequency[lui_i]
+      / (T_REAL(lui_numSeedsUsed) * lvectort_freqSeed[lvectorui_nearestSeed[lui_i]]);
+    lvectort_prob[lui_i] = ( lt_sumCost > T_REAL(0) )?
+      T_REAL(0.5) * lvectort_frequency[lui_i] * lvectort_distMin[lui_i] / lt_sumCost
+      + T_REAL(0.5) * lt_probSeed
+      :lt_probSeed;
+  }
+
+  std::vector<uintidx> lvectorui_numDraws(lui_numInstances,0);
+  std::discrete_distribution<uintidx> ldiscrdis_instance
+    (lvectort_prob.begin(),lvectort_prob.end());
+  for (uintidx lui_n = 0; lui_n < aiui_sizeCoreset; lui_n++)
+    ++lvectorui_numDraws[ldiscrdis_instance(gmt19937_eng)];
+
+  std::vector<data::Instance<T_FEATURE>* > lovectorptinst_coreset;
+  for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++) {
+    if ( lvectorui_numDraws[lui_i] > 0 ) {
+      const T_REAL lt_frequency =
+	T_REAL(lvectorui_numDraws[lui_i]) * lvectort_frequency[lui_i]
+	/ (T_REAL(aiui_sizeCoreset) * lvectort_prob[lui_i]);
+      lovectorptinst_coreset.push_back
+	(newInstanceFreq
+	 (lvectorptinst_instances[lui_i]->getFeatures(),
+	  std::max(T_INSTANCE_FREQUENCY(1),T_INSTANCE_FREQUENCY(std::round(lt_frequency)))
+	  )
+	 );
+    }
+  }
+
+#ifdef __VERBOSE_YES
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ": OUT(" << geiinparam_verbose << ")\n"
+	      << "size coreset = " << lovectorptinst_coreset.size()
+	      << std::endl;
+  }
+  --geiinparam_verbose;
+#endif //__VERBOSE_YES
+
+  return lovectorptinst_coreset;
+
+} /*END sampling*/
+
+} /*END namespace coreset*/
+
+#endif /*__CORESET_HPP*/
@@ -13,6 +13,7 @@
 #ifndef BIT_CRISP_MATRIX_HPP
 #define BIT_CRISP_MATRIX_HPP
 
+#include <vector>
 #include "bit_matrix.hpp"
 
 /*! \namespace mat
@@ -97,15 +98,51 @@ public:
   }
    
   const T_CLUSTERIDX getMember(uintidx aiuintidx_instanceIdx) const
-  {      
+  {
+    /*THE WORD OF THE INSTANCE IS AT THE SAME OFFSET IN EACH ROW
+     */
+    const T_BITSIZE *lT_word =
+      this->getRow(0)
+      + aiuintidx_instanceIdx / ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords;
+    const T_BITSIZE  lT_mask = (T_BITSIZE) 1
+      << (aiuintidx_instanceIdx % ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords);
+    
     for (uintidx luintidx_i = 0; luintidx_i < this->getNumRows(); luintidx_i++) {
-      if ( (*this)(luintidx_i, aiuintidx_instanceIdx) ) {
+      if ( *lT_word & lT_mask ) {
 	return (T_CLUSTERIDX) luintidx_i;  
       }
+      lT_word += this->_st_numWordsRows;
     }
     return (T_CLUSTERIDX) -1;
   }
 
+  /*! \fn void getMembers(std::vector<T_CLUSTERIDX> &aovectorcidx_member) const
+    \brief The cluster of every instance, -1 if the instance has no cluster
+    \details The rows are visited word by word, so it costs the number of words of the matrix plus the number of instances instead of one getMember for each instance
+    \param aovectorcidx_member a vector resized to the number of instances
+  */
+  void getMembers(std::vector<T_CLUSTERIDX> &aovectorcidx_member) const
+  {
+    aovectorcidx_member.assign(this->getNumColumns(), (T_CLUSTERIDX) -1);
+    
+    for (uintidx luintidx_i = 0; luintidx_i < this->getNumRows(); luintidx_i++) {
+      const T_BITSIZE *lT_row = this->getRow(luintidx_i);
+      for (uintidx luintidx_w = 0; luintidx_w < this->_st_numWordsRows; luintidx_w++) {
+	T_BITSIZE lT_word = lT_row[luintidx_w];
+	while ( lT_word ) {
+	  uintidx luintidx_j =
+	    luintidx_w * ds::BitContainer<T_BITSIZE>::_stusi_numBitsWords
+	    + ds::BitContainer<T_BITSIZE>::countTrailingZeros(lT_word);
+	  /*AS getMember THE FIRST CLUSTER IS KEPT*/
+	  if ( luintidx_j < aovectorcidx_member.size()
+	       && aovectorcidx_member[luintidx_j] == (T_CLUSTERIDX) -1 )
+	    aovectorcidx_member[luintidx_j] = (T_CLUSTERIDX) luintidx_i;
+	  lT_word &= lT_word - 1;
+	}
+      }
+    }
+  }
+
   bool setMember(uintidx aiuintidx_instanceIdx, T_CLUSTERIDX aimgidxT_memberCluster)
   {
     T_CLUSTERIDX  lmgidx_prevMemberCluster;
@@ -12,8 +12,17 @@
 #ifndef DIST_HPP
 #define DIST_HPP
 
+#include <atomic>
+#include <stdint.h>
 #include "common.hpp"
 
+/*DIST_COUNTER_MAXSLOTS: number of threads with their own counter of
+  distance evaluations, the following threads share the last one
+ */
+#ifndef DIST_COUNTER_MAXSLOTS
+#define DIST_COUNTER_MAXSLOTS 256
+#endif
+
 /*! \namespace dist
   \brief Module for definition of distance between objects or instances
   \details
@@ -37,6 +46,66 @@ struct Dist {
 }; /* Dist */
 
 
+/*! \class Counter
+  \brief Number of distance evaluations of the program
+  \details Each thread increments its own slot of a cache line, so the count does not synchronize the threads. The total getNumEvaluations() is valid outside the parallel regions. The distance functions and the blocked kernels call countEvaluations
+*/
+class Counter {
+public:
+
+  /*! \fn static void countEvaluations(const uint64_t aiui_numDist = 1)
+    \brief Add the distances computed by the calling thread
+  */
+  static inline void countEvaluations(const uint64_t aiui_numDist = 1)
+  {
+    static thread_local uint64_t *ltlpui_slot = NULL;
+    
+    if ( ltlpui_slot == NULL ) {
+      uintidx lui_idxSlot = _getNumSlots().fetch_add(1);
+      if ( lui_idxSlot >= DIST_COUNTER_MAXSLOTS )
+	lui_idxSlot = DIST_COUNTER_MAXSLOTS - 1;
+      ltlpui_slot = &_getSlots()[lui_idxSlot].ui_numDist;
+    }
+    *ltlpui_slot += aiui_numDist;
+  }
+
+  /*! \fn static uint64_t getNumEvaluations()
+    \brief Distances computed by all threads since the beginning of the program
+  */
+  static uint64_t getNumEvaluations()
+  {
+    uintidx lui_numSlots = _getNumSlots().load();
+    if ( lui_numSlots > DIST_COUNTER_MAXSLOTS )
+      lui_numSlots = DIST_COUNTER_MAXSLOTS;
+    
+    uint64_t lui_numDist = 0;
+    for (uintidx lui_i = 0; lui_i < lui_numSlots; lui_i++)
+      lui_numDist += _getSlots()[lui_i].ui_numDist;
+    
+    return lui_numDist;
+  }
+
+protected:
+
+  struct alignas(64) Slot {
+    uint64_t ui_numDist;
+  };
+  
+  static Slot* _getSlots()
+  {
+    static Slot larray_slots[DIST_COUNTER_MAXSLOTS] = {};
+    return larray_slots;
+  }
+
+  static std::atomic<uintidx>& _getNumSlots()
+  {
+    static std::atomic<uintidx> latomicui_numSlots(0);
+    return latomicui_numSlots;
+  }
+
+}; /* Counter */
+
+
 } /*END namespace dist 
    */
 
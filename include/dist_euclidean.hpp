@@ -44,6 +44,7 @@ template < class T_DIST,
 struct Euclidean: public Dist<T_DIST,T_FEATURE> {
   inline T_DIST operator() (const T_FEATURE *aiarrayT_p, const T_FEATURE* aiarrayT_q, const  uintidx uintidx_length) const
   {
+    Counter::countEvaluations();
     return kernelEuclidean(aiarrayT_p,aiarrayT_q,uintidx_length);
   }
 }; /* Dist */
@@ -58,6 +59,7 @@ template < class T_DIST,
 struct EuclideanSquared: public Dist<T_DIST,T_FEATURE> {
   inline T_DIST operator() (const T_FEATURE *aiarrayT_p, const T_FEATURE* aiarrayT_q, const uintidx uintidx_length) const 
   {
+    Counter::countEvaluations();
     return kernelEuclideanSquared(aiarrayT_p,aiarrayT_q,uintidx_length);
   }
 }; /* EuclideanSquared */
@@ -88,6 +90,17 @@ struct Induced: public Dist<T_DIST,T_FEATURE> {
     , _arrayt_x(new T_DIST[aimatrix_weight.getNumColumns()])
   {}
 
+  template < class T_WEIGHT >
+  Induced(const mat::MatrixRow<T_WEIGHT>& aimatrix_weight)
+    : _matrix_weight(aimatrix_weight.getNumRows(),aimatrix_weight.getNumColumns())
+    , _arrayt_xt(new T_DIST[aimatrix_weight.getNumColumns()])
+    , _arrayt_x(new T_DIST[aimatrix_weight.getNumColumns()])
+  {
+    for (uintidx lui_i = 0; lui_i < aimatrix_weight.getNumRows(); lui_i++)
+      for (uintidx lui_j = 0; lui_j < aimatrix_weight.getNumColumns(); lui_j++)
+	_matrix_weight(lui_i,lui_j) = T_DIST(aimatrix_weight(lui_i,lui_j));
+  }
+
   
  virtual  ~Induced()
   {
@@ -102,19 +115,13 @@ struct Induced: public Dist<T_DIST,T_FEATURE> {
 
     T_DIST  loT_dist;
 
+    Counter::countEvaluations();
     
-    interfacesse::copy
-      (_arrayt_x,
-       aiarrayT_p,
-       uintidx_length
-       );
-
-    interfacesse::axpy
-      (_arrayt_x,
-       T_FEATURE(-1),
-       aiarrayT_q,
-       uintidx_length
-       );
+    /*The difference is obtained in T_DIST, the features 
+      may have less precision than the distance
+     */
+    for (uintidx lui_i = 0; lui_i < uintidx_length; lui_i++)
+      _arrayt_x[lui_i] = T_DIST(aiarrayT_p[lui_i]) - T_DIST(aiarrayT_q[lui_i]);
     
     interfacesse::gemv
       (_arrayt_xt,
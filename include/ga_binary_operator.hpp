@@ -21,10 +21,11 @@
 #include "chromosome_bitarray.hpp"
 #include "crisp_matrix.hpp"
 #include "probability_selection.hpp"
+#include "probability_distribution.hpp"
 
 #include "verbose_global.hpp"
 
-extern StdMT19937  gmt19937_eng;
+extern thread_local StdMT19937  gmt19937_eng;
 
 /*! \namespace gabinaryop
   \brief Genetic binary operators
@@ -174,14 +175,14 @@ onePointDistCrossover
   }
 #endif /*__VERBOSE_YES*/
 
-  static std::uniform_int_distribution<uintidx> lsuniformdis_uintidx0N
+  std::uniform_int_distribution<uintidx> luniformdis_uintidx0N
     (0, aobitmatrix_child1.getNumColumns()-1);
 
   const std::pair<uintidx,uintidx> lpair_pointCrossoverOrd = 
     prob::getRandPairUnlikeInOrd
     ([&]() -> uintidx
      {
-       return lsuniformdis_uintidx0N(gmt19937_eng);
+       return luniformdis_uintidx0N(gmt19937_eng);
      }
      );
   
@@ -281,10 +282,10 @@ onePointCrossover
 #endif /*__VERBOSE_YES*/
 
  
-  static std::uniform_int_distribution<uintidx> lstuniformdis_uiCrossover1N
+  std::uniform_int_distribution<uintidx> luniformdis_uiCrossover1N
     (1,(uintidx)(aibitarray_chromParent1.size()-1));
    
-  const uintidx lui_randPositionGene = lstuniformdis_uiCrossover1N(gmt19937_eng);
+  const uintidx lui_randPositionGene = luniformdis_uiCrossover1N(gmt19937_eng);
    
   uintidx uintidx_distCrossover = aibitarray_chromParent1.size() - lui_randPositionGene; 
   
@@ -377,14 +378,14 @@ onePointDistCrossover
   }
 #endif /*__VERBOSE_YES*/
 
-  static std::uniform_int_distribution<uintidx> lsuniformdis_uintidx0N
+  std::uniform_int_distribution<uintidx> luniformdis_uintidx0N
     (0, aibitarraychrom_parent1.size() -1 );
 
   const std::pair<uintidx,uintidx> lpair_pointCrossoverOrd = 
     prob::getRandPairUnlikeInOrd
     ([&]() -> uintidx
      {
-       return lsuniformdis_uintidx0N(gmt19937_eng);
+       return luniformdis_uintidx0N(gmt19937_eng);
      }
      );
   
@@ -576,13 +577,13 @@ bitMutation
   }
 #endif /*__VERBOSE_YES*/
 
-  static std::uniform_int_distribution<uintidx> lsuniformdis_uintidx0N
+  std::uniform_int_distribution<uintidx> luniformdis_uintidx0N
     (0, aiobitcrispmatrix_chrom.getNumColumns()-1);
 
-  static std::uniform_int_distribution<T_CLUSTERIDX> lsuniformdis_cidx_0K
+  std::uniform_int_distribution<T_CLUSTERIDX> luniformdis_cidx_0K
     (0, T_CLUSTERIDX(aiobitcrispmatrix_chrom.getNumRows()-1));
   
-  const uintidx lui_mutationRandPosGene(lsuniformdis_uintidx0N(gmt19937_eng));
+  const uintidx lui_mutationRandPosGene(luniformdis_uintidx0N(gmt19937_eng));
   
   T_CLUSTERIDX lcidx_mutationMemberPrev = 
     aiobitcrispmatrix_chrom.getMember(lui_mutationRandPosGene);
@@ -591,7 +592,7 @@ bitMutation
     prob::getRandUnlike
     (lcidx_mutationMemberPrev,
      [&]() -> T_CLUSTERIDX {
-      return lsuniformdis_cidx_0K(gmt19937_eng);
+      return luniformdis_cidx_0K(gmt19937_eng);
       }
      );
   
@@ -662,10 +663,10 @@ bitMutation
 #endif /*__VERBOSE_YES*/
 
   
-  static std::uniform_int_distribution<uintidx> lstuniformdis_uiMutation0N
+  std::uniform_int_distribution<uintidx> luniformdis_uiMutation0N
      (0,(aiobitarray_chrom.size()-1));
   
-  const uintidx aiuintidx_pointMutation(lstuniformdis_uiMutation0N(gmt19937_eng));
+  const uintidx aiuintidx_pointMutation(luniformdis_uiMutation0N(gmt19937_eng));
     
   aiobitarray_chrom.toggleBit(aiuintidx_pointMutation);
   
@@ -686,7 +687,7 @@ bitMutation
 
 /*! \fn void eachBitArrayMutation(gaencode::ChromosomeBitArray<T_BITSIZE,T_REAL>  &aiobitarray_chrom, const T_REAL airt_probMutation)
     \brief Toggle bits
-    \details Each bit of each offspring chromosome mutates with a predefined probability (mutation rate airt_probMutation).
+    \details Each bit of each offspring chromosome mutates with a predefined probability (mutation rate airt_probMutation). Only the bits that mutate are drawn, see prob::forEachBernoulliSuccess
     \param aiobitarray_chrom a gaencode::ChromosomeBitArray<T_BITSIZE,T_REAL>
     \param airt_probMutation a real number with mutation rate
     
@@ -726,13 +727,14 @@ eachBitArrayMutation
   }
 #endif /*__VERBOSE_YES*/
 
-  static std::uniform_real_distribution<T_REAL> lsuniformdis_real01(0.0,1.0);
-
-  for (uintidx li_j = 0; li_j < aiobitarray_chrom.size(); li_j++) {
-      if ( lsuniformdis_real01(gmt19937_eng) <= airt_probMutation ) {
-	aiobitarray_chrom.toggleBit(li_j);
-      }
-  }
+  prob::forEachBernoulliSuccess
+    (aiobitarray_chrom.size(),
+     airt_probMutation,
+     [&](const uintidx aiui_j)
+     {
+       aiobitarray_chrom.toggleBit(aiui_j);
+     }
+     );
   
 #ifdef __VERBOSE_YES
   
@@ -35,12 +35,13 @@
 #include "probability_distribution.hpp"
 #include "probability_selection.hpp"
 #include "ga_function_objective.hpp"
+#include "dist_euclidean.hpp"
 
 #define  GENETICOPCLUSTER_MAX_GLA  INT_MAX
 
 #include "verbose_global.hpp"
 
-extern StdMT19937       gmt19937_eng;
+extern thread_local StdMT19937       gmt19937_eng;
 
 
 /*! \namespace gaclusteringop
@@ -2090,9 +2091,194 @@ rearrangedCluster
 }
 
   
+#define KMEANSFEAC_BOUNDS_NONE        0
+#define KMEANSFEAC_BOUNDS_EUCLIDEAN   1
+#define KMEANSFEAC_BOUNDS_EUCLIDEANSQ 2
+
+/*! \fn int kmeansfeacTypeBounds(const dist::Dist<T_REAL,T_FEATURE> &aifunc2p_dist)
+  \brief Type of bounds that kmeansfeac keeps in the chromosome for a distance
+  \details The bounds need the triangle inequality, they are kept for dist::Euclidean and for the square root of dist::EuclideanSquared
+  \param aifunc2p_dist an object of type dist::Dist to calculate distances
+ */
+template <typename T_REAL,
+	  typename T_FEATURE
+	  >
+int
+kmeansfeacTypeBounds
+(const dist::Dist<T_REAL,T_FEATURE> &aifunc2p_dist)
+{
+  if ( !std::is_floating_point<T_REAL>::value )
+    return KMEANSFEAC_BOUNDS_NONE;
+  if ( dynamic_cast<const dist::Euclidean<T_REAL,T_FEATURE>*>
+       (&aifunc2p_dist) != NULL )
+    return KMEANSFEAC_BOUNDS_EUCLIDEAN;
+  if ( dynamic_cast<const dist::EuclideanSquared<T_REAL,T_FEATURE>*>
+       (&aifunc2p_dist) != NULL )
+    return KMEANSFEAC_BOUNDS_EUCLIDEANSQ;
+  return KMEANSFEAC_BOUNDS_NONE;
+}
+
+/*! \fn T_REAL kmeansfeacBound(const T_REAL aort_dist, const int aii_typeBounds)
+  \brief Distance in the units of the bounds
+ */
+template <typename T_REAL>
+inline
+T_REAL
+kmeansfeacBound
+(const T_REAL aort_dist,
+ const int    aii_typeBounds
+ )
+{
+  return ( aii_typeBounds == KMEANSFEAC_BOUNDS_EUCLIDEANSQ )?
+    std::sqrt(aort_dist):aort_dist;
+}
+
+/*! \fn T_CLUSTERIDX kmeansfeacBoundedNN(T_REAL &aort_upperBound, T_REAL *aoarrayt_lowerBound, const T_REAL *aiarrayt_driftCentroids, const T_CLUSTERIDX aicidx_k, const mat::MatrixWithRowNull<T_FEATURE> &aimatrixwrownull_centroids, const T_FEATURE *aiat_instance, const int aii_typeBounds, dist::Dist<T_REAL,T_FEATURE> &aifunc2p_dist)
+  \brief Nearest centroid of an instance computing only the distances to the centroids that can be closer than its centroid \cite Elkan:kmeans:2003
+  \details The result is the same as nearest::checkNullCentroidsNN. The bounds of the instance are loosened with the drift of the centroids and then updated with the distances computed
+  \param aort_upperBound upper bound of the distance to the centroid of the instance
+  \param aoarrayt_lowerBound lower bound of the distance to each centroid
+  \param aiarrayt_driftCentroids distance that each centroid moved since the bounds were updated
+  \param aicidx_k cluster of the instance or NEARESTCENTROID_UNKNOWN
+  \param aimatrixwrownull_centroids the centroids
+  \param aiat_instance characteristics of the instance
+  \param aii_typeBounds the type of the bounds, see kmeansfeacTypeBounds
+  \param aifunc2p_dist an object of type dist::Dist to calculate distances
+ */
+template <typename T_CLUSTERIDX,
+	  typename T_REAL,
+	  typename T_FEATURE
+	  >
+T_CLUSTERIDX
+kmeansfeacBoundedNN
+(T_REAL                                  &aort_upperBound,
+ T_REAL                                  *aoarrayt_lowerBound,
+ const T_REAL                            *aiarrayt_driftCentroids,
+ const T_CLUSTERIDX                      aicidx_k,
+ const mat::MatrixWithRowNull<T_FEATURE> &aimatrixwrownull_centroids,
+ const T_FEATURE                         *aiat_instance,
+ const int                               aii_typeBounds,
+ dist::Dist<T_REAL,T_FEATURE>            &aifunc2p_dist
+ )
+{
+  /*THE BOUNDS ARE COMPARED WITH A MARGIN FOR THE ROUNDING ERRORS
+   */
+  const T_REAL lrt_marginBound =
+    T_REAL(1) + T_REAL(64) * std::numeric_limits<T_REAL>::epsilon();
+  
+  T_CLUSTERIDX locidx_nearest = aicidx_k;
+  T_REAL       lrt_distNearest = std::numeric_limits<T_REAL>::max();
+  bool         lb_tight = ( aicidx_k == NEARESTCENTROID_UNKNOWN );
+  T_REAL       lrt_upperBound = 
+    ( lb_tight )?std::numeric_limits<T_REAL>::max()
+    :aort_upperBound + aiarrayt_driftCentroids[aicidx_k];
+  T_REAL       lrt_upperBoundMargin = lrt_upperBound * lrt_marginBound;
+  
+  const T_CLUSTERIDX lcidx_numClusterK =
+    T_CLUSTERIDX(aimatrixwrownull_centroids.getNumRows());
+
+  T_REAL lrt_minLowerBound = std::numeric_limits<T_REAL>::max();
+  for (T_CLUSTERIDX lcidx_j = 0; lcidx_j < lcidx_numClusterK; lcidx_j++) {
+    aoarrayt_lowerBound[lcidx_j] -= aiarrayt_driftCentroids[lcidx_j];
+    lrt_minLowerBound =
+      std::min
+      (lrt_minLowerBound,
+       ( lcidx_j != aicidx_k )?aoarrayt_lowerBound[lcidx_j]:std::numeric_limits<T_REAL>::max()
+       );
+  }
+  /*NO CENTROID CAN BE CLOSER
+   */
+  if ( lrt_upperBoundMargin < lrt_minLowerBound ) {
+    aort_upperBound = lrt_upperBound;
+    return aicidx_k;
+  }
+  
+  for (T_CLUSTERIDX lcidx_j = 0; lcidx_j < lcidx_numClusterK; lcidx_j++) {
+    
+    if ( lrt_upperBoundMargin < aoarrayt_lowerBound[lcidx_j]
+	 || lcidx_j == aicidx_k )
+      continue;
+    const T_FEATURE* larrayT_centroidj = aimatrixwrownull_centroids.getRow(lcidx_j);
+    if ( data::Instance<T_FEATURE>::isInfiniteFeature(larrayT_centroidj[0]) )
+      continue;
+    
+    if ( !lb_tight ) {
+      lrt_distNearest =
+	aifunc2p_dist
+	(aimatrixwrownull_centroids.getRow(aicidx_k),
+	 aiat_instance,
+	 aimatrixwrownull_centroids.getNumColumns()
+	 );
+      lrt_upperBound = kmeansfeacBound(lrt_distNearest,aii_typeBounds);
+      lrt_upperBoundMargin = lrt_upperBound * lrt_marginBound;
+      aoarrayt_lowerBound[aicidx_k] = lrt_upperBound;
+      lb_tight = true;
+      if ( lrt_upperBoundMargin < aoarrayt_lowerBound[lcidx_j] )
+	continue;
+    }
+    
+    const T_REAL lrt_distj =
+      aifunc2p_dist
+      (larrayT_centroidj,
+       aiat_instance,
+       aimatrixwrownull_centroids.getNumColumns()
+       );
+    aoarrayt_lowerBound[lcidx_j] = kmeansfeacBound(lrt_distj,aii_typeBounds);
+    /*TIES ARE FOR THE FIRST CENTROID
+     */
+    if ( locidx_nearest == NEARESTCENTROID_UNKNOWN
+	 || lrt_distj < lrt_distNearest
+	 || (lrt_distj == lrt_distNearest && lcidx_j < locidx_nearest) ) {
+      locidx_nearest  = lcidx_j;
+      lrt_distNearest = lrt_distj;
+      lrt_upperBound  = aoarrayt_lowerBound[lcidx_j];
+      lrt_upperBoundMargin = lrt_upperBound * lrt_marginBound;
+    }
+  }
+
+  aort_upperBound = lrt_upperBound;
+  
+  return locidx_nearest;
+}
+
+/*! \fn void kmeansfeacMoveCentroid(gaencode::ChromosomeFEAC<T_CLUSTERIDX,T_REAL,T_FEATURE,T_FEATURE_SUM,T_INSTANCES_CLUSTER_K> &aochrom_feac, const uintidx aiui_k, const T_FEATURE *aiarrayt_oldCentroid, const int aii_typeBounds, dist::Dist<T_REAL,T_FEATURE> &aifunc2p_dist)
+  \brief Add to the drift of centroid k the distance it moved from aiarrayt_oldCentroid
+ */
+template <typename T_CLUSTERIDX,
+	  typename T_REAL,
+	  typename T_FEATURE,
+	  typename T_FEATURE_SUM,
+	  typename T_INSTANCES_CLUSTER_K
+	  >
+void
+kmeansfeacMoveCentroid
+(gaencode::ChromosomeFEAC
+ <T_CLUSTERIDX,
+ T_REAL,
+ T_FEATURE,
+ T_FEATURE_SUM,
+ T_INSTANCES_CLUSTER_K>          &aochrom_feac,
+ const uintidx                   aiui_k,
+ const T_FEATURE                 *aiarrayt_oldCentroid,
+ const int                       aii_typeBounds,
+ dist::Dist<T_REAL,T_FEATURE>    &aifunc2p_dist
+ )
+{
+  aochrom_feac.getDriftCentroids()[aiui_k] +=
+    kmeansfeacBound
+    (aifunc2p_dist
+     (aochrom_feac.getCentroids().getRow(aiui_k),
+      aiarrayt_oldCentroid,
+      aochrom_feac.getCentroids().getNumColumns()
+      ),
+     aii_typeBounds
+     );
+}
+
+
 /*! \fn void kmeansfeac(gaencode::ChromosomeFEAC<T_CLUSTERIDX,T_REAL,T_FEATURE,T_INSTANCES_CLUSTER_K> &aochrom_feac, std::vector<data::Instance<T_FEATURE>* > &aivectorptinst_instances, COMMON_IDOMAIN aiit_kmeansNumMaxIter, T_FEATURE airt_kmeansMaxDiffCent, dist::Dist<T_REAL,T_FEATURE>  &aifunc2p_dist ) 
   \brief kmeansfeac \cite Alves:etal:GAclusteringLabelKVar:FEAC:2006
-  \brief 
+  \details For dist::Euclidean and dist::EuclideanSquared the chromosome keeps for each instance an upper bound of the distance to its centroid and a lower bound of the distance to each centroid \cite Elkan:kmeans:2003, also the drift of each centroid. The bounds are inherited by the offspring and updated by MO1 and MO2, so only the distances to the centroids that can be closer than the centroid of the instance are computed, see kmeansfeacBoundedNN. The partition is the same as without bounds
   \param aochrom_feac a gaencode::ChromosomeFEAC
   \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
   \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
@@ -2148,6 +2334,29 @@ kmeansfeac
   std::vector<T_INSTANCES_CLUSTER_K>        &lvectorT_numInstancesClusterK = 
     aochrom_feac.getNumInstancesClusterK();
 
+  /*BOUNDS INHERITED FROM THE PARENT, OTHERWISE ALL INSTANCES
+    ARE ASSIGNED WITH THE DISTANCES TO ALL CENTROIDS
+   */
+  const int li_typeBounds = kmeansfeacTypeBounds(aifunc2p_dist);
+  const bool lb_bounds = (li_typeBounds != KMEANSFEAC_BOUNDS_NONE);
+  std::vector<T_REAL> &lvectorT_upperBound    = aochrom_feac.getUpperBound();
+  std::vector<T_REAL> &lvectorT_lowerBound    = aochrom_feac.getLowerBound();
+  std::vector<T_REAL> &lvectorT_driftCentroids = aochrom_feac.getDriftCentroids();
+  if ( lb_bounds ) {
+    const uintidx lui_numInstances =
+      uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
+    if ( lvectorT_upperBound.size() != lui_numInstances
+	 || lvectorT_driftCentroids.size() != lmatrixwrownull_centroids.getNumRows()
+	 || lvectorT_lowerBound.size() != lui_numInstances * lmatrixwrownull_centroids.getNumRows() ) {
+      lvectorT_upperBound.assign(lui_numInstances,std::numeric_limits<T_REAL>::max());
+      lvectorT_lowerBound.assign
+	(lui_numInstances * lmatrixwrownull_centroids.getNumRows(),T_REAL(0));
+      lvectorT_driftCentroids.assign(lmatrixwrownull_centroids.getNumRows(),T_REAL(0));
+    }
+  }
+  else
+    aochrom_feac.clearBounds();
+
   T_COMMON_IDOMAIN liT_newIteration = 1;
   mat::BitArray<unsigned long> lbitarray_recalculeteK(lmatrixwrownull_centroids.getNumRows());
   T_INSTANCES_CLUSTER_K *larrayt_instacesDiffNumClusterK =
@@ -2186,6 +2395,12 @@ kmeansfeac
   }
 #endif /*__VERBOSE_YES*/
 
+    /*THE DRIFT OF THE CENTROIDS IS ADDED TO THE BOUNDS OF EACH 
+      INSTANCE ASSIGNED
+     */
+    const bool lb_driftToBounds =
+      lb_bounds && (aiiterator_instfirst != aiiterator_instlast);
+    
     mat::MatrixWithRowNull<T_FEATURE> lmatrixwrownullT_oldCentroids(lmatrixwrownull_centroids);
     for (uintidx lui_idxInsti = 0 ; aiiterator_instfirst != aiiterator_instlast;
 	 aiiterator_instfirst++, lui_idxInsti++) {
@@ -2193,7 +2408,18 @@ kmeansfeac
 
       T_REAL lrt_distMinCentInst;
       T_CLUSTERIDX lmgidx_j =
-	nearest::checkNullCentroidsNN
+	( lb_bounds )?
+	kmeansfeacBoundedNN
+	(lvectorT_upperBound[lui_idxInsti],
+	 lvectorT_lowerBound.data() + lui_idxInsti * lmatrixwrownull_centroids.getNumRows(),
+	 lvectorT_driftCentroids.data(),
+	 larraycidx_idxMemberShip[lui_idxInsti],
+	 lmatrixwrownull_centroids,
+	 liter_iInstance,
+	 li_typeBounds,
+	 aifunc2p_dist
+	 )
+	:nearest::checkNullCentroidsNN
 	<T_CLUSTERIDX, 
 	 T_FEATURE, 
 	 T_REAL>
@@ -2254,6 +2480,9 @@ kmeansfeac
 	
       } /*end else*/
     } /*end for clustering instances*/
+
+    if ( lb_driftToBounds )
+      std::fill(lvectorT_driftCentroids.begin(),lvectorT_driftCentroids.end(),T_REAL(0));
    
 #ifdef __VERBOSE_YES
   if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -2329,15 +2558,19 @@ kmeansfeac
      */
     for ( uintidx lui_j = 0; lui_j < lmatrixwrownull_centroids.getNumRows(); lui_j++) {
       T_FEATURE *larrayrowt_centroidj = lmatrixwrownull_centroids.getRow(lui_j); 
-      if (!data::Instance<T_FEATURE>::isInfiniteFeature(larrayrowt_centroidj[0]) &&  
+      if (!data::Instance<T_FEATURE>::isInfiniteFeature(larrayrowt_centroidj[0]) ) {
+	T_REAL lrt_distOldCentroid =
 	  aifunc2p_dist
 	  (larrayrowt_centroidj, 
 	   lmatrixwrownullT_oldCentroids.getRow(lui_j), 
 	   lmatrixwrownull_centroids.getNumColumns()
-	   ) > airt_kmeansMaxDiffCent
-	  )
-	liT_newIteration = 1;
-     
+	   );
+	if ( lrt_distOldCentroid > airt_kmeansMaxDiffCent )
+	  liT_newIteration = 1;
+	if ( lb_bounds ) 
+	  lvectorT_driftCentroids[lui_j] +=
+	    kmeansfeacBound(lrt_distOldCentroid,li_typeBounds);
+      }
     }
      
     --aiit_kmeansNumMaxIter;
@@ -2381,6 +2614,9 @@ kmeansfeac
       (lvectorT_genotypePartialFcC,
        lvectorstidx_clustersKeep
        );
+
+    if ( lb_bounds ) 
+      aochrom_feac.keepClustersBounds(lvectorstidx_clustersKeep);
   }
   
 #ifdef __VERBOSE_YES
@@ -2958,6 +3194,16 @@ MO1
 	
 	if ( lT_denominator != 0 ) {
 
+	  /*THE CENTROID OF Cj MOVES, SEE kmeansfeac
+	   */
+	  std::vector<T_FEATURE> lvectort_oldCentroidCj;
+	  if ( aochromfeac_toMutate.hasBounds() )
+	    lvectort_oldCentroidCj.assign
+	      (lmatrixwrownull_genotypeCentroids.getRow(lcidx_Cj),
+	       lmatrixwrownull_genotypeCentroids.getRow(lcidx_Cj)
+	       + lmatrixwrownull_genotypeCentroids.getNumColumns()
+	       );
+
 	  interfacesse::scal
 	    (lmatrixwrownull_genotypeCentroids.getRow(lcidx_Cj),
 	     lvectorT_genotypeNumInstancesClusterK.at(lcidx_Cj),//lT_beta,
@@ -2991,6 +3237,25 @@ MO1
 	    if ( lui_k != (uintidx) lcidx_Cs ) 
 	      lvectorstidx_clustersKeep.push_back( lui_k );
 
+	  if ( aochromfeac_toMutate.hasBounds() ) {
+	    kmeansfeacMoveCentroid
+	      (aochromfeac_toMutate,
+	       (uintidx) lcidx_Cj,
+	       lvectort_oldCentroidCj.data(),
+	       kmeansfeacTypeBounds(aifunc2p_dist),
+	       aifunc2p_dist
+	       );
+	    /*THE OBJECTS OF Cs LOSE THE UPPER BOUND, THE LOWER BOUNDS
+	      ARE STILL VALID FOR THE REMAINING CLUSTERS
+	    */
+	    const T_CLUSTERIDX *larraycidx_memberShip = aochromfeac_toMutate.getString();
+	    std::vector<T_REAL>& lvectorT_upperBound = aochromfeac_toMutate.getUpperBound();
+	    for (uintidx lui_i = 0; lui_i < lvectorT_upperBound.size(); lui_i++)
+	      if ( larraycidx_memberShip[lui_i] == lcidx_Cs )
+		lvectorT_upperBound[lui_i] = std::numeric_limits<T_REAL>::max();
+	    aochromfeac_toMutate.keepClustersBounds(lvectorstidx_clustersKeep);
+	  }
+	  
 	  /*UPDATE LABELS
 	   */
 	  gaintegerop::oneChangelabel
@@ -3463,11 +3728,41 @@ MO2
 	 aifunc2p_dist
 	 );
 
+      std::vector<T_FEATURE> lvectort_oldCentroidCs;
+      if ( aochromfeac_toMutate.hasBounds() )
+	lvectort_oldCentroidCs.assign
+	  (lmatrixwrownull_genotypeCentroids.getRow(lcidx_Cs),
+	   lmatrixwrownull_genotypeCentroids.getRow(lcidx_Cs)
+	   + lmatrixwrownull_genotypeCentroids.getNumColumns()
+	   );
+      
       lmatrixwrownull_genotypeCentroids.copyRow
 	(lcidx_Cs,lmatrixrowt_centroidsNewS.getRow(0));
       lmatrixwrownull_genotypeCentroids.addRow
 	(lmatrixrowt_centroidsNewS.getRow(1));
 
+      if ( aochromfeac_toMutate.hasBounds() ) {
+	/*Cs' AND Cs'' ARE THE CENTROID OF Cs MOVED, THE BOUNDS OF ALL
+	  OBJECTS REMAIN VALID, SEE kmeansfeac
+	*/
+	const int li_typeBounds = kmeansfeacTypeBounds(aifunc2p_dist);
+	aochromfeac_toMutate.copyClusterBounds((uintidx) lcidx_Cs);
+	kmeansfeacMoveCentroid
+	  (aochromfeac_toMutate,
+	   (uintidx) lcidx_Cs,
+	   lvectort_oldCentroidCs.data(),
+	   li_typeBounds,
+	   aifunc2p_dist
+	   );
+	kmeansfeacMoveCentroid
+	  (aochromfeac_toMutate,
+	   (uintidx) lvectorcidx_idxClustersNew[1],
+	   lvectort_oldCentroidCs.data(),
+	   li_typeBounds,
+	   aifunc2p_dist
+	   );
+      }
+
 
 #ifdef __VERBOSE_YES
      if ( lvectorit_genotypeNumInstClusterK[lcidx_Cs] !=
@@ -21,7 +21,7 @@
 #include "verbose_global.hpp"
 
 
-extern StdMT19937       gmt19937_eng;
+extern thread_local StdMT19937       gmt19937_eng;
 
 /*! \namespace gagenericop
   \brief Genetic operators independent of the data type
@@ -147,7 +147,7 @@ onePointCrossover
 #endif /*__VERBOSE_YES*/
 
   
-  static std::uniform_int_distribution<uintidx> uniformdis_uiCrossover1l_1
+  std::uniform_int_distribution<uintidx> uniformdis_uiCrossover1l_1
     (1,gaencode::ChromFixedLength<T_GENE,T_METRIC>::stcgetStringSize()-1);
 
   const uintidx  lui_randPositionGene(uniformdis_uiCrossover1l_1(gmt19937_eng));
@@ -29,7 +29,7 @@
 
 #include "verbose_global.hpp"
 
-extern StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace gaintegerop
   \brief Genetic integer operators
@@ -503,7 +503,7 @@ mutation
   }
 #endif //__VERBOSE_YES
 
-  static std::uniform_int_distribution<uintidx> uniformdis_uiMutation0N
+  std::uniform_int_distribution<uintidx> uniformdis_uiMutation0N
     (0,gaencode::ChromFixedLength<T_INTEGER,T_METRIC>::stcgetStringSize()-1);
 
   const uintidx lui_randPositionGene(uniformdis_uiMutation0N(gmt19937_eng));
@@ -565,7 +565,7 @@ isNotValid
 
 /*! \fn void mutationgka (gaencode::ChromFixedLength<T_CLUSTERIDX,T_REAL> &aiochrom_mutate, const T_REAL airt_probMutation, mat::MatrixRow<T_FEATURE> &aomatrixt_centroids, mat::MatrixRow<T_FEATURE_SUM> &aomatrixt_sumInstancesCluster, std::vector<T_INSTANCES_CLUSTER_K> &aovectort_numInstancesInClusterK, INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const dist::Dist<T_REAL,T_FEATURE> &aifunc2p_dist)
     \brief mutation GKA 
-    \details mutation GKA based on \cite Krishna:Murty:GAClustering:GKA:1999
+    \details mutation GKA based on \cite Krishna:Murty:GAClustering:GKA:1999, only the genes that mutate are drawn, see prob::forEachBernoulliSuccess
     \param aiochrom_mutate a gaencode::ChromFixedLength to mutate
     \param airt_probMutation a real number 
     \param aomatrixt_centroids a mat::MatrixRow space to work and store the centroids associated with the chromosome
@@ -625,14 +625,19 @@ mutationgka
   std::vector<T_REAL> lvector_distINSTiCLUSTER1k
     ( aomatrixt_centroids.getNumRows() );
   
-  static std::uniform_real_distribution<T_REAL> lsuniformdis_real01(0.0,1.0);
   const INPUT_ITERATOR liiterator_instfirst  = aiiterator_instfirst;
-  
-  for (T_CLUSTERIDX *liter_gene = aiochrom_mutate.begin();
-       aiiterator_instfirst != aiiterator_instlast;
-       ++aiiterator_instfirst, liter_gene++ ) {
 
-    if ( lsuniformdis_real01(gmt19937_eng) < airt_probMutation ) 
+  /*ONLY THE GENES THAT MUTATE ARE VISITED
+   */
+  uintidx lui_idxInstCurrent = 0;
+  prob::forEachBernoulliSuccess
+    (uintidx(std::distance(liiterator_instfirst,aiiterator_instlast)),
+     airt_probMutation,
+     [&](const uintidx aiui_idxInst)
+     {
+      std::advance(aiiterator_instfirst,aiui_idxInst - lui_idxInstCurrent);
+      lui_idxInstCurrent = aiui_idxInst;
+      T_CLUSTERIDX *liter_gene = aiochrom_mutate.begin() + aiui_idxInst;
       { /*IF BEGIN PROBABILITY*/
 	       
 	/*Calculate cluster centers,cj's corresponding to sw:*/
@@ -684,7 +689,8 @@ mutationgka
 	    *liter_gene = lmcidx_newAllen;
 	  }
       } /*IF END PROBABILITY*/
-  } //END FOR
+     }
+     );
   
 #ifdef __VERBOSE_YES
   if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -12,9 +12,10 @@
 #ifndef GA_ITERATOR_HPP
 #define GA_ITERATOR_HPP
 
+#include <vector>
 #include "probability_selection.hpp"
 
-extern StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 
 /*! \namespace gaiterator
@@ -113,6 +114,56 @@ crossover
 }
 
 
+/*! \fn void crossoverIdx(const std::vector<uintidx> &aivectorui_idxMatingPool, INPUT_ITERATOR aiiterator_instfirstParent, INPUT_ITERATOR aiiterator_instfirstChild, const INPUT_ITERATOR aiiterator_instlastChild, const GENETIC_OPERATOR genetic_operator) 
+    \brief Pairs crossover iterator over a mating pool of indexes
+    \details As crossover, but the mating pool only has the indexes of the selected parents, so they are not copied before the crossover. The children must be in a container different from the parents, eg. gaencode::PopulationArena::getOffspring()
+    \param aivectorui_idxMatingPool the indexes of the parents selected
+    \param aiiterator_instfirstParent an iterator to the first chromosome of the population
+    \param aiiterator_instfirstChild  an iterator
+    \param aiiterator_instlastChild   a const iterator
+    \param genetic_operator a crossover function  
+*/
+template<typename INPUT_ITERATOR, typename GENETIC_OPERATOR>
+void
+crossoverIdx
+(const std::vector<uintidx> &aivectorui_idxMatingPool,
+ INPUT_ITERATOR             aiiterator_instfirstParent,
+ INPUT_ITERATOR             aiiterator_instfirstChild,
+ const INPUT_ITERATOR       aiiterator_instlastChild,
+ const GENETIC_OPERATOR     genetic_operator
+ )
+{
+  std::vector<uintidx>::const_iterator liter_idxParent =
+    aivectorui_idxMatingPool.begin();
+
+  if ( ( aivectorui_idxMatingPool.size() % 2 ) != 0 ) {
+    *aiiterator_instfirstChild = *(aiiterator_instfirstParent + *liter_idxParent);
+    ++aiiterator_instfirstChild;
+    ++liter_idxParent;
+  }
+  while ( (aiiterator_instfirstChild != aiiterator_instlastChild )
+	  && (liter_idxParent != aivectorui_idxMatingPool.end()) )
+    {
+      INPUT_ITERATOR lchrom_parent1  = aiiterator_instfirstParent + *liter_idxParent; 
+      ++liter_idxParent;
+      INPUT_ITERATOR lchrom_parent2  = aiiterator_instfirstParent + *liter_idxParent; 
+      ++liter_idxParent;
+
+      INPUT_ITERATOR lchrom_child1  = aiiterator_instfirstChild; 
+      ++aiiterator_instfirstChild;
+      INPUT_ITERATOR lchrom_child2  = aiiterator_instfirstChild; 
+      ++aiiterator_instfirstChild;
+
+      genetic_operator
+	(*lchrom_parent1,
+	 *lchrom_parent2,
+	 *lchrom_child1,
+	 *lchrom_child2
+	 );
+    }
+}
+
+
 /*! \fn void crossoverFirstLast(INPUT_ITERATOR aiiterator_instfirstParent, const INPUT_ITERATOR aiiterator_instlastParent, INPUT_ITERATOR aiiterator_instfirstChild, const INPUT_ITERATOR aiiterator_instlastChild, const GENETIC_OPERATOR genetic_operator) 
     \brief Pairs crossover iterator 
     \details Function to iterate over two containers, selected pairs consecutively to apply a crossover operator
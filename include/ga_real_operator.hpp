@@ -19,7 +19,7 @@
 #include "verbose_global.hpp"
 
 
-extern StdMT19937       gmt19937_eng;
+extern thread_local StdMT19937       gmt19937_eng;
 
 /*! \namespace garealop
   \brief Genetic real operators
@@ -366,11 +366,11 @@ randomMutation(gaencode::ChromFixedLength<T_GENE,T_REAL>  &aiochromfixlen_toMuta
   }
 #endif //__VERBOSE_YES
 
-  static std::uniform_int_distribution<uintidx> lsuniformdis_ui0KD
+  std::uniform_int_distribution<uintidx> luniformdis_ui0KD
     (0,gaencode::ChromFixedLength<T_GENE,T_REAL>::stcgetStringSize()-1);
   static std::uniform_real_distribution<T_REAL> lsuniformdis_real01(0.0, 1.0);
 
-  const uintidx  liui_randPositionGene(lsuniformdis_ui0KD(gmt19937_eng));
+  const uintidx  liui_randPositionGene(luniformdis_ui0KD(gmt19937_eng));
 
   T_GENE lt_gene = aiochromfixlen_toMutate.getGene(liui_randPositionGene);
   
@@ -454,11 +454,11 @@ randomMutation(gaencode::ChromVariableLength<T_GENE,T_REAL>  &aiochromfixlen_toM
   }
 #endif //__VERBOSE_YES
 
-  std::uniform_int_distribution<uintidx> lsuniformdis_ui0KD
+  std::uniform_int_distribution<uintidx> luniformdis_ui0KD
     (0,aiochromfixlen_toMutate.getStringSize()-1);
   static std::uniform_real_distribution<T_REAL> lsuniformdis_real01(0.0, 1.0);
 
-  const uintidx  liui_randPositionGene(lsuniformdis_ui0KD(gmt19937_eng));
+  const uintidx  liui_randPositionGene(luniformdis_ui0KD(gmt19937_eng));
 
   T_GENE lt_gene = aiochromfixlen_toMutate.getGene(liui_randPositionGene);
   
@@ -19,7 +19,7 @@
 #include "random_ext.hpp"
 #include "verbose_global.hpp"
 
-extern StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace gaselect
   \brief Chromosome selection method in genetic algorithms
@@ -17,6 +17,7 @@
 //#include "outfilename.hpp"
 #include "common.hpp"
 #include "linear_algebra_level1.hpp"
+#include "problem_context.hpp"
 
 #define INSTANCE_OUT_SEPARATOR_DEFAULT  ','
 
@@ -41,28 +42,28 @@ public:
  
   Instance()
     : _ptc_id(NULL)
-    , _arrayt_feature(new T_FEATURE[_stcuintidx_numDimensions])  
+    , _arrayt_feature(new T_FEATURE[getNumDimensions()])  
   {
-    if (_stcb_homogeneousCoord ) {
-    _arrayt_feature[_stcuintidx_numDimensions-1] = T_FEATURE(1);
+    if (getHomogeneousCoord() ) {
+    _arrayt_feature[getNumDimensions()-1] = T_FEATURE(1);
     }
   }
 
   Instance(T_FEATURE*  aiarrayt_feature)
     : _ptc_id(NULL)
-    , _arrayt_feature(new T_FEATURE[_stcuintidx_numDimensions])  
+    , _arrayt_feature(new T_FEATURE[getNumDimensions()])  
   {
     interfacesse::copy
       (_arrayt_feature,
        aiarrayt_feature,
-       _stcuintidx_numDimensions
+       getNumDimensions()
       );
   }
 
   //copy constructor
   Instance(const Instance<T_FEATURE> &aiinst_b)
     : _ptc_id(NULL)
-    , _arrayt_feature(new T_FEATURE[_stcuintidx_numDimensions])
+    , _arrayt_feature(new T_FEATURE[getNumDimensions()])
   {
     if (aiinst_b._ptc_id != NULL ) {
       this->_ptc_id = new char[strlen(aiinst_b._ptc_id) + 1];
@@ -71,7 +72,7 @@ public:
     interfacesse::copy
       (_arrayt_feature,
        aiinst_b._arrayt_feature,
-       _stcuintidx_numDimensions
+       getNumDimensions()
       );
   }
 
@@ -110,7 +111,7 @@ public:
       interfacesse::copy
 	(_arrayt_feature,
 	 aiinst_b._arrayt_feature,
-	 _stcuintidx_numDimensions
+	 getNumDimensions()
 	 );      
     }
 
@@ -137,25 +138,31 @@ public:
     return *this;
   }
 
+  /*! \fn static void setNumDimensions(uintidx aiuintidx_numDimensions)
+    \brief Number of dimensions of the instances of the problem, see ProblemContext::current()
+  */
   inline static void setNumDimensions(uintidx aiuintidx_numDimensions) 
   {
-    _stcuintidx_numDimensions =
-      (_stcb_homogeneousCoord)?(aiuintidx_numDimensions+1):aiuintidx_numDimensions;
+    ProblemContext& lcontext_problem = ProblemContext::current();
+    lcontext_problem.setNumDimensions
+      ( (lcontext_problem.getHomogeneousCoord())
+	?(aiuintidx_numDimensions+1):aiuintidx_numDimensions
+	);
   }
 
   inline static uintidx getNumDimensions()
   {
-    return  _stcuintidx_numDimensions;
+    return ProblemContext::current().getNumDimensions();
   } 
 
   inline static void setHomogeneousCoord(bool aib_homogeneousCoord) 
   {
-    _stcb_homogeneousCoord = aib_homogeneousCoord;
+    ProblemContext::current().setHomogeneousCoord(aib_homogeneousCoord);
   }
 
   inline static bool getHomogeneousCoord()
   {
-    return _stcb_homogeneousCoord;
+    return ProblemContext::current().getHomogeneousCoord();
   }
 
   inline static T_FEATURE type()
@@ -209,7 +216,7 @@ public:
     using namespace std;
     istringstream liss_stringstream;
     uintidx        luintidx_numDimensions =
-      (_stcb_homogeneousCoord)?_stcuintidx_numDimensions-1:_stcuintidx_numDimensions;
+      (getHomogeneousCoord())?getNumDimensions()-1:getNumDimensions();
     
     for (uintidx luintidx_j = 0; luintidx_j < luintidx_numDimensions; luintidx_j++) {
       liss_stringstream.clear();
@@ -253,7 +260,7 @@ public:
     std::stringstream lss_instance;
     uintidx            luintidx_numDimensions;
     
-    luintidx_numDimensions = _stcuintidx_numDimensions-1;
+    luintidx_numDimensions = getNumDimensions()-1;
     if ( _ptc_id != NULL ) 
       lss_instance << _ptc_id << aic_delim;
     for( uintidx luintidx_j = 0; luintidx_j < luintidx_numDimensions; luintidx_j++){
@@ -266,7 +273,7 @@ public:
 
   virtual void print(std::ostream &os=std::cout, const char aic_delim='\t') const
   {
-    uintidx luintidx_numDimensions = _stcuintidx_numDimensions-1;
+    uintidx luintidx_numDimensions = getNumDimensions()-1;
     if ( _ptc_id != NULL ) 
       os << _ptc_id << aic_delim;
     for( uintidx luintidx_j = 0; luintidx_j < luintidx_numDimensions; luintidx_j++){
@@ -279,19 +286,10 @@ protected:
   
   char           *_ptc_id;
   T_FEATURE      *_arrayt_feature;  
-  static uintidx _stcuintidx_numDimensions;
-  static bool    _stcb_homogeneousCoord;
 
 }; /*Instances*/
 
   
-template <class T_FEATURE>
-uintidx Instance<T_FEATURE>::_stcuintidx_numDimensions = 0;
-
-template <class T_FEATURE>
-bool Instance<T_FEATURE>::_stcb_homogeneousCoord = false;
-
-  
 } /*END namespace data 
    */
 
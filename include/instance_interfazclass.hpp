@@ -135,6 +135,22 @@ public:
       }
    }
 
+  /*! \fn static std::pair<MapClassLabel,T_CLUSTERIDX> getClassTable()
+    \brief Copy of the class labels read, so the instances can be used after another data set is read, see setClassTable
+  */
+  static std::pair<MapClassLabel,T_CLUSTERIDX> getClassTable()
+  {
+    return std::make_pair(_stmap_instanceClass,_idxmcT_consecutiveClass);
+  }
+
+  static void setClassTable
+  (const std::pair<MapClassLabel,T_CLUSTERIDX> &aipair_classTable)
+  {
+    _stmap_instanceClass     = aipair_classTable.first;
+    _idxmcT_consecutiveClass = aipair_classTable.second;
+    setVectorClassLabel();
+  }
+
   static const std::vector
   <CountLabel
    <T_CLUSTERIDX,
@@ -0,0 +1,75 @@
+/*! \file instance_view.hpp
+ *
+ * \brief Instance that refers to features stored outside of the instance
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __INSTANCE_VIEW_HPP
+#define __INSTANCE_VIEW_HPP
+
+#include "instance_class.hpp"
+
+/*! \namespace data
+  \brief Module for the handling of instances or also called objects or points.
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace data {
+
+/*! \class InstanceView
+  \brief Instance with class whose features are not owned, they point to a row of a larger storage (eg. a file mapped in memory)
+  \details The view is reused for different rows, so a pointer to it is only valid until the view is changed again. It can not be copied
+*/
+template < class T_FEATURE,
+	   class T_INSTANCES_CLUSTER_K,
+	   class T_CLUSTERIDX
+	   >
+class InstanceView
+  : public InstanceClass<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+{
+public:
+  InstanceView()
+    : InstanceClass<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>()
+  {
+    delete [] this->_arrayt_feature;
+    this->_arrayt_feature = NULL;
+  }
+
+  InstanceView
+  (const InstanceView<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiinstview_b) = delete;
+
+  InstanceView<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>&
+  operator=(const InstanceView<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiinstview_b) = delete;
+
+  virtual ~InstanceView()
+  {
+    /*THE FEATURES ARE NOT DELETED BY Instance*/
+    this->_arrayt_feature = NULL;
+  }
+
+  /*! \fn void setView(T_FEATURE *aiarrayt_feature, const T_CLUSTERIDX aicidx_classIdx)
+    \brief Points the instance to other features
+    \param aiarrayt_feature an array with Instance::getNumDimensions() features
+    \param aicidx_classIdx a class index, UNKNOWN_CLUSTER_IDX if the instance has no class
+  */
+  inline void setView(T_FEATURE *aiarrayt_feature, const T_CLUSTERIDX aicidx_classIdx)
+  {
+    this->_arrayt_feature = aiarrayt_feature;
+    this->_cidx_classIdx  = aicidx_classIdx;
+  }
+
+}; /*END CLASS InstanceView*/
+
+} /*END namespace data
+   */
+
+#endif /*__INSTANCE_VIEW_HPP*/
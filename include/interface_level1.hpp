@@ -432,6 +432,35 @@ aysxpy
   }
 }
 
+/*! \fn void aysxpy(float *aoarrayf_y, const double aid_alpha, const float *aiarrayf_x, const uintidx aiui_lengthArray)
+  \brief  extension of xAXPY operation for float with a double constant
+  \details
+\f[
+   y \leftarrow y + \alpha (y - x)
+\f]
+  \param aoarrayf_y a array of float
+  \param aid_alpha  a const double
+  \param aiarrayf_x a array of float
+  \param aiui_lengthArray a unsigned integer with aiarrayf_x length 
+*/
+inline
+void
+aysxpy
+(float          *aoarrayf_y,
+ const double   aid_alpha,
+ const float    *aiarrayf_x,
+ const uintidx  aiui_lengthArray
+)
+{
+  float *last1  = aoarrayf_y + aiui_lengthArray;
+  while (aoarrayf_y != last1) {
+    *aoarrayf_y = float
+      ( double(*aoarrayf_y) + aid_alpha * (double(*aoarrayf_y) - double(*aiarrayf_x)) );
+    ++aoarrayf_y;
+    ++aiarrayf_x;
+  }
+}
+
 /*! \fn void aysxpy (int *aoarrayi_y, const double aid_alpha, const int *aiarrayi_x, const uintidx  aiui_lengthArray)
   \brief  extension of xAXPY operation 
   \details
@@ -626,6 +626,106 @@ transy
 }
 
 
+
+/*! \fn void aysxpy(float *aioarrayfloat_y, const double aid_alpha, const float *aiarrayfloat_x, const uintidx aiui_lengthArray)
+  \brief  extension of xAXPY operation for float with a double constant
+  \details
+\f[
+   y \leftarrow y + \alpha (y - x)
+\f]
+  \param aioarrayfloat_y a array of float
+  \param aid_alpha  a const double
+  \param aiarrayfloat_x a array of float
+  \param aiui_lengthArray a unsigned integer with aiarrayfloat_x length 
+*/
+inline
+void
+aysxpy
+(float         *aioarrayfloat_y,
+ const double  aid_alpha,
+ const float   *aiarrayfloat_x,
+ const uintidx aiui_lengthArray
+)
+{
+  for (uintidx lui_i = 0; lui_i < aiui_lengthArray; lui_i++) 
+    aioarrayfloat_y[lui_i] = float
+      ( double(aioarrayfloat_y[lui_i])
+	+ aid_alpha * (double(aioarrayfloat_y[lui_i]) - double(aiarrayfloat_x[lui_i])) );
+}
+
+/*! \fn void axpy(double *aioarraydouble_y, const float aif_alpha, const float *aiarrayfloat_x, const uintidx aiui_lengthArray)
+  \brief  function xAXPY of blas, accumulates float vectors in double
+  \details
+\f[
+   y \leftarrow \alpha x + y
+\f]
+  \param aioarraydouble_y a array of double
+  \param aif_alpha a float constant
+  \param aiarrayfloat_x a array of float
+  \param aiui_lengthArray a unsigned integer with aiarrayfloat_x length 
+*/
+inline
+void
+axpy
+(double        *aioarraydouble_y,
+ const float   aif_alpha,
+ const float   *aiarrayfloat_x,
+ const uintidx aiui_lengthArray
+)
+{
+  const double ld_alpha = double(aif_alpha);
+  for (uintidx lui_i = 0; lui_i < aiui_lengthArray; lui_i++)
+    aioarraydouble_y[lui_i] += ld_alpha * double(aiarrayfloat_x[lui_i]);
+}
+
+/*! \fn void axpyInv(float *aoarrayfloat_y, const T_INT ait_alpha, const double *aiarraydouble_x, const uintidx aiui_lengthArray) 
+  \brief  function xAXPY-inverse for a float vector and a sum in double
+  \details
+\f[
+   y \leftarrow \frac{1}{\alpha} x + y
+\f]
+  \param aoarrayfloat_y a array of float
+  \param ait_alpha a scale factor constant integer
+  \param aiarraydouble_x a array of double
+  \param aiui_lengthArray a unsigned integer with aiarraydouble_x length 
+*/
+template < typename T_INT >
+void
+axpyInv
+(float         *aoarrayfloat_y,
+ const T_INT   ait_alpha,
+ const double  *aiarraydouble_x,
+ const uintidx aiui_lengthArray
+)
+{
+  const double ld_alphaInv = 1.0 / double(ait_alpha);
+  for (uintidx lui_i = 0; lui_i < aiui_lengthArray; lui_i++)
+    aoarrayfloat_y[lui_i] = float
+      ( double(aoarrayfloat_y[lui_i]) + ld_alphaInv * aiarraydouble_x[lui_i] );
+}
+
+/*! \fn void transy(float *aoarrayfloat_y, const float aif_alpha, const uintidx aiui_lengthArray)
+  \brief  translate aoarrayfloat_y array for float
+  \details
+\f[
+   y \leftarrow y +  \alpha
+\f]
+  \param aoarrayfloat_y a array of float
+  \param aif_alpha a float 
+  \param aiui_lengthArray a unsigned integer with aoarrayfloat_y length 
+*/
+inline
+void
+transy
+(float         *aoarrayfloat_y,
+ const float   aif_alpha,
+ const uintidx aiui_lengthArray
+)
+{
+  for (uintidx lui_i = 0; lui_i < aiui_lengthArray; lui_i++)
+    aoarrayfloat_y[lui_i] += aif_alpha;
+}
+
 /*! \fn long int sum(const int *aiarrayint_y, const uintidx aiui_lengthArray)
   \brief  return the sum array items int
   \details
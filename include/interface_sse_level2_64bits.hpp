@@ -129,6 +129,70 @@ gemm
      );  
 }
 
+
+/*! \fn void gemm(mat::MatrixRow<float> &aomatrixrowt_C, const mat::MatrixRow<float> &aimatrixrowt_A, const mat::MatrixRow<float> &aimatrixrowt_B, const enum CBLAS_TRANSPOSE aienum_transA = CblasNoTrans, const enum CBLAS_TRANSPOSE aienum_transB = CblasNoTrans, const float airt_alpha = 1.0, const float airt_beta  = 0.0)
+  \brief  gemm of blas operation for float
+  \details
+\f[
+C \leftarrow \alpha op(A)op(B) +  \beta C
+\f]
+  \param aomatrixrowt_C a mat::MatrixRow<float>
+  \param aimatrixrowt_A a const mat::MatrixRow<float>
+  \param aienum_transA a enum CBLAS_TRANSPOSE default No transpose
+  \param aienum_transB a  enum CBLAS_TRANSPOSE default No transpose
+  \param airt_alpha a real number float 
+  \param airt_beta a real number float 
+*/
+inline
+void
+gemm
+(mat::MatrixRow<float>       &aomatrixrowt_C,
+ const mat::MatrixRow<float> &aimatrixrowt_A,
+ const mat::MatrixRow<float> &aimatrixrowt_B,
+ const enum mat::TRANSPOSE   aienum_transA = mat::CblasNoTrans,
+ const enum mat::TRANSPOSE   aienum_transB = mat::CblasNoTrans,
+ const float                 airt_alpha = 1.0,
+ const float                 airt_beta  = 0.0
+ )
+{
+  const int lii_ka = (aienum_transA == mat::CblasNoTrans)
+    ?(int) aimatrixrowt_A.getNumColumns()
+    :(int) aimatrixrowt_A.getNumRows();
+  const int lii_kb = (aienum_transB == mat::CblasNoTrans)
+    ?(int) aimatrixrowt_B.getNumRows()
+    :(int) aimatrixrowt_B.getNumColumns();
+  enum CBLAS_TRANSPOSE lienum_transA = (CBLAS_TRANSPOSE) aienum_transA;
+  enum CBLAS_TRANSPOSE lienum_transB = (CBLAS_TRANSPOSE) aienum_transB;
+    
+  if ( lii_ka != lii_kb )  
+    throw  std::range_error
+    ("Matrix<float>::operator*: order of the matrices is different");
+  
+  const int64_t lii_m = (int64_t)  aomatrixrowt_C.getNumRows(); 
+  const int64_t lii_n = (int64_t)  aomatrixrowt_C.getNumColumns();
+  
+  const int64_t lii_lda = (int64_t) aimatrixrowt_A.getNumColumns();
+  const int64_t lii_ldb = (int64_t) aimatrixrowt_B.getNumColumns(); 
+  const int64_t lii_ldc = (int64_t) aomatrixrowt_C.getNumColumns(); 
+
+  cblas_sgemm
+    (CblasRowMajor,
+     lienum_transA,
+     lienum_transB,
+     lii_m,
+     lii_n,
+     lii_ka,
+     airt_alpha,
+     aimatrixrowt_A.toArray(),
+     lii_lda,
+     aimatrixrowt_B.toArray(),
+     lii_ldb,
+     airt_beta,
+     aomatrixrowt_C.toArray(),
+     lii_ldc
+     );  
+}
+
 } /*END namespace interfacesse*/
 
 #endif  /* INTERFACE_CLAPACK_LEVEL2_HPP */
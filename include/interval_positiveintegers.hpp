@@ -60,6 +60,10 @@ public:
     ++this->ui_upperBound;
   }
 
+  inline void setUpperBound(T_INTEGERDATATYPE aiui_upperBound) { 
+    this->ui_upperBound = aiui_upperBound;
+  }
+
   inline void setSizeInterval(T_INTEGERDATATYPE aiui_sizeInterval)   
   {
     this->ui_sizeInterval = aiui_sizeInterval;
@@ -34,6 +34,9 @@
 #include <supervised_measures.hpp>
 
 #include <unsupervised_measures.hpp>
+#include <unsupervised_measures_report.hpp>
+#include <unsupervised_measures_pairwise.hpp>
+#include <unsupervised_measures_distsums.hpp>
 
 //Headers GA and EA
 
@@ -42,6 +45,7 @@
 
 #include <chromosome_crispmatrix.hpp>
 #include <chromosome_fixedlength.hpp>
+#include <population_arena.hpp>
 
 //Headers Extension of chromosomes
 
@@ -59,6 +63,9 @@
 #include <ga_function_objective_sse.hpp>
 
 #include <dist_euclidean.hpp>
+#include <nearestcentroids_block.hpp>
+#include <coreset.hpp>
+#include <minibatch.hpp>
 
 //Headers Other tools
 
@@ -17,6 +17,8 @@
 #include <vector>
 #include <string>
 #include <string.h>
+#include <cstdlib>
+#include <cstdint>
 #include "common.hpp"
 
 #include "verbose_global.hpp"
@@ -31,6 +33,76 @@
 */
 
 namespace  inout {
+
+/*! \fn double strtodFast(const char *aipc_str, char **aopc_end)
+    \brief Same as std::strtod, a number with at most 19 significant digits and a power of ten of at most 22 is the product or quotient of two exact doubles, so it is correctly rounded without calling std::strtod (fast path of Clinger). The other numbers are converted by std::strtod
+*/
+inline double strtodFast(const char *aipc_str, char **aopc_end)
+{
+  static const double larrayd_pow10[] =
+    {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  const char *lpc_char = aipc_str;
+  while ( *lpc_char == ' ' || *lpc_char == '\t' )
+    ++lpc_char;
+  const bool lb_negative = (*lpc_char == '-');
+  if ( *lpc_char == '-' || *lpc_char == '+' )
+    ++lpc_char;
+
+  uint64_t lui_mantissa  = 0;
+  int      li_numDigits  = 0;
+  int      li_exp10      = 0;
+  bool     lb_withDigits = false;
+  while ( *lpc_char >= '0' && *lpc_char <= '9' ) {
+    lui_mantissa = lui_mantissa * 10 + uint64_t(*lpc_char - '0');
+    if ( lui_mantissa > 0 && ++li_numDigits > 19 )
+      return std::strtod(aipc_str,aopc_end);
+    lb_withDigits = true;
+    ++lpc_char;
+  }
+  if ( *lpc_char == '.' ) {
+    ++lpc_char;
+    while ( *lpc_char >= '0' && *lpc_char <= '9' ) {
+      lui_mantissa = lui_mantissa * 10 + uint64_t(*lpc_char - '0');
+      if ( lui_mantissa > 0 && ++li_numDigits > 19 )
+	return std::strtod(aipc_str,aopc_end);
+      --li_exp10;
+      lb_withDigits = true;
+      ++lpc_char;
+    }
+  }
+  /*nan, inf, hexadecimal or not a number*/
+  if ( !lb_withDigits || *lpc_char == 'x' || *lpc_char == 'X' )
+    return std::strtod(aipc_str,aopc_end);
+  if ( *lpc_char == 'e' || *lpc_char == 'E' ) {
+    const char *lpc_exp = lpc_char + 1;
+    const bool lb_negativeExp = (*lpc_exp == '-');
+    if ( *lpc_exp == '-' || *lpc_exp == '+' )
+      ++lpc_exp;
+    if ( !(*lpc_exp >= '0' && *lpc_exp <= '9') )
+      return std::strtod(aipc_str,aopc_end);
+    int li_exp = 0;
+    while ( *lpc_exp >= '0' && *lpc_exp <= '9' ) {
+      li_exp = li_exp * 10 + (*lpc_exp - '0');
+      if ( li_exp > 1000 )
+	return std::strtod(aipc_str,aopc_end);
+      ++lpc_exp;
+    }
+    li_exp10 += (lb_negativeExp)?-li_exp:li_exp;
+    lpc_char = lpc_exp;
+  }
+  if ( lui_mantissa > (uint64_t(1) << 53) || li_exp10 < -22 || li_exp10 > 22 )
+    return std::strtod(aipc_str,aopc_end);
+
+  double lod_value = double(lui_mantissa);
+  lod_value = (li_exp10 < 0)?lod_value / larrayd_pow10[-li_exp10]
+    :lod_value * larrayd_pow10[li_exp10];
+  if ( aopc_end != NULL )
+    *aopc_end = const_cast<char*>(lpc_char);
+
+  return (lb_negative)?-lod_value:lod_value;
+}
   
 /*! \class LineSplit
   \brief Used for processing files to read
@@ -41,6 +113,8 @@ public:
     : _str_separator()
     , _vectorst_selectColumns(0)
     , _vextorptc_columns(0)
+    , _vectorpc_columns(0)
+    , _vectorc_isSeparator(0)
   { }
   
   LineSplit
@@ -50,6 +124,8 @@ public:
     : _str_separator(aistr_separator)
     , _vectorst_selectColumns(0)
     , _vextorptc_columns(0)
+    , _vectorpc_columns(0)
+    , _vectorc_isSeparator(0)
   {
     this->getSelectColumns(aistr_selectColumns);
   }
@@ -62,6 +138,7 @@ public:
   void setSeparator(const std::string &aistr_separator) 
   {
     _str_separator = aistr_separator;
+    _vectorc_isSeparator.clear();
   }
 
   void  getSelectColumns(std::string aistr_selectColumns)
@@ -140,6 +217,53 @@ public:
 
   }
   
+  /*! \fn uintidx splitReal(const std::string &aistr_line, T_REAL *aoarrayt_value, const uintidx aiui_numValues)
+    \brief The first aiui_numValues selected columns of the line converted to numbers like split and getItemSelect, without copying the columns to strings
+    \return the number of columns of the line
+  */
+  template < typename T_REAL >
+  uintidx splitReal
+  (const std::string &aistr_line,
+   T_REAL            *aoarrayt_value,
+   const uintidx     aiui_numValues
+   )
+  {
+    /*TABLE OF THE SEPARATORS, 2 FOR THE END OF THE LINE*/
+    if ( _vectorc_isSeparator.empty() ) {
+      _vectorc_isSeparator.assign(256,0);
+      for ( const char lc_separator: _str_separator )
+	_vectorc_isSeparator[(unsigned char) lc_separator] = 1;
+      _vectorc_isSeparator[(unsigned char) '\0'] = 2;
+      _vectorc_isSeparator[(unsigned char) '\n'] = 2;
+      _vectorc_isSeparator[(unsigned char) '\r'] = 2;
+    }
+    const char *larrayc_isSeparator = _vectorc_isSeparator.data();
+    const char *lpc_char = aistr_line.c_str();
+
+    _vectorpc_columns.clear();
+    while ( larrayc_isSeparator[(unsigned char) *lpc_char] != 2 ) {
+      if ( larrayc_isSeparator[(unsigned char) *lpc_char] == 1 ) {
+	++lpc_char;
+	continue;
+      }
+      _vectorpc_columns.push_back(lpc_char);
+      while ( larrayc_isSeparator[(unsigned char) *lpc_char] == 0 )
+	++lpc_char;
+    }
+    if ( _vectorst_selectColumns.size() == 0 ) {
+      for (uintidx lui_i = 1; lui_i <= _vectorpc_columns.size(); lui_i++)
+	_vectorst_selectColumns.push_back(lui_i);
+    }
+
+    for (uintidx lui_j = 0; lui_j < aiui_numValues; lui_j++) {
+      const char *lpc_column =
+	_vectorpc_columns.at(_vectorst_selectColumns.at(lui_j)-1);
+      aoarrayt_value[lui_j] = T_REAL(strtodFast(lpc_column,NULL));
+    }
+
+    return (uintidx) _vectorpc_columns.size();
+  }
+
   uintidx getNumSelectColumns() 
   {
     return (uintidx) _vectorst_selectColumns.size();
@@ -176,6 +300,8 @@ protected:
   std::string              _str_separator;
   std::vector<uintidx>     _vectorst_selectColumns;
   std::vector<std::string> _vextorptc_columns;
+  std::vector<const char*> _vectorpc_columns;
+  std::vector<char>        _vectorc_isSeparator;
 
 }; 
 
@@ -319,6 +319,72 @@ inverse(mat::MatrixRow<double>& aiomatrix_a)
   return INFO;
 }
 
+/* \fn int inverse(mat::MatrixRow<float>& aiomatrix_a)
+   \brief Compute the inverse of a matrix
+   \details Compute the inverse of a matrix using the LU factorization for float
+   \param aiomatrix_a a mat::MatrixRow to invest
+*/
+int
+inverse(mat::MatrixRow<float>& aiomatrix_a)
+{
+#ifdef __VERBOSE_YES
+  const char* lpc_labelFunc = "matop_openblaslapacke.hpp::mat::inverse";
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+      std::cout << lpc_labelFunc 
+		<< ":  IN(" << geiinparam_verbose << ")\n";
+      std::ostringstream lostrstream_labelInverse;
+      lostrstream_labelInverse << "<INOUT:" << lpc_labelFunc  
+			       << ":aiomatrix_a";
+      aiomatrix_a.print(std::cout,lostrstream_labelInverse.str().c_str(),',',';');
+      std::cout	<< std::endl;
+  }
+#endif //__VERBOSE_YES
+  
+  const lapack_int lii_m = (lapack_int) aiomatrix_a.getNumRows();
+  const lapack_int lii_n = (lapack_int) aiomatrix_a.getNumColumns();
+  const lapack_int lii_lda = (lapack_int) aiomatrix_a.getNumColumns();
+
+  lapack_int *IPIV = new lapack_int[aiomatrix_a.getNumRows()+1];
+  
+  lapack_int INFO =
+    LAPACKE_sgetrf
+    (LAPACK_ROW_MAJOR,
+     lii_m,
+     lii_n,
+     aiomatrix_a.toArray(),
+     lii_lda,
+     IPIV
+     );
+
+  INFO =
+    LAPACKE_sgetri
+    (LAPACK_ROW_MAJOR,
+     lii_n,
+     aiomatrix_a.toArray(),
+     lii_lda,
+     IPIV
+     );
+
+#ifdef __VERBOSE_YES
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ": OUT(" << geiinparam_verbose << ")\n";
+    std::ostringstream lostrstream_labelInverse;
+    lostrstream_labelInverse << "<INVERSE:" << lpc_labelFunc  
+			       << ":aiomatrix_a";
+    aiomatrix_a.print(std::cout,lostrstream_labelInverse.str().c_str(),',',';');
+    std::cout << std::endl;
+  }
+  --geiinparam_verbose;
+#endif //__VERBOSE_YES
+  
+  
+  delete [] IPIV;
+
+  return INFO;
+}
+
 } /*END namespace mat */
   
 #endif /*MATOP_OPENBLAS_LAPACKE_HPP*/
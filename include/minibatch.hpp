@@ -0,0 +1,399 @@
+/*! \file minibatch.hpp
+ *
+ * \brief fitness estimated on a mini-batch of instances
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * The fitness of the centroid encoded algorithms can be estimated
+ * on a rotating stratified sample of the instances, the size of the
+ * sample grows across the generations until it is the full data set.
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __MINIBATCH_HPP
+#define __MINIBATCH_HPP
+
+#include <vector>
+#include <iterator>
+#include <random>
+#include <cmath>
+#include <utility>
+#include "matrix.hpp"
+#include "dist.hpp"
+#include "random_ext.hpp"
+#include "clustering_operator_centroids.hpp"
+#include "partition_centroids.hpp"
+#include "unsupervised_measures.hpp"
+
+#include "verbose_global.hpp"
+
+extern thread_local StdMT19937  gmt19937_eng;
+
+/*! \namespace minibatch
+  \brief Estimation of the fitness on a sample of the instances
+  \details The functions evaluate over the sample while it is active, otherwise over all the instances
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace minibatch {
+
+/*! \class StratifiedSample
+  \brief Rotating stratified sample of a sequence of instances
+  \details The sequence is split in size() strata of consecutive instances and one instance is drawn at random from each stratum. A new sample is drawn in each generation with next() and its size is multiplied by the growth factor. When the size reaches the number of instances the sample is no longer active and the full data set is used. The sample keeps pointers to the instances, so the iterator must be of random access and its instances must not be views (inout::InstancesMmap)
+*/
+template <typename INPUT_ITERATOR>
+class StratifiedSample {
+public:
+  typedef typename std::iterator_traits<INPUT_ITERATOR>::value_type value_type;
+  typedef typename std::vector<value_type>::const_iterator          const_iterator;
+
+  /*! \fn StratifiedSample(const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const uintidx aiui_sizeInitial, const double aid_growth)
+    \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+    \param aiui_sizeInitial size of the sample in the first generation, 0 the sample is not used
+    \param aid_growth factor that multiplies the size of the sample in each generation
+  */
+  StratifiedSample
+  (const INPUT_ITERATOR aiiterator_instfirst,
+   const INPUT_ITERATOR aiiterator_instlast,
+   const uintidx        aiui_sizeInitial,
+   const double         aid_growth
+   )
+    : _iterator_instfirst(aiiterator_instfirst)
+    , _iterator_instlast(aiiterator_instlast)
+    , _ui_numInstances(uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)))
+    , _d_size(double(aiui_sizeInitial))
+    , _d_growth( (aid_growth < 1.0)?1.0:aid_growth )
+    , _b_used(false)
+    , _vector_sample()
+  {}
+
+  /*! \fn void next()
+    \brief Draw the sample of the next generation
+  */
+  void next()
+  {
+    if ( this->_d_size == 0.0 )
+      return;
+
+    if ( this->_b_used )
+      this->_d_size *= this->_d_growth;
+
+    const uintidx lui_sizeSample = uintidx(std::ceil(this->_d_size));
+
+    if ( lui_sizeSample >= this->_ui_numInstances ) {
+      /*FROM NOW ON, THE FITNESS IS COMPUTED ON ALL THE INSTANCES
+       */
+      this->_d_size = 0.0;
+      std::vector<value_type>().swap(this->_vector_sample);
+      return;
+    }
+
+    this->_b_used = true;
+    this->_vector_sample.resize(lui_sizeSample);
+    for ( uintidx lui_j = 0; lui_j < lui_sizeSample; ++lui_j ) {
+      const uintidx lui_strataBegin = uintidx
+	( (unsigned long long) lui_j * this->_ui_numInstances / lui_sizeSample );
+      const uintidx lui_strataEnd = uintidx
+	( (unsigned long long) (lui_j + 1) * this->_ui_numInstances / lui_sizeSample );
+      std::uniform_int_distribution<uintidx>
+	uniformdis_uiStrata(lui_strataBegin,lui_strataEnd - 1);
+      this->_vector_sample[lui_j] =
+	*(this->_iterator_instfirst + uniformdis_uiStrata(gmt19937_eng));
+    }
+  }
+
+  /*! \fn bool isActive() const
+    \brief True if the current generation is evaluated on the sample
+  */
+  inline bool isActive() const
+  {
+    return !this->_vector_sample.empty();
+  }
+
+  /*! \fn bool isUsed() const
+    \brief True if some generation was evaluated on a sample
+  */
+  inline bool isUsed() const
+  {
+    return this->_b_used;
+  }
+
+  inline const_iterator begin() const
+  {
+    return this->_vector_sample.begin();
+  }
+
+  inline const_iterator end() const
+  {
+    return this->_vector_sample.end();
+  }
+
+  inline const INPUT_ITERATOR getInstFirst() const
+  {
+    return this->_iterator_instfirst;
+  }
+
+  inline const INPUT_ITERATOR getInstLast() const
+  {
+    return this->_iterator_instlast;
+  }
+
+  /*! \fn uintidx size() const
+    \brief Number of instances evaluated in the current generation
+  */
+  inline uintidx size() const
+  {
+    return this->isActive()?uintidx(this->_vector_sample.size()):this->_ui_numInstances;
+  }
+
+  /*! \fn double getScale() const
+    \brief Factor to estimate a sum over all the instances from the sum over the sample
+  */
+  inline double getScale() const
+  {
+    return double(this->_ui_numInstances) / double(this->size());
+  }
+
+protected:
+  const INPUT_ITERATOR     _iterator_instfirst;
+  const INPUT_ITERATOR     _iterator_instlast;
+  const uintidx            _ui_numInstances;
+  double                   _d_size;
+  const double             _d_growth;
+  bool                     _b_used;
+  std::vector<value_type>  _vector_sample;
+
+}; /*END CLASS StratifiedSample*/
+
+
+/*! \fn std::pair<T_METRIC,bool> SSE(const mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, const StratifiedSample<INPUT_ITERATOR> &aisample_inst, const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist)
+  \brief SSE of the centroids, estimated on the sample if it is active
+  \details The SSE of the sample is scaled to the number of instances, so it is comparable with the SSE of the full data set
+  \param aimatrixt_centroids a matrix with the centroids
+  \param aisample_inst a minibatch::StratifiedSample of the instances
+  \param aifunc2p_dist an object of type dist::Dist to calculate distances
+*/
+template < typename INPUT_ITERATOR,
+	   typename T_METRIC,
+	   typename T_FEATURE
+	   >
+std::pair<T_METRIC,bool>
+SSE
+(const mat::MatrixRow<T_FEATURE>          &aimatrixt_centroids,
+ const StratifiedSample<INPUT_ITERATOR>   &aisample_inst,
+ const dist::Dist<T_METRIC,T_FEATURE>     &aifunc2p_dist
+ )
+{
+  if ( aisample_inst.isActive() ) {
+    std::pair<T_METRIC,bool> lopair_SSE =
+      um::SSE
+      (aimatrixt_centroids,
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       aifunc2p_dist
+       );
+    lopair_SSE.first *= T_METRIC(aisample_inst.getScale());
+    return lopair_SSE;
+  }
+
+  return um::SSE
+    (aimatrixt_centroids,
+     aisample_inst.getInstFirst(),
+     aisample_inst.getInstLast(),
+     aifunc2p_dist
+     );
+}
+
+
+/*! \fn void updateCentroids(T_CLUSTERIDX &aocidx_numClusterNull, mat::MatrixRow<T_FEATURE> &aiomatrixt_centroids, mat::MatrixRow<T_FEATURE_SUM> &aomatrixt_sumInstancesCluster, std::vector<T_INSTANCES_CLUSTER_K> &aovectort_numInstancesInClusterK, const StratifiedSample<INPUT_ITERATOR> &aisample_inst, const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist)
+  \brief clusteringop::updateCentroids with the sample if it is active
+*/
+template < typename INPUT_ITERATOR,
+	   typename T_FEATURE,
+	   typename T_FEATURE_SUM,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX,
+	   typename T_DIST
+	   >
+void
+updateCentroids
+(T_CLUSTERIDX                             &aocidx_numClusterNull,
+ mat::MatrixRow<T_FEATURE>                &aiomatrixt_centroids,
+ mat::MatrixRow<T_FEATURE_SUM>            &aomatrixt_sumInstancesCluster,
+ std::vector<T_INSTANCES_CLUSTER_K>       &aovectort_numInstancesInClusterK,
+ const StratifiedSample<INPUT_ITERATOR>   &aisample_inst,
+ const dist::Dist<T_DIST,T_FEATURE>       &aifunc2p_dist
+ )
+{
+  if ( aisample_inst.isActive() )
+    clusteringop::updateCentroids
+      (aocidx_numClusterNull,
+       aiomatrixt_centroids,
+       aomatrixt_sumInstancesCluster,
+       aovectort_numInstancesInClusterK,
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       aifunc2p_dist
+       );
+  else
+    clusteringop::updateCentroids
+      (aocidx_numClusterNull,
+       aiomatrixt_centroids,
+       aomatrixt_sumInstancesCluster,
+       aovectort_numInstancesInClusterK,
+       aisample_inst.getInstFirst(),
+       aisample_inst.getInstLast(),
+       aifunc2p_dist
+       );
+}
+
+
+/*! \fn T_METRIC dbindex(mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, const StratifiedSample<INPUT_ITERATOR> &aisample_inst, const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist)
+  \brief Davies-Bouldin index of the partition of the centroids, on the sample if it is active
+  \details The index is a ratio of averages, so the value of the sample is an estimation without scale. T_CLUSTERIDX is given explicitly, eg. minibatch::dbindex<T_CLUSTERIDX>(...)
+*/
+template < typename T_CLUSTERIDX,
+	   typename INPUT_ITERATOR,
+	   typename T_METRIC,
+	   typename T_FEATURE
+	   >
+T_METRIC
+dbindex
+(mat::MatrixRow<T_FEATURE>                &aimatrixt_centroids,
+ const StratifiedSample<INPUT_ITERATOR>   &aisample_inst,
+ const dist::Dist<T_METRIC,T_FEATURE>     &aifunc2p_dist
+ )
+{
+  if ( aisample_inst.isActive() ) {
+    auto lpartition_clusters =
+      partition::makePartition
+      (aimatrixt_centroids,
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       T_CLUSTERIDX(aimatrixt_centroids.getNumRows()),
+       aifunc2p_dist
+       );
+    return um::dbindex
+      (aimatrixt_centroids,
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       lpartition_clusters,
+       aifunc2p_dist
+       );
+  }
+
+  auto lpartition_clusters =
+    partition::makePartition
+    (aimatrixt_centroids,
+     aisample_inst.getInstFirst(),
+     aisample_inst.getInstLast(),
+     T_CLUSTERIDX(aimatrixt_centroids.getNumRows()),
+     aifunc2p_dist
+     );
+  return um::dbindex
+    (aimatrixt_centroids,
+     aisample_inst.getInstFirst(),
+     aisample_inst.getInstLast(),
+     lpartition_clusters,
+     aifunc2p_dist
+     );
+}
+
+
+/*! \fn T_METRIC indexI(mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, const StratifiedSample<INPUT_ITERATOR> &aisample_inst, const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist)
+  \brief Index I of the partition of the centroids, on the sample if it is active
+  \details um::indexI keeps \f$E_1\f$ of the first sequence it receives, so on the sample \f$E_1\f$ and \f$E_K\f$ are both computed over the current sample and their ratio estimates the one of all the instances
+*/
+template < typename T_CLUSTERIDX,
+	   typename INPUT_ITERATOR,
+	   typename T_METRIC,
+	   typename T_FEATURE
+	   >
+T_METRIC
+indexI
+(mat::MatrixRow<T_FEATURE>                &aimatrixt_centroids,
+ const StratifiedSample<INPUT_ITERATOR>   &aisample_inst,
+ const dist::Dist<T_METRIC,T_FEATURE>     &aifunc2p_dist
+ )
+{
+  if ( aisample_inst.isActive() ) {
+    T_METRIC lometric_indexI = measuare_undefIndexI(T_METRIC);
+    if ( aimatrixt_centroids.getNumRows() < 2 )
+      return lometric_indexI;
+
+    auto lpartition_clusters =
+      partition::makePartition
+      (aimatrixt_centroids,
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       T_CLUSTERIDX(aimatrixt_centroids.getNumRows()),
+       aifunc2p_dist
+       );
+    std::pair<T_METRIC,bool> lpair_ek = 
+      um::SSE
+      (aimatrixt_centroids,
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       lpartition_clusters,
+       aifunc2p_dist
+       );
+
+    std::vector<T_FEATURE>
+      lvectort_centroid1(data::Instance<T_FEATURE>::getNumDimensions());
+    std::vector<decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))>
+      lvectort_sumFeature(data::Instance<T_FEATURE>::getNumDimensions());
+    stats::sumFeactures
+      (lvectort_sumFeature.data(),
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       T_FEATURE(0)
+       );
+    stats::meanVector
+      (lvectort_centroid1.data(),
+       aisample_inst.size(),
+       lvectort_sumFeature.data()
+       );
+    T_METRIC lmetric_e1 =
+      um::e1
+      (lvectort_centroid1.data(),
+       aisample_inst.begin(),
+       aisample_inst.end(),
+       aifunc2p_dist
+       );
+
+    if ( lpair_ek.first > 0.0 ) {
+      lometric_indexI =
+	(( lmetric_e1 / lpair_ek.first )
+	 * um::maxDistCjCjp(aimatrixt_centroids,aifunc2p_dist) )
+	/ T_METRIC(aimatrixt_centroids.getNumRows());
+      lometric_indexI = lometric_indexI * lometric_indexI;
+    }
+    return lometric_indexI;
+  }
+
+  auto lpartition_clusters =
+    partition::makePartition
+    (aimatrixt_centroids,
+     aisample_inst.getInstFirst(),
+     aisample_inst.getInstLast(),
+     T_CLUSTERIDX(aimatrixt_centroids.getNumRows()),
+     aifunc2p_dist
+     );
+  return um::indexI
+    (aimatrixt_centroids,
+     aisample_inst.getInstFirst(),
+     aisample_inst.getInstLast(),
+     lpartition_clusters,
+     aifunc2p_dist
+     );
+}
+
+} /*END namespace minibatch
+   */
+
+#endif /*__MINIBATCH_HPP*/
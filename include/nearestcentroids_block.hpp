@@ -0,0 +1,503 @@
+/*! \file nearestcentroids_block.hpp
+ *
+ * \brief nearest centroids for a block of instances
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __NEAREST_CENTROIDS_BLOCK_HPP
+#define __NEAREST_CENTROIDS_BLOCK_HPP
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+#include <type_traits>
+#include "instance.hpp"
+#include "matrix.hpp"
+#include "dist.hpp"
+#include "dist_euclidean.hpp"
+#include "nearestinstance_operator.hpp"
+#include "linear_algebra_level2.hpp"
+
+#include "verbose_global.hpp"
+
+/*! \namespace nearest
+  \brief Function to find nearest instances
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace nearest {
+
+#define NEARESTBLOCK_NUMINSTANCES 128
+
+/*! \fn void gemmTile(mat::MatrixRow<T_DIST> &aomatrixt_tile, const mat::MatrixRow<T_DIST> &aimatrixt_block, const mat::MatrixRow<T_DIST> &aimatrixt_centroids, const uintidx aiui_numInstBlock)
+    \brief Dot products between a block of instances and all centroids
+    \details Register blocked kernel \f$ C = A B^T \f$ of four instances by four centroids, only the first aiui_numInstBlock rows of the block are computed
+    \param aomatrixt_tile a mat::MatrixRow of \f$ n_{block} \times k \f$ with the dot products
+    \param aimatrixt_block a mat::MatrixRow with the instances of the block
+    \param aimatrixt_centroids a mat::MatrixRow with the centroids
+    \param aiui_numInstBlock number of valid instances in the block
+ */
+template < typename T_DIST >
+void
+gemmTile
+(mat::MatrixRow<T_DIST>        &aomatrixt_tile,
+ const mat::MatrixRow<T_DIST>  &aimatrixt_block,
+ const mat::MatrixRow<T_DIST>  &aimatrixt_centroids,
+ const uintidx                 aiui_numInstBlock
+ )
+{
+  const uintidx lui_numClusterK = aimatrixt_centroids.getNumRows();
+  const uintidx lui_numDim      = aimatrixt_centroids.getNumColumns();
+
+  uintidx lui_i = 0;
+  for ( ; lui_i + 4 <= aiui_numInstBlock; lui_i += 4 ) {
+    const T_DIST* lpt_a0 = aimatrixt_block.getRow(lui_i);
+    const T_DIST* lpt_a1 = aimatrixt_block.getRow(lui_i+1);
+    const T_DIST* lpt_a2 = aimatrixt_block.getRow(lui_i+2);
+    const T_DIST* lpt_a3 = aimatrixt_block.getRow(lui_i+3);
+    uintidx lui_j = 0;
+    for ( ; lui_j + 4 <= lui_numClusterK; lui_j += 4 ) {
+      const T_DIST* lpt_b0 = aimatrixt_centroids.getRow(lui_j);
+      const T_DIST* lpt_b1 = aimatrixt_centroids.getRow(lui_j+1);
+      const T_DIST* lpt_b2 = aimatrixt_centroids.getRow(lui_j+2);
+      const T_DIST* lpt_b3 = aimatrixt_centroids.getRow(lui_j+3);
+      T_DIST lt_c00 = 0, lt_c01 = 0, lt_c02 = 0, lt_c03 = 0;
+      T_DIST lt_c10 = 0, lt_c11 = 0, lt_c12 = 0, lt_c13 = 0;
+      T_DIST lt_c20 = 0, lt_c21 = 0, lt_c22 = 0, lt_c23 = 0;
+      T_DIST lt_c30 = 0, lt_c31 = 0, lt_c32 = 0, lt_c33 = 0;
+      for (uintidx lui_l = 0; lui_l < lui_numDim; lui_l++) {
+	const T_DIST lt_b0 = lpt_b0[lui_l];
+	const T_DIST lt_b1 = lpt_b1[lui_l];
+	const T_DIST lt_b2 = lpt_b2[lui_l];
+	const T_DIST lt_b3 = lpt_b3[lui_l];
+	T_DIST lt_a = lpt_a0[lui_l];
+	lt_c00 += lt_a * lt_b0; lt_c01 += lt_a * lt_b1;
+	lt_c02 += lt_a * lt_b2; lt_c03 += lt_a * lt_b3;
+	lt_a = lpt_a1[lui_l];
+	lt_c10 += lt_a * lt_b0; lt_c11 += lt_a * lt_b1;
+	lt_c12 += lt_a * lt_b2; lt_c13 += lt_a * lt_b3;
+	lt_a = lpt_a2[lui_l];
+	lt_c20 += lt_a * lt_b0; lt_c21 += lt_a * lt_b1;
+	lt_c22 += lt_a * lt_b2; lt_c23 += lt_a * lt_b3;
+	lt_a = lpt_a3[lui_l];
+	lt_c30 += lt_a * lt_b0; lt_c31 += lt_a * lt_b1;
+	lt_c32 += lt_a * lt_b2; lt_c33 += lt_a * lt_b3;
+      }
+      T_DIST* lpt_c = aomatrixt_tile.getRow(lui_i) + lui_j;
+      lpt_c[0] = lt_c00; lpt_c[1] = lt_c01; lpt_c[2] = lt_c02; lpt_c[3] = lt_c03;
+      lpt_c = aomatrixt_tile.getRow(lui_i+1) + lui_j;
+      lpt_c[0] = lt_c10; lpt_c[1] = lt_c11; lpt_c[2] = lt_c12; lpt_c[3] = lt_c13;
+      lpt_c = aomatrixt_tile.getRow(lui_i+2) + lui_j;
+      lpt_c[0] = lt_c20; lpt_c[1] = lt_c21; lpt_c[2] = lt_c22; lpt_c[3] = lt_c23;
+      lpt_c = aomatrixt_tile.getRow(lui_i+3) + lui_j;
+      lpt_c[0] = lt_c30; lpt_c[1] = lt_c31; lpt_c[2] = lt_c32; lpt_c[3] = lt_c33;
+    }
+    /*remaining centroids*/
+    for ( ; lui_j < lui_numClusterK; lui_j++ ) {
+      const T_DIST* lpt_b = aimatrixt_centroids.getRow(lui_j);
+      T_DIST lt_c0 = 0, lt_c1 = 0, lt_c2 = 0, lt_c3 = 0;
+      for (uintidx lui_l = 0; lui_l < lui_numDim; lui_l++) {
+	lt_c0 += lpt_a0[lui_l] * lpt_b[lui_l];
+	lt_c1 += lpt_a1[lui_l] * lpt_b[lui_l];
+	lt_c2 += lpt_a2[lui_l] * lpt_b[lui_l];
+	lt_c3 += lpt_a3[lui_l] * lpt_b[lui_l];
+      }
+      aomatrixt_tile(lui_i,lui_j)   = lt_c0;
+      aomatrixt_tile(lui_i+1,lui_j) = lt_c1;
+      aomatrixt_tile(lui_i+2,lui_j) = lt_c2;
+      aomatrixt_tile(lui_i+3,lui_j) = lt_c3;
+    }
+  }
+  /*remaining instances*/
+  for ( ; lui_i < aiui_numInstBlock; lui_i++ ) {
+    const T_DIST* lpt_a = aimatrixt_block.getRow(lui_i);
+    T_DIST*       lpt_c = aomatrixt_tile.getRow(lui_i);
+    for (uintidx lui_j = 0; lui_j < lui_numClusterK; lui_j++) {
+      const T_DIST* lpt_b = aimatrixt_centroids.getRow(lui_j);
+      T_DIST lt_c = 0;
+      for (uintidx lui_l = 0; lui_l < lui_numDim; lui_l++)
+	lt_c += lpt_a[lui_l] * lpt_b[lui_l];
+      lpt_c[lui_j] = lt_c;
+    }
+  }
+}
+
+#ifdef __WITH_OPEN_BLAS
+
+/*! \fn void gemmTile(mat::MatrixRow<double> &aomatrixt_tile, const mat::MatrixRow<double> &aimatrixt_block, const mat::MatrixRow<double> &aimatrixt_centroids, const uintidx aiui_numInstBlock)
+    \brief Dot products between a block of instances and all centroids with BLAS gemm
+    \details
+    \param aomatrixt_tile a mat::MatrixRow of \f$ n_{block} \times k \f$ with the dot products
+    \param aimatrixt_block a mat::MatrixRow with the instances of the block
+    \param aimatrixt_centroids a mat::MatrixRow with the centroids
+    \param aiui_numInstBlock number of valid instances in the block
+ */
+inline
+void
+gemmTile
+(mat::MatrixRow<double>        &aomatrixt_tile,
+ const mat::MatrixRow<double>  &aimatrixt_block,
+ const mat::MatrixRow<double>  &aimatrixt_centroids,
+ const uintidx                 aiui_numInstBlock
+ )
+{
+  mat::MatrixRow<double> lmatrixt_tile
+    (aiui_numInstBlock,
+     aomatrixt_tile.getNumColumns(),
+     aomatrixt_tile.toArray()
+     );
+  mat::MatrixRow<double> lmatrixt_block
+    (aiui_numInstBlock,
+     aimatrixt_block.getNumColumns(),
+     const_cast<double*>(aimatrixt_block.toArray())
+     );
+  interfacesse::gemm
+    (lmatrixt_tile,
+     lmatrixt_block,
+     aimatrixt_centroids,
+     mat::CblasNoTrans,
+     mat::CblasTrans
+     );
+}
+
+#endif /*__WITH_OPEN_BLAS*/
+
+
+/*! \class DistBlock
+  \brief Distances between a block of instances and all centroids
+  \details Computes a tile of \f$ n_{block} \times k \f$ distances or the nearest centroid of each instance of the block. For dist::Euclidean and dist::EuclideanSquared the tile is obtained from the precomputed norms and a product \f$ \Vert x \Vert^2 + \Vert \mu \Vert^2 - 2 X M^T \f$, the nearest centroid is confirmed with the distance function, so it is the same as nearest::NN. For other distances the distance function is called for each pair.
+*/
+template < typename T_FEATURE,
+	   typename T_DIST
+	   >
+class DistBlock {
+public:
+  DistBlock
+  (const mat::MatrixRow<T_FEATURE>    &aimatrixt_centroids,
+   const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist,
+   const uintidx                      aiui_numInstBlock = NEARESTBLOCK_NUMINSTANCES
+   )
+    : _matrixt_centroids(aimatrixt_centroids)
+    , _func2p_dist(aifunc2p_dist)
+    , _i_typeDist(DISTBLOCK_GENERIC)
+    , _matrixt_tile
+      (aiui_numInstBlock,
+       aimatrixt_centroids.getNumRows()
+       )
+  {
+    if ( std::is_floating_point<T_DIST>::value
+	 && aimatrixt_centroids.getNumRows() > 0 ) {
+      if ( dynamic_cast<const dist::EuclideanSquared<T_DIST,T_FEATURE>*>
+	   (&aifunc2p_dist) != NULL )
+	_i_typeDist = DISTBLOCK_EUCLIDEANSQ;
+      else if ( dynamic_cast<const dist::Euclidean<T_DIST,T_FEATURE>*>
+		(&aifunc2p_dist) != NULL )
+	_i_typeDist = DISTBLOCK_EUCLIDEAN;
+    }
+    if ( _i_typeDist != DISTBLOCK_GENERIC )
+      this->_initNorms(aiui_numInstBlock);
+  }
+
+  inline const uintidx getNumInstBlock() const
+  {
+    return this->_matrixt_tile.getNumRows();
+  }
+
+  /*! \fn const mat::MatrixRow<T_DIST>& getTile() const
+    \brief Distances computed by the last call to tile, row i for the instance i of the block
+   */
+  inline const mat::MatrixRow<T_DIST>& getTile() const
+  {
+    return this->_matrixt_tile;
+  }
+
+  /*! \fn uintidx tile(INPUT_ITERATOR &aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast)
+    \brief Distances between the next block of instances and all centroids
+    \details The iterator advances to the first instance not processed. For Euclidean distances the values are obtained from the norms and may differ in the last digits from the distance function
+    \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+    \return number of instances in the block
+   */
+  template < typename INPUT_ITERATOR >
+  uintidx
+  tile
+  (INPUT_ITERATOR        &aiiterator_instfirst,
+   const INPUT_ITERATOR  aiiterator_instlast
+   )
+  {
+    uintidx lui_numInstBlock;
+
+    if ( _i_typeDist == DISTBLOCK_GENERIC ) {
+      const uintidx lui_numClusterK = _matrixt_centroids.getNumRows();
+      const uintidx lui_numDim      = _matrixt_centroids.getNumColumns();
+      for ( lui_numInstBlock = 0;
+	    lui_numInstBlock < this->getNumInstBlock()
+	      && aiiterator_instfirst != aiiterator_instlast;
+	    ++lui_numInstBlock, ++aiiterator_instfirst )
+	{
+	  const T_FEATURE* larrayt_inst =
+	    ((data::Instance<T_FEATURE>*) *aiiterator_instfirst)->getFeatures();
+	  T_DIST* lpt_tile = _matrixt_tile.getRow(lui_numInstBlock);
+	  for (uintidx lui_j = 0; lui_j < lui_numClusterK; lui_j++)
+	    lpt_tile[lui_j] =
+	      _func2p_dist(_matrixt_centroids.getRow(lui_j),larrayt_inst,lui_numDim);
+	}
+    }
+    else {
+      lui_numInstBlock = this->_tileSquared(aiiterator_instfirst,aiiterator_instlast);
+      for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++) {
+	T_DIST* lpt_tile = _matrixt_tile.getRow(lui_i);
+	for (uintidx lui_j = 0; lui_j < _matrixt_tile.getNumColumns(); lui_j++) {
+	  if ( lpt_tile[lui_j] < T_DIST(0) )
+	    lpt_tile[lui_j] = T_DIST(0);
+	  if ( _i_typeDist == DISTBLOCK_EUCLIDEAN )
+	    lpt_tile[lui_j] = std::sqrt(lpt_tile[lui_j]);
+	}
+      }
+    }
+
+    return lui_numInstBlock;
+  }
+
+  /*! \fn uintidx NN(T_CLUSTERIDX *aoarraycidx_nearest, T_DIST *aoarrayt_distMin, INPUT_ITERATOR &aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast)
+    \brief Nearest centroid of each instance of the next block
+    \details The result is the same as nearest::NN for each instance. The iterator advances to the first instance not processed
+    \param aoarraycidx_nearest an array of size getNumInstBlock() with the index of the nearest centroid
+    \param aoarrayt_distMin an array of size getNumInstBlock() with the distance to the nearest centroid
+    \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+    \return number of instances in the block
+   */
+  template < typename T_CLUSTERIDX,
+	     typename INPUT_ITERATOR
+	     >
+  uintidx
+  NN
+  (T_CLUSTERIDX          *aoarraycidx_nearest,
+   T_DIST                *aoarrayt_distMin,
+   INPUT_ITERATOR        &aiiterator_instfirst,
+   const INPUT_ITERATOR  aiiterator_instlast
+   )
+  {
+    uintidx lui_numInstBlock;
+    const uintidx lui_numClusterK = _matrixt_centroids.getNumRows();
+    const uintidx lui_numDim      = _matrixt_centroids.getNumColumns();
+
+    if ( _i_typeDist == DISTBLOCK_GENERIC ) {
+      lui_numInstBlock = this->tile(aiiterator_instfirst,aiiterator_instlast);
+      for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++) {
+	const T_DIST* lpt_tile = _matrixt_tile.getRow(lui_i);
+	T_CLUSTERIDX  lcidx_j  = 0;
+	for (uintidx lui_j = 1; lui_j < lui_numClusterK; lui_j++) {
+	  if ( lpt_tile[lcidx_j] > lpt_tile[lui_j] )
+	    lcidx_j = T_CLUSTERIDX(lui_j);
+	}
+	aoarraycidx_nearest[lui_i] = lcidx_j;
+	aoarrayt_distMin[lui_i]    = lpt_tile[lcidx_j];
+      }
+    }
+    else {
+      INPUT_ITERATOR liiterator_block = aiiterator_instfirst;
+      lui_numInstBlock = this->_tileSquared(aiiterator_instfirst,aiiterator_instlast);
+      /*The error of the expansion is bounded, so the candidates are the
+	centroids whose interval intersects the interval of the minimum.
+	The distance function decides between them
+       */
+      const T_DIST lrt_eps =
+	T_DIST(2 * (lui_numDim + 4)) * _getEpsilon();
+      for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++, ++liiterator_block) {
+	const T_DIST* lpt_tile = _matrixt_tile.getRow(lui_i);
+	const T_DIST  lrt_normInst = _vectort_normBlock[lui_i];
+	T_DIST lrt_upperMin = std::numeric_limits<T_DIST>::max();
+	for (uintidx lui_j = 0; lui_j < lui_numClusterK; lui_j++) {
+	  T_DIST lrt_upper = lpt_tile[lui_j]
+	    + lrt_eps * (lrt_normInst + _vectort_normCentroids[lui_j]);
+	  if ( lrt_upper < lrt_upperMin )
+	    lrt_upperMin = lrt_upper;
+	}
+	const T_FEATURE* larrayt_inst =
+	  ((data::Instance<T_FEATURE>*) *liiterator_block)->getFeatures();
+	T_CLUSTERIDX lcidx_j   = NEARESTCENTROID_UNKNOWN;
+	T_DIST       lrt_distMin = std::numeric_limits<T_DIST>::max();
+	for (uintidx lui_j = 0; lui_j < lui_numClusterK; lui_j++) {
+	  if ( lpt_tile[lui_j]
+	       - lrt_eps * (lrt_normInst + _vectort_normCentroids[lui_j])
+	       <= lrt_upperMin ) {
+	    T_DIST lrt_dist =
+	      _func2p_dist(_matrixt_centroids.getRow(lui_j),larrayt_inst,lui_numDim);
+	    if ( lcidx_j == NEARESTCENTROID_UNKNOWN || lrt_distMin > lrt_dist ) {
+	      lcidx_j     = T_CLUSTERIDX(lui_j);
+	      lrt_distMin = lrt_dist;
+	    }
+	  }
+	}
+	aoarraycidx_nearest[lui_i] = lcidx_j;
+	aoarrayt_distMin[lui_i]    = lrt_distMin;
+      }
+    }
+
+    return lui_numInstBlock;
+  }
+
+protected:
+
+  enum { DISTBLOCK_GENERIC, DISTBLOCK_EUCLIDEAN, DISTBLOCK_EUCLIDEANSQ };
+
+  /*Features of lower precision than T_DIST (eg. float), the distance
+    function rounds to the precision of the features
+   */
+  static T_DIST _getEpsilon()
+  {
+    return
+      ( std::numeric_limits<T_FEATURE>::is_integer
+	|| T_DIST(std::numeric_limits<T_FEATURE>::epsilon())
+	< std::numeric_limits<T_DIST>::epsilon() )
+      ? std::numeric_limits<T_DIST>::epsilon()
+      : T_DIST(std::numeric_limits<T_FEATURE>::epsilon());
+  }
+
+  void _initNorms(const uintidx aiui_numInstBlock)
+  {
+    const uintidx lui_numClusterK = _matrixt_centroids.getNumRows();
+    const uintidx lui_numDim      = _matrixt_centroids.getNumColumns();
+
+    _matrixt_centroidsDist =
+      mat::MatrixRow<T_DIST>(lui_numClusterK,lui_numDim);
+    _matrixt_block =
+      mat::MatrixRow<T_DIST>(aiui_numInstBlock,lui_numDim);
+    _vectort_normCentroids.resize(lui_numClusterK);
+    _vectort_normBlock.resize(aiui_numInstBlock);
+    for (uintidx lui_j = 0; lui_j < lui_numClusterK; lui_j++) {
+      const T_FEATURE* lpt_centroid = _matrixt_centroids.getRow(lui_j);
+      T_DIST*          lpt_row      = _matrixt_centroidsDist.getRow(lui_j);
+      T_DIST lrt_norm = T_DIST(0);
+      for (uintidx lui_l = 0; lui_l < lui_numDim; lui_l++) {
+	lpt_row[lui_l] = T_DIST(lpt_centroid[lui_l]);
+	lrt_norm += lpt_row[lui_l] * lpt_row[lui_l];
+      }
+      _vectort_normCentroids[lui_j] = lrt_norm;
+    }
+  }
+
+  /*Squared euclidean distances of the next block, without correction of negative values*/
+  template < typename INPUT_ITERATOR >
+  uintidx
+  _tileSquared
+  (INPUT_ITERATOR        &aiiterator_instfirst,
+   const INPUT_ITERATOR  aiiterator_instlast
+   )
+  {
+    const uintidx lui_numDim = _matrixt_centroids.getNumColumns();
+    uintidx       lui_numInstBlock;
+
+    for ( lui_numInstBlock = 0;
+	  lui_numInstBlock < this->getNumInstBlock()
+	    && aiiterator_instfirst != aiiterator_instlast;
+	  ++lui_numInstBlock, ++aiiterator_instfirst )
+      {
+	const T_FEATURE* larrayt_inst =
+	  ((data::Instance<T_FEATURE>*) *aiiterator_instfirst)->getFeatures();
+	T_DIST* lpt_row  = _matrixt_block.getRow(lui_numInstBlock);
+	T_DIST  lrt_norm = T_DIST(0);
+	for (uintidx lui_l = 0; lui_l < lui_numDim; lui_l++) {
+	  lpt_row[lui_l] = T_DIST(larrayt_inst[lui_l]);
+	  lrt_norm += lpt_row[lui_l] * lpt_row[lui_l];
+	}
+	_vectort_normBlock[lui_numInstBlock] = lrt_norm;
+      }
+
+    gemmTile(_matrixt_tile,_matrixt_block,_matrixt_centroidsDist,lui_numInstBlock);
+    dist::Counter::countEvaluations
+      ((uint64_t) lui_numInstBlock * _matrixt_tile.getNumColumns());
+
+    for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++) {
+      T_DIST* lpt_tile = _matrixt_tile.getRow(lui_i);
+      const T_DIST lrt_normInst = _vectort_normBlock[lui_i];
+      for (uintidx lui_j = 0; lui_j < _matrixt_tile.getNumColumns(); lui_j++)
+	lpt_tile[lui_j] =
+	  lrt_normInst + _vectort_normCentroids[lui_j] - T_DIST(2) * lpt_tile[lui_j];
+    }
+
+    return lui_numInstBlock;
+  }
+
+  const mat::MatrixRow<T_FEATURE>    &_matrixt_centroids;
+  const dist::Dist<T_DIST,T_FEATURE> &_func2p_dist;
+  int                                _i_typeDist;
+  mat::MatrixRow<T_DIST>             _matrixt_tile;
+  mat::MatrixRow<T_DIST>             _matrixt_centroidsDist;
+  mat::MatrixRow<T_DIST>             _matrixt_block;
+  std::vector<T_DIST>                _vectort_normCentroids;
+  std::vector<T_DIST>                _vectort_normBlock;
+
+}; /*END class DistBlock*/
+
+
+#ifndef NEARESTBLOCK_MIN_PARALLEL
+#define NEARESTBLOCK_MIN_PARALLEL 4096
+#endif /*NEARESTBLOCK_MIN_PARALLEL*/
+
+/*! \fn void NNBlocks(T_CLUSTERIDX *aoarraycidx_nearest, T_DIST *aoarrayt_distMin, const mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, const RANDOMACCESS_ITERATOR aiiterator_instfirst, const RANDOMACCESS_ITERATOR aiiterator_instlast, const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist)
+    \brief Nearest centroid of each instance, the blocks of instances are distributed among the threads
+    \details Each thread has its own DistBlock, the result is the same as DistBlock::NN for each instance
+    \param aoarraycidx_nearest an array with the index of the nearest centroid of each instance
+    \param aoarrayt_distMin an array with the distance to the nearest centroid of each instance
+    \param aimatrixt_centroids a mat::MatrixRow with the centroids
+    \param aiiterator_instfirst a RandomAccessIterator to the initial positions of the sequence of instances
+    \param aiiterator_instlast a RandomAccessIterator to the final positions of the sequence of instances
+    \param aifunc2p_dist an object of type dist::Dist to calculate distances
+ */
+template < typename T_CLUSTERIDX,
+	   typename T_FEATURE,
+	   typename T_DIST,
+	   typename RANDOMACCESS_ITERATOR
+	   >
+void
+NNBlocks
+(T_CLUSTERIDX                       *aoarraycidx_nearest,
+ T_DIST                             *aoarrayt_distMin,
+ const mat::MatrixRow<T_FEATURE>    &aimatrixt_centroids,
+ const RANDOMACCESS_ITERATOR        aiiterator_instfirst,
+ const RANDOMACCESS_ITERATOR        aiiterator_instlast,
+ const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist
+ )
+{
+  const long ll_numInstances =
+    long(std::distance(aiiterator_instfirst,aiiterator_instlast));
+  const long ll_numInstBlock = NEARESTBLOCK_NUMINSTANCES;
+  const long ll_numBlocks    =
+    (ll_numInstances + ll_numInstBlock - 1) / ll_numInstBlock;
+
+#pragma omp parallel if ( ll_numInstances >= NEARESTBLOCK_MIN_PARALLEL )
+  {
+    DistBlock<T_FEATURE,T_DIST>
+      ldistblock_centInst(aimatrixt_centroids,aifunc2p_dist,uintidx(ll_numInstBlock));
+
+#pragma omp for schedule(static)
+    for (long ll_b = 0; ll_b < ll_numBlocks; ll_b++) {
+      RANDOMACCESS_ITERATOR literator_block = aiiterator_instfirst + ll_b * ll_numInstBlock;
+      const RANDOMACCESS_ITERATOR literator_blockLast =
+	aiiterator_instfirst + std::min((ll_b + 1) * ll_numInstBlock,ll_numInstances);
+      ldistblock_centInst.NN
+	(aoarraycidx_nearest + ll_b * ll_numInstBlock,
+	 aoarrayt_distMin + ll_b * ll_numInstBlock,
+	 literator_block,
+	 literator_blockLast
+	 );
+    }
+  }
+}
+
+} /*END namespace nearest*/
+
+#endif /*__NEAREST_CENTROIDS_BLOCK_HPP*/
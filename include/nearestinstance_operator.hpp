@@ -13,6 +13,9 @@
 #ifndef __NEAREST_INSTANCES_OPERATOR_HPP
 #define __NEAREST_INSTANCES_OPERATOR_HPP
 
+#include <vector>
+#include <limits>
+#include <algorithm>
 #include "instance.hpp"
 #include "matrix.hpp"
 #include "matrix_triangular.hpp"
@@ -385,6 +388,285 @@ medoidsNN
 }
 
 
+/*! \class MedoidsTwoNN
+  \brief The nearest and the second nearest medoid of each instance, with their distances
+  \details Kept for a set of medoids, so the sum of the distances of the instances to their nearest medoid, um::SSEMedoid, is known after replacing one medoid in \f$O(n)\f$ instead of \f$O(nK)\f$. Only the instances whose nearest or second nearest medoid is replaced look again at the \f$K\f$ medoids. The medoids are compared by distance and then by position, so the nearest medoid is the one of nearest::medoidsNN and the sums are added in the order of the instances, as um::SSEMedoid
+
+  \code{.cpp}
+  nearest::MedoidsTwoNN<DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+    lmedoidstwonn_chrom(lmatrixtriagt_dissimilarity);
+
+  lmedoidstwonn_chrom.initialize(lchrom->getString(),lcidx_numClusterK);
+  DATATYPE_REAL lrt_SSEChange = lmedoidstwonn_chrom.getSSEChangeMedoid(0,lui_newMedoid);
+  lmedoidstwonn_chrom.changeMedoid(0,lui_newMedoid);
+  \endcode
+*/
+template <typename T_CLUSTERIDX, 
+	  typename T_DIST
+	  >
+class MedoidsTwoNN {
+public:
+  MedoidsTwoNN(const mat::MatrixTriang<T_DIST> &aimatrixtriagt_dissimilarity)
+    : _pmatrixtriagt_dissimilarity(&aimatrixtriagt_dissimilarity)
+    , _vectorcidx_nearest1(aimatrixtriagt_dissimilarity.getNumRows())
+    , _vectorcidx_nearest2(aimatrixtriagt_dissimilarity.getNumRows())
+    , _vectort_dist1(aimatrixtriagt_dissimilarity.getNumRows())
+    , _vectort_dist2(aimatrixtriagt_dissimilarity.getNumRows())
+  {}
+
+  inline const std::vector<uintidx>& getMedoids() const
+  {
+    return this->_vectorui_medoids;
+  }
+
+  inline T_CLUSTERIDX getNearest(const uintidx aiui_idxInstance) const
+  {
+    return this->_vectorcidx_nearest1[aiui_idxInstance];
+  }
+
+  inline T_DIST getDistNearest(const uintidx aiui_idxInstance) const
+  {
+    return this->_vectort_dist1[aiui_idxInstance];
+  }
+
+  /*! \fn void initialize(const uintidx *aiarrayuidx_medoids, const T_CLUSTERIDX aicidx_numMedoisK)
+    \brief Find the two nearest medoids of all the instances, \f$O(nK)\f$
+  */
+  void initialize
+  (const uintidx      *aiarrayuidx_medoids,
+   const T_CLUSTERIDX aicidx_numMedoisK
+   )
+  {
+    this->_vectorui_medoids.assign
+      (aiarrayuidx_medoids, aiarrayuidx_medoids + aicidx_numMedoisK);
+    const uintidx lui_numInstances = (uintidx) this->_vectort_dist1.size();
+    std::fill
+      (this->_vectorcidx_nearest1.begin(),this->_vectorcidx_nearest1.end(),
+       NEARESTCENTROID_UNKNOWN);
+    std::fill
+      (this->_vectorcidx_nearest2.begin(),this->_vectorcidx_nearest2.end(),
+       NEARESTCENTROID_UNKNOWN);
+    std::fill
+      (this->_vectort_dist1.begin(),this->_vectort_dist1.end(),
+       std::numeric_limits<T_DIST>::max());
+    std::fill
+      (this->_vectort_dist2.begin(),this->_vectort_dist2.end(),
+       std::numeric_limits<T_DIST>::max());
+
+    /*BY MEDOID, SO THE DISTANCES ARE READ BY ROWS OF THE MATRIX
+     */
+    for ( T_CLUSTERIDX lcidx_j = 0; lcidx_j < aicidx_numMedoisK; lcidx_j++) {
+      const uintidx lui_medoid = aiarrayuidx_medoids[lcidx_j];
+      for ( uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++) {
+	const T_DIST lt_dist =
+	  (*this->_pmatrixtriagt_dissimilarity)(lui_medoid,lui_i);
+	if ( this->_vectorcidx_nearest1[lui_i] == NEARESTCENTROID_UNKNOWN
+	     || lt_dist < this->_vectort_dist1[lui_i] ) {
+	  this->_vectorcidx_nearest2[lui_i] = this->_vectorcidx_nearest1[lui_i];
+	  this->_vectort_dist2[lui_i]       = this->_vectort_dist1[lui_i];
+	  this->_vectorcidx_nearest1[lui_i] = lcidx_j;
+	  this->_vectort_dist1[lui_i]       = lt_dist;
+	}
+	else if ( this->_vectorcidx_nearest2[lui_i] == NEARESTCENTROID_UNKNOWN
+		  || lt_dist < this->_vectort_dist2[lui_i] ) {
+	  this->_vectorcidx_nearest2[lui_i] = lcidx_j;
+	  this->_vectort_dist2[lui_i]       = lt_dist;
+	}
+      }
+    }
+  }
+
+  /*! \fn T_DIST getSSE() const
+    \brief Sum of the distances of the instances to their nearest medoid, as um::SSEMedoid
+  */
+  T_DIST getSSE() const
+  {
+    T_DIST lort_SSE = T_DIST(0);
+    for ( uintidx lui_i = 0; lui_i < this->_vectort_dist1.size(); lui_i++)
+      lort_SSE += this->_vectort_dist1[lui_i];
+    return lort_SSE;
+  }
+
+  /*! \fn T_DIST getSSEChangeMedoid(const T_CLUSTERIDX aicidx_medoid, const uintidx aiuidx_newMedoid) const
+    \brief The um::SSEMedoid that would have the medoids if the medoid in position aicidx_medoid is replaced by the instance aiuidx_newMedoid, in \f$O(n)\f$ without changing them
+  */
+  T_DIST getSSEChangeMedoid
+  (const T_CLUSTERIDX aicidx_medoid,
+   const uintidx      aiuidx_newMedoid
+   ) const
+  {
+    T_DIST lort_SSE = T_DIST(0);
+    for ( uintidx lui_i = 0; lui_i < this->_vectort_dist1.size(); lui_i++) {
+      const T_DIST lt_distNew = (*this->_pmatrixtriagt_dissimilarity)(aiuidx_newMedoid,lui_i);
+      lort_SSE +=
+	( this->_vectorcidx_nearest1[lui_i] == aicidx_medoid )?
+	std::min(lt_distNew,this->_vectort_dist2[lui_i])
+	:std::min(lt_distNew,this->_vectort_dist1[lui_i]);
+    }
+    return lort_SSE;
+  }
+
+  /*! \fn void changeMedoid(const T_CLUSTERIDX aicidx_medoid, const uintidx aiuidx_newMedoid)
+    \brief Replace the medoid in position aicidx_medoid by the instance aiuidx_newMedoid
+  */
+  void changeMedoid
+  (const T_CLUSTERIDX aicidx_medoid,
+   const uintidx      aiuidx_newMedoid
+   )
+  {
+    this->_vectorui_medoids[aicidx_medoid] = aiuidx_newMedoid;
+    for ( uintidx lui_i = 0; lui_i < this->_vectort_dist1.size(); lui_i++) {
+      const T_DIST lt_distNew = (*this->_pmatrixtriagt_dissimilarity)(aiuidx_newMedoid,lui_i);
+      if ( this->_vectorcidx_nearest1[lui_i] == aicidx_medoid ) {
+	if ( isLess
+	     (lt_distNew,aicidx_medoid,
+	      this->_vectort_dist2[lui_i],this->_vectorcidx_nearest2[lui_i]) )
+	  this->_vectort_dist1[lui_i] = lt_distNew;
+	else {
+	  this->_vectorcidx_nearest1[lui_i] = this->_vectorcidx_nearest2[lui_i];
+	  this->_vectort_dist1[lui_i] = this->_vectort_dist2[lui_i];
+	  this->searchNearest2(lui_i);
+	}
+      }
+      else if ( this->_vectorcidx_nearest2[lui_i] == aicidx_medoid ) {
+	if ( isLess
+	     (lt_distNew,aicidx_medoid,
+	      this->_vectort_dist1[lui_i],this->_vectorcidx_nearest1[lui_i]) ) {
+	  this->_vectorcidx_nearest2[lui_i] = this->_vectorcidx_nearest1[lui_i];
+	  this->_vectort_dist2[lui_i] = this->_vectort_dist1[lui_i];
+	  this->_vectorcidx_nearest1[lui_i] = aicidx_medoid;
+	  this->_vectort_dist1[lui_i] = lt_distNew;
+	}
+	else
+	  this->searchNearest2(lui_i);
+      }
+      else if ( isLess
+		(lt_distNew,aicidx_medoid,
+		 this->_vectort_dist1[lui_i],this->_vectorcidx_nearest1[lui_i]) ) {
+	this->_vectorcidx_nearest2[lui_i] = this->_vectorcidx_nearest1[lui_i];
+	this->_vectort_dist2[lui_i] = this->_vectort_dist1[lui_i];
+	this->_vectorcidx_nearest1[lui_i] = aicidx_medoid;
+	this->_vectort_dist1[lui_i] = lt_distNew;
+      }
+      else if ( isLess
+		(lt_distNew,aicidx_medoid,
+		 this->_vectort_dist2[lui_i],this->_vectorcidx_nearest2[lui_i]) ) {
+	this->_vectorcidx_nearest2[lui_i] = aicidx_medoid;
+	this->_vectort_dist2[lui_i] = lt_distNew;
+      }
+    }
+  }
+
+  /*! \fn uintidx getNumChanges(const uintidx *aiarrayuidx_medoids, const T_CLUSTERIDX aicidx_numMedoisK) const
+    \brief Number of medoids that are not in the set aiarrayuidx_medoids, more than aicidx_numMedoisK if the sets can not be matched
+  */
+  uintidx getNumChanges
+  (const uintidx      *aiarrayuidx_medoids,
+   const T_CLUSTERIDX aicidx_numMedoisK
+   ) const
+  {
+    if ( (T_CLUSTERIDX) this->_vectorui_medoids.size() != aicidx_numMedoisK )
+      return (uintidx) aicidx_numMedoisK + 1;
+    uintidx lui_numOut = 0;
+    uintidx lui_numIn  = 0;
+    const uintidx *larrayuidx_medoidsEnd = aiarrayuidx_medoids + aicidx_numMedoisK;
+    for ( T_CLUSTERIDX lcidx_j = 0; lcidx_j < aicidx_numMedoisK; lcidx_j++) {
+      if ( std::find
+	   (aiarrayuidx_medoids,larrayuidx_medoidsEnd,this->_vectorui_medoids[lcidx_j])
+	   == larrayuidx_medoidsEnd )
+	++lui_numOut;
+      if ( std::find
+	   (this->_vectorui_medoids.begin(),this->_vectorui_medoids.end(),aiarrayuidx_medoids[lcidx_j])
+	   == this->_vectorui_medoids.end() )
+	++lui_numIn;
+    }
+    return ( lui_numOut == lui_numIn )?lui_numOut:(uintidx) aicidx_numMedoisK + 1;
+  }
+
+  /*! \fn T_DIST setMedoids(const MedoidsTwoNN &aimedoidstwonn_parent, const uintidx *aiarrayuidx_medoids, const T_CLUSTERIDX aicidx_numMedoisK)
+    \brief Take the set of medoids aiarrayuidx_medoids and return its um::SSEMedoid
+    \details When at most a third of the medoids of aimedoidstwonn_parent are not in the new set, it is copied and they are replaced one by one, since each replacement reads about \f$3n\f$ distances. Otherwise the nearest medoids are found again. The positions of the medoids can differ from aiarrayuidx_medoids, see getMedoids()
+  */
+  T_DIST setMedoids
+  (const MedoidsTwoNN &aimedoidstwonn_parent,
+   const uintidx      *aiarrayuidx_medoids,
+   const T_CLUSTERIDX aicidx_numMedoisK
+   )
+  {
+    const uintidx lui_numChanges =
+      aimedoidstwonn_parent.getNumChanges(aiarrayuidx_medoids,aicidx_numMedoisK);
+    if ( 3 * lui_numChanges > (uintidx) aicidx_numMedoisK ) {
+      this->initialize(aiarrayuidx_medoids,aicidx_numMedoisK);
+      return this->getSSE();
+    }
+    if ( this != &aimedoidstwonn_parent )
+      *this = aimedoidstwonn_parent;
+    if ( lui_numChanges > 0 ) {
+      std::vector<uintidx> lvectorui_in;
+      for ( T_CLUSTERIDX lcidx_j = 0; lcidx_j < aicidx_numMedoisK; lcidx_j++) {
+	if ( std::find
+	     (this->_vectorui_medoids.begin(),this->_vectorui_medoids.end(),aiarrayuidx_medoids[lcidx_j])
+	     == this->_vectorui_medoids.end() )
+	  lvectorui_in.push_back(aiarrayuidx_medoids[lcidx_j]);
+      }
+      const uintidx *larrayuidx_medoidsEnd = aiarrayuidx_medoids + aicidx_numMedoisK;
+      uintidx lui_in = 0;
+      for ( T_CLUSTERIDX lcidx_j = 0; lcidx_j < aicidx_numMedoisK; lcidx_j++) {
+	if ( std::find
+	     (aiarrayuidx_medoids,larrayuidx_medoidsEnd,this->_vectorui_medoids[lcidx_j])
+	     == larrayuidx_medoidsEnd )
+	  this->changeMedoid(lcidx_j,lvectorui_in[lui_in++]);
+      }
+    }
+    return this->getSSE();
+  }
+  
+protected:
+
+  static inline bool isLess
+  (const T_DIST       ait_dist1,
+   const T_CLUSTERIDX aicidx_medoid1,
+   const T_DIST       ait_dist2,
+   const T_CLUSTERIDX aicidx_medoid2
+   )
+  {
+    return ( ait_dist1 < ait_dist2 )
+      || ( ait_dist1 == ait_dist2 && aicidx_medoid1 < aicidx_medoid2 );
+  }
+
+  /*SECOND NEAREST MEDOID, OTHER THAN THE NEAREST
+   */
+  void searchNearest2(const uintidx aiui_idxInstance)
+  {
+    T_CLUSTERIDX lcidx_nearest2 = NEARESTCENTROID_UNKNOWN;
+    T_DIST       lt_dist2 = std::numeric_limits<T_DIST>::max();
+    for ( T_CLUSTERIDX lcidx_j = 0;
+	  lcidx_j < (T_CLUSTERIDX) this->_vectorui_medoids.size();
+	  lcidx_j++) {
+      if ( lcidx_j != this->_vectorcidx_nearest1[aiui_idxInstance] ) {
+	const T_DIST lt_dist =
+	  (*this->_pmatrixtriagt_dissimilarity)
+	  (this->_vectorui_medoids[lcidx_j],aiui_idxInstance);
+	if ( lcidx_nearest2 == NEARESTCENTROID_UNKNOWN || lt_dist < lt_dist2 ) {
+	  lcidx_nearest2 = lcidx_j;
+	  lt_dist2 = lt_dist;
+	}
+      }
+    }
+    this->_vectorcidx_nearest2[aiui_idxInstance] = lcidx_nearest2;
+    this->_vectort_dist2[aiui_idxInstance] = lt_dist2;
+  }
+
+  const mat::MatrixTriang<T_DIST> *_pmatrixtriagt_dissimilarity;
+  std::vector<uintidx>             _vectorui_medoids;
+  std::vector<T_CLUSTERIDX>        _vectorcidx_nearest1;
+  std::vector<T_CLUSTERIDX>        _vectorcidx_nearest2;
+  std::vector<T_DIST>              _vectort_dist1;
+  std::vector<T_DIST>              _vectort_dist2;
+  
+}; /*MedoidsTwoNN*/
+
+
 /*! \fn T_CLUSTERIDX NN(T_DIST &aort_distMinCentInst, const mat::MatrixBase<T_FEATURE> &aimatrixrowt_centroids, T_CLUSTERIDX aimcIdx_currentCentroidK, const T_FEATURE *aiat_instance, const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist) 
     \brief NN Find the centroid closest to an instance starting from a defined centroid
     \details 
@@ -19,6 +19,7 @@
 #include "partition.hpp"
 #include "matrix.hpp"
 #include "nearestinstance_operator.hpp"
+#include "nearestcentroids_block.hpp"
 
 #include "verbose_global.hpp"
 
@@ -228,10 +229,30 @@ public:
 #endif
     
     os << aic_delimCoef << "length" << aic_delimCoef << getNumInstances() << '>';
-    this->begin();
-    os << this->next();
-    while ( this->end() ) { 
-      os << aic_delimCoef <<  this->next();
+
+    /*BY BLOCKS OF INSTANCES, THE LABELS ARE WRITTEN AS THEY ARE OBTAINED
+     */
+    nearest::DistBlock<T_FEATURE,T_DIST>
+      ldistblock_centInst(*_ptmatrixt_centroids,*_ptfunc2p_dist);
+    std::vector<T_CLUSTERIDX> lvectorcidx_nearest(ldistblock_centInst.getNumInstBlock());
+    std::vector<T_DIST>       lvectorT_distMin(ldistblock_centInst.getNumInstBlock());
+    INPUT_ITERATOR            literator_inst = _iterator_instfirst;
+    char                      lc_delim = '\0';
+    
+    while ( literator_inst != _iterator_instlast ) {
+      uintidx lui_numInstBlock =
+	ldistblock_centInst.NN
+	(lvectorcidx_nearest.data(),
+	 lvectorT_distMin.data(),
+	 literator_inst,
+	 _iterator_instlast
+	 );
+      for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++) {
+	if ( lc_delim != '\0' )
+	  os << lc_delim;
+	os << lvectorcidx_nearest[lui_i];
+	lc_delim = aic_delimCoef;
+      }
     }
 
     os << std::endl;
@@ -12,6 +12,7 @@
 #ifndef MEMBERSHIP_PARTITION_BITCRISPMATRIX_HPP
 #define MEMBERSHIP_PARTITION_BITCRISPMATRIX_HPP
 
+#include <vector>
 #include "partition.hpp"
 #include "crisp_matrix.hpp"
 #include "common.hpp"
@@ -30,6 +31,7 @@ namespace partition {
 
 /*! \class PartitionCrispMatrix
   \brief Partition of instances with bit crisp matrix
+  \details With the member cache the cluster of each instance is read from the matrix once, when the partition is built, and getClusterIdx is O(1). The partition then does not see later changes of the matrix
 */
 template< class T_BITSIZE,
           class T_CLUSTERIDX
@@ -40,11 +42,18 @@ class PartitionCrispMatrix:
 public:
 
   PartitionCrispMatrix
-  (const mat::CrispMatrix<T_BITSIZE,T_CLUSTERIDX> &aibitcrisp_matrix)
+  (const mat::CrispMatrix<T_BITSIZE,T_CLUSTERIDX> &aibitcrisp_matrix,
+   const bool aib_withMemberCache = true
+   )
     : Partition<T_CLUSTERIDX>() 
     , _ptcrisp_matrix(&aibitcrisp_matrix)
     , _ui_iteratornext(0)
-  { }
+    , _vectorcidx_member()
+    , _b_withMemberCache(aib_withMemberCache)
+  {
+    if ( this->_b_withMemberCache )
+      this->_ptcrisp_matrix->getMembers(this->_vectorcidx_member);
+  }
   
  
   ~PartitionCrispMatrix()
@@ -57,7 +66,7 @@ public:
 
   inline const T_CLUSTERIDX next()
   {
-    return this->_ptcrisp_matrix->getMember(_ui_iteratornext++);	
+    return this->getClusterIdx(_ui_iteratornext++);	
   }
 
   inline bool end() const
@@ -68,7 +77,9 @@ public:
   virtual const T_CLUSTERIDX 
   getClusterIdx(uintidx aiuintidx_instanceIdx) const
   {
-    return this->_ptcrisp_matrix->getMember(aiuintidx_instanceIdx);	
+    return ( this->_b_withMemberCache )?
+      this->_vectorcidx_member[aiuintidx_instanceIdx]
+      :this->_ptcrisp_matrix->getMember(aiuintidx_instanceIdx);	
   }
 
   inline const uintidx getNumInstances() const
@@ -110,6 +121,8 @@ protected:
 
   const mat::CrispMatrix<T_BITSIZE,T_CLUSTERIDX> *_ptcrisp_matrix;
   uintidx _ui_iteratornext;
+  std::vector<T_CLUSTERIDX> _vectorcidx_member;
+  bool _b_withMemberCache;
 
 }; /*PartitionCrispMatrix*/
 
@@ -428,7 +428,7 @@ public:
        aiarrayt_feature,
        data::Instance<T_FEATURE>::getNumDimensions()
        ); 
-    ++_vectorit_n.at(aicidx_toClusterIdx);
+    _vectorit_n.at(aicidx_toClusterIdx) += T_INSTANCES_CLUSTER_K(aiit_instfrequency);
    
 #ifdef __VERBOSE_YES
     if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -482,7 +482,7 @@ public:
        aiarrayt_feature,
        data::Instance<T_FEATURE>::getNumDimensions()
        ); 
-    --_vectorit_n.at(lT_clusterIdx);
+    _vectorit_n.at(lT_clusterIdx) -= T_INSTANCES_CLUSTER_K(aiit_instfrequency);
     } //IF 
 #ifdef __VERBOSE_YES
     if ( geiinparam_verbose <= geiinparam_verboseMax ) {
@@ -514,7 +514,7 @@ public:
        data::Instance<T_FEATURE>::getNumDimensions()
        );
     
-    --_vectorit_n.at(aicidx_clusterKFrom);
+    _vectorit_n.at(aicidx_clusterKFrom) -= T_INSTANCES_CLUSTER_K(aiit_instfrequency);
 
     larrayrowt_sumInstancesClusterK  = 
       this->_matrixresizerow_m.getRow( (uintidx) aicidx_clusterKTo );
@@ -526,7 +526,7 @@ public:
        data::Instance<T_FEATURE>::getNumDimensions()
        );
     
-    ++_vectorit_n.at(aicidx_clusterKTo);
+    _vectorit_n.at(aicidx_clusterKTo) += T_INSTANCES_CLUSTER_K(aiit_instfrequency);
   }
       
   void changeMemberShip 
@@ -0,0 +1,124 @@
+/*! \file population_arena.hpp
+ *
+ * \brief population of fixed length chromosomes stored in a contiguous arena
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef POPULATION_ARENA_HPP
+#define POPULATION_ARENA_HPP
+
+#include <vector>
+#include <stdint.h>
+#include "chromosome_fixedlength.hpp"
+
+/*POPULATIONARENA_ALIGN: bytes to which each string of the arena is aligned
+ */
+#ifndef POPULATIONARENA_ALIGN
+#define POPULATIONARENA_ALIGN 64
+#endif
+
+/*! \namespace gaencode
+  \brief Encode chromosome
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace gaencode {
+
+/*! \class PopulationArena
+  \brief Two populations of gaencode::ChromFixedLength whose strings are the rows of one aligned \f$2P \times L\f$ matrix
+  \details The population and the offspring are double buffered: the children are written directly in getOffspring() and swap() exchanges the buffers, so a generation does not allocate or copy the strings to a mating pool. The strings are allocated with the length of ChromFixedLength::stcgetStringSize() when the arena is built
+*/
+template <class T_GENE,
+	  class T_METRIC
+	  >
+class PopulationArena {
+public:
+  PopulationArena(const uintidx aiui_sizePopulation)
+    : _ui_sizePopulation(aiui_sizePopulation)
+    , _ui_stride
+      (((ChromFixedLength<T_GENE,T_METRIC>::stcgetStringSize() * sizeof(T_GENE)
+	 + POPULATIONARENA_ALIGN - 1) / POPULATIONARENA_ALIGN)
+       * POPULATIONARENA_ALIGN / sizeof(T_GENE))
+    , _arrayt_memory
+      (new T_GENE[2 * aiui_sizePopulation * _ui_stride
+		  + POPULATIONARENA_ALIGN / sizeof(T_GENE) + 1])
+  {
+    /*POPULATIONARENA_ALIGN MUST BE A MULTIPLE OF sizeof(T_GENE)*/
+    uintptr_t lui_offset = (uintptr_t) this->_arrayt_memory % POPULATIONARENA_ALIGN;
+    T_GENE *larrayt_strings = this->_arrayt_memory
+      + ((lui_offset == 0)?0:(POPULATIONARENA_ALIGN - lui_offset) / sizeof(T_GENE));
+
+    for ( uintidx lui_b = 0; lui_b < 2; lui_b++) {
+      this->_vectorchrom_buffer[lui_b].reserve(aiui_sizePopulation);
+      for ( uintidx lui_i = 0; lui_i < aiui_sizePopulation; lui_i++) {
+	this->_vectorchrom_buffer[lui_b].push_back
+	  (ChromFixedLength<T_GENE,T_METRIC>
+	   (larrayt_strings + (lui_b * aiui_sizePopulation + lui_i) * _ui_stride)
+	   );
+      }
+    }
+  }
+
+  PopulationArena(const PopulationArena<T_GENE,T_METRIC> &aiarena_b) = delete;
+
+  PopulationArena<T_GENE,T_METRIC>&
+  operator=(const PopulationArena<T_GENE,T_METRIC> &aiarena_b) = delete;
+
+  ~PopulationArena()
+  {
+    this->_vectorchrom_buffer[0].clear();
+    this->_vectorchrom_buffer[1].clear();
+    delete [] this->_arrayt_memory;
+  }
+
+  /*! \fn std::vector<ChromFixedLength<T_GENE,T_METRIC> >& getPopulation()
+    \brief The chromosomes of the current generation
+    \details The reference remains valid after swap(), it then has the chromosomes of the other buffer
+  */
+  inline std::vector<ChromFixedLength<T_GENE,T_METRIC> >& getPopulation()
+  {
+    return this->_vectorchrom_buffer[0];
+  }
+
+  /*! \fn std::vector<ChromFixedLength<T_GENE,T_METRIC> >& getOffspring()
+    \brief The chromosomes where the next generation is written
+  */
+  inline std::vector<ChromFixedLength<T_GENE,T_METRIC> >& getOffspring()
+  {
+    return this->_vectorchrom_buffer[1];
+  }
+
+  /*! \fn void swap()
+    \brief The offspring becomes the population, no string is copied
+  */
+  inline void swap()
+  {
+    this->_vectorchrom_buffer[0].swap(this->_vectorchrom_buffer[1]);
+  }
+
+  inline const uintidx getSizePopulation() const
+  {
+    return this->_ui_sizePopulation;
+  }
+
+protected:
+
+  uintidx  _ui_sizePopulation;
+  uintidx  _ui_stride;
+  T_GENE   *_arrayt_memory;
+  std::vector<ChromFixedLength<T_GENE,T_METRIC> > _vectorchrom_buffer[2];
+
+}; /*PopulationArena*/
+
+} /*END namespace gaencode*/
+
+#endif  /*POPULATION_ARENA_HPP*/
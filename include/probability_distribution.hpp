@@ -19,6 +19,8 @@
 #include <iterator>     // std::distance
 #include <type_traits>
 #include <typeinfo>
+#include <cmath>
+#include <random>
 
 #include "random_ext.hpp"
 #include "probability_selection.hpp"
@@ -29,7 +31,7 @@
 
 #include "verbose_global.hpp"
 
-extern  StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace prob
   \brief Method for calculate probability distributions
@@ -553,6 +555,60 @@ adaptiveProb
   return lort_pc;
 }
 
+
+/*! \fn void forEachBernoulliSuccess(const uintidx aiui_numTrials, const T_REAL airt_prob, FUNCTION_SUCCESS aifunc_success)
+  \brief Call aifunc_success with the position of each success of aiui_numTrials independent trials with probability airt_prob
+  \details The positions have the same distribution as testing a uniform random number for each trial, but only the gaps between successes are drawn, from a geometric distribution, so the cost is proportional to the expected number of successes \f$n p\f$ and not to \f$n\f$
+  \param aiui_numTrials number of trials, eg. the length of a chromosome
+  \param airt_prob probability of success of each trial
+  \param aifunc_success function called with the position of each success in increasing order
+
+  \code{.cpp}
+  prob::forEachBernoulliSuccess
+    (aiobitarray_chrom.size(),
+     airt_probMutation,
+     [&](const uintidx aiui_j)
+     {
+       aiobitarray_chrom.toggleBit(aiui_j);
+     }
+     );
+  \endcode
+*/
+template < typename T_REAL,
+	   typename FUNCTION_SUCCESS
+	   >
+void
+forEachBernoulliSuccess
+(const uintidx    aiui_numTrials,
+ const T_REAL     airt_prob,
+ FUNCTION_SUCCESS aifunc_success
+ )
+{
+  if ( !(airt_prob > T_REAL(0)) )
+    return;
+
+  if ( airt_prob >= T_REAL(1) ) {
+    for (uintidx lui_i = 0; lui_i < aiui_numTrials; lui_i++)
+      aifunc_success(lui_i);
+    return;
+  }
+
+  /*NUMBER OF FAILURES BEFORE A SUCCESS: floor(log(U)/log(1-p)), U IN (0,1]
+   */
+  static std::uniform_real_distribution<double> lsuniformdis_real01(0.0,1.0);
+  const double ld_log1mProb = std::log1p(-double(airt_prob));
+  
+  uintidx lui_i = 0;
+  while ( true ) {
+    const double ld_numFailures =
+      std::floor(std::log(1.0 - lsuniformdis_real01(gmt19937_eng)) / ld_log1mProb);
+    if ( ld_numFailures >= double(aiui_numTrials - lui_i) )
+      break;
+    lui_i += uintidx(ld_numFailures);
+    aifunc_success(lui_i);
+    ++lui_i;
+  }
+}
   
 }/*END namespace*/
 
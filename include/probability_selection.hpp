@@ -22,7 +22,7 @@
 #include "verbose_global.hpp"
 #include "insertion_operator.hpp"
 
-extern StdMT19937 gmt19937_eng;
+extern thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace prob
   \brief functions for get randon number 
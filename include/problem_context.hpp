@@ -0,0 +1,150 @@
+/*! \file problem_context.hpp
+ *
+ * \brief Shape of the clustering problem being solved
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+#ifndef __PROBLEM_CONTEXT_HPP
+#define __PROBLEM_CONTEXT_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include "common.hpp"
+
+/*! \namespace data
+  \brief Module for the handling of instances or also called objects or points.
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace data {
+
+/*! \class ProblemContext
+  \brief Number of dimensions of the instances and values computed once from the data set
+  \details A thread works on the context installed with ProblemContext::Scope, or on a default context shared by the process, so a program that solves one problem does not need to install any. Two problems of different shape can be solved at the same time, each on a thread with its own context. The threads started by an algorithm install the context of the thread that starts them, see gaisland::runIslands
+*/
+class ProblemContext {
+public:
+  ProblemContext()
+    : _ui_numDimensions(0)
+    , _b_homogeneousCoord(false)
+  {}
+
+  ProblemContext(const ProblemContext&) = delete;
+  ProblemContext& operator=(const ProblemContext&) = delete;
+
+  inline void setNumDimensions(uintidx aiui_numDimensions)
+  {
+    this->_ui_numDimensions = aiui_numDimensions;
+  }
+
+  inline uintidx getNumDimensions() const
+  {
+    return this->_ui_numDimensions;
+  }
+
+  inline void setHomogeneousCoord(bool aib_homogeneousCoord)
+  {
+    this->_b_homogeneousCoord = aib_homogeneousCoord;
+  }
+
+  inline bool getHomogeneousCoord() const
+  {
+    return this->_b_homogeneousCoord;
+  }
+
+  /*! \fn T_VALUE& getCached(const void *aipv_key, FUNCTION_COMPUTE aifunc_compute)
+    \brief The value stored with the key, computed by aifunc_compute the first time it is requested in the context, eg. the centroid of the data set
+    \param aipv_key address of a static variable of the function that uses the value
+    \param aifunc_compute function without parameters that returns the value
+  */
+  template < typename T_VALUE,
+	     typename FUNCTION_COMPUTE
+	     >
+  T_VALUE& getCached(const void *aipv_key, FUNCTION_COMPUTE aifunc_compute)
+  {
+    std::lock_guard<std::mutex> llock_cache(this->_mutex_cache);
+    auto lit_cache = this->_map_cache.find(aipv_key);
+    if ( lit_cache == this->_map_cache.end() )
+      lit_cache = this->_map_cache.emplace
+	(aipv_key,std::shared_ptr<void>(new T_VALUE(aifunc_compute()))).first;
+    return *static_cast<T_VALUE*>(lit_cache->second.get());
+  }
+
+  /*! \fn static ProblemContext& current()
+    \brief The context of the calling thread
+  */
+  static inline ProblemContext& current();
+
+  /*! \fn static void install(ProblemContext *aipcontext_problem)
+    \brief Install the context on the calling thread for the rest of its work, NULL returns it to the default context
+  */
+  static inline void install(ProblemContext *aipcontext_problem);
+
+  /*! \class Scope
+    \brief Install a context on the calling thread until the end of the scope
+  */
+  class Scope {
+  public:
+    explicit Scope(ProblemContext &aiocontext_problem);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  protected:
+    ProblemContext *_pcontext_previous;
+  };
+
+protected:
+
+  uintidx                                      _ui_numDimensions;
+  bool                                         _b_homogeneousCoord;
+  std::mutex                                   _mutex_cache;
+  std::map<const void*,std::shared_ptr<void> > _map_cache;
+
+}; /*ProblemContext*/
+
+
+/*! The context used by the threads that have not installed one
+ */
+ProblemContext gproblemcontext_default;
+
+/*! The context installed on the thread, NULL is gproblemcontext_default
+ */
+thread_local ProblemContext *gtlpproblemcontext_current = NULL;
+
+inline ProblemContext& ProblemContext::current()
+{
+  return (gtlpproblemcontext_current != NULL)?*gtlpproblemcontext_current
+    :gproblemcontext_default;
+}
+
+inline void ProblemContext::install(ProblemContext *aipcontext_problem)
+{
+  gtlpproblemcontext_current = aipcontext_problem;
+}
+
+inline ProblemContext::Scope::Scope(ProblemContext &aiocontext_problem)
+  : _pcontext_previous(gtlpproblemcontext_current)
+{
+  gtlpproblemcontext_current = &aiocontext_problem;
+}
+
+inline ProblemContext::Scope::~Scope()
+{
+  gtlpproblemcontext_current = this->_pcontext_previous;
+}
+
+} /*END namespace data
+   */
+
+#endif /*__PROBLEM_CONTEXT_HPP*/
@@ -36,7 +36,7 @@ std::random_device grd_randomdevice;
 
 #endif
 
-/*! A global variable of type mersenne_twister_engine is a random number engine based on Mersenne Twister algorithm. It produces high quality unsigned integer random numbers of type UIntType on the interval \f$[0, 2w-1]\f$.*/
+/*! A global variable of type mersenne_twister_engine is a random number engine based on Mersenne Twister algorithm. It produces high quality unsigned integer random numbers of type UIntType on the interval \f$[0, 2w-1]\f$. Each thread has its own engine, the islands of gaisland::runIslands seed theirs from the engine of the main thread.*/
 //std::mersenne_twister_engine gmt19937_eng;
 
 #if defined(__LP64__) || defined(_WIN64) || (defined(__x86_64__) && !defined(__ILP32__) ) || defined(_M_X64) || defined(__ia64) || defined (_M_IA64) || defined(__aarch64__) || defined(__powerpc64__)
@@ -46,7 +46,7 @@ typedef std::mt19937_64 StdMT19937;
 typedef std::mt19937 StdMT19937;
 #endif
 
-StdMT19937 gmt19937_eng;
+thread_local StdMT19937 gmt19937_eng;
 
 /*! \namespace randomext
   \brief Functions to generate random numbers
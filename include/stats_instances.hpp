@@ -809,7 +809,7 @@ matrixVarcovar
      mat::CblasNoTrans,
      mat::CblasTrans,
      lirt_alpha,
-     0.0
+     decltype((*aiiterator_instfirst)->getAttribute(0))(0.0)
      );
  
 #ifdef __VERBOSE_YES
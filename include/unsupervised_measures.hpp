@@ -29,6 +29,7 @@
 #include "container_out.hpp"
 #include "leac_utils.hpp"
 #include "stats_instances.hpp"
+#include "nearestcentroids_block.hpp"
 
 #include "verbose_global.hpp"
 
@@ -1591,10 +1592,16 @@ VRC
   const uintidx  lui_numInstances =
     uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
 
-  static T_FEATURE *larray_centroid1 =
-    new T_FEATURE[data::Instance<T_FEATURE>::getNumDimensions()];
+  /*THE CENTROID OF THE DATA SET IS COMPUTED ONCE BY PROBLEM
+   */
+  static const char lc_keyCentroid1 = 0;
+  T_FEATURE *larray_centroid1 =
+    data::ProblemContext::current().getCached<std::vector<T_FEATURE> >
+    (&lc_keyCentroid1,
+     [&]() {
+      std::vector<T_FEATURE> lovector_centroid1
+	(data::Instance<T_FEATURE>::getNumDimensions());
 
-  static utils::RunOnce runOnce ([&]() {
       decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
 	*larray_sumFeatureTmp =
 	new decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
@@ -1608,14 +1615,16 @@ VRC
 	 );
   
       stats::meanVector
-	(larray_centroid1,
+	(lovector_centroid1.data(),
 	 lui_numInstances,
 	 larray_sumFeatureTmp
 	 );
 
       delete [] larray_sumFeatureTmp;
+
+      return lovector_centroid1;
     }
-    );
+    ).data();
 
 #ifdef __VERBOSE_YES
   const char* lpc_labelFunc = "um::VRC";
@@ -1904,10 +1913,16 @@ WBIndex
 {
   const uintidx  lui_numInstances = uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
   
-  static T_FEATURE *larray_centroid1 =
-    new T_FEATURE[data::Instance<T_FEATURE>::getNumDimensions()];
+  /*THE CENTROID OF THE DATA SET IS COMPUTED ONCE BY PROBLEM
+   */
+  static const char lc_keyCentroid1 = 0;
+  T_FEATURE *larray_centroid1 =
+    data::ProblemContext::current().getCached<std::vector<T_FEATURE> >
+    (&lc_keyCentroid1,
+     [&]() {
+      std::vector<T_FEATURE> lovector_centroid1
+	(data::Instance<T_FEATURE>::getNumDimensions());
 
-  static utils::RunOnce runOnce ([&]() {
       decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
 	*larray_sumFeatureTmp =
 	new decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
@@ -1921,14 +1936,16 @@ WBIndex
 	 );
   
       stats::meanVector
-	(larray_centroid1,
+	(lovector_centroid1.data(),
 	 lui_numInstances,
 	 larray_sumFeatureTmp
 	 );
 
       delete [] larray_sumFeatureTmp;
+
+      return lovector_centroid1;
     }
-    );
+    ).data();
   
 #ifdef __VERBOSE_YES
   const char* lpc_labelFunc = "um::WBIndex";
@@ -2153,10 +2170,16 @@ scoreFunction
 {
   const uintidx  lui_numInstances = uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
   
-  static T_FEATURE *larray_centroid1 =
-    new T_FEATURE[data::Instance<T_FEATURE>::getNumDimensions()];
+  /*THE CENTROID OF THE DATA SET IS COMPUTED ONCE BY PROBLEM
+   */
+  static const char lc_keyCentroid1 = 0;
+  T_FEATURE *larray_centroid1 =
+    data::ProblemContext::current().getCached<std::vector<T_FEATURE> >
+    (&lc_keyCentroid1,
+     [&]() {
+      std::vector<T_FEATURE> lovector_centroid1
+	(data::Instance<T_FEATURE>::getNumDimensions());
 
-  static utils::RunOnce runOnce ([&]() {
       decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
 	*larray_sumFeatureTmp =
 	new decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
@@ -2170,14 +2193,16 @@ scoreFunction
 	 );
   
       stats::meanVector
-	(larray_centroid1,
+	(lovector_centroid1.data(),
 	 lui_numInstances,
 	 larray_sumFeatureTmp
 	 );
 
       delete [] larray_sumFeatureTmp;
+
+      return lovector_centroid1;
     }
-    );
+    ).data();
   
 #ifdef __VERBOSE_YES
   const char* lpc_labelFunc = "um::scoreFunction";
@@ -2620,32 +2645,15 @@ diameterClusterK
 
 
 
-/*! \fn T_METRIC overlap (const mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, partition::Partition<T_CLUSTERIDX> &aipartition_clusters, const dist::Dist<T_METRIC,T_FEATURE>  &aifunc2p_dist)
-
-  \brief Overlap
-  \details To measure the overlap, we calculated the distance from every point to its centroid (d1) and to its nearest point in another cluster (d2). If this nearest point is closer than its own centroid (d1 > d2), the point is evidence of overlap \cite Franti:Sieranoja:ClusterMeasure:Benchmark:2018. 
-
-  \f[
-  Overlap = \frac{1}{n}\sum ov(d_1,d_2)
-  \f]
-
-  where
-  \f[
-  ov(d_1,d_2) = 
-  \left\{
-        \begin{array}{ll}
-               1,  & \mbox{if } d_1 > d_2  \\
-               0,  & \mbox{otherwise}
-        \end{array}
-  \right
-  \f]
-
+/*! \fn T_METRIC overlap (const mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const ds::PartitionLinked<T_CLUSTERIDX> &aipartlink_memberShip, const std::vector<T_METRIC> &aivectort_radiusClusterK, const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist)
+  \brief Overlap with the radius of the clusters computed previously, eg. um::ReportCentroids::getRadiusClusterK
   \param aimatrixt_centroids a mat::MatrixRow with centroids clusters
   \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
   \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
   \param aipartlink_memberShip a clusters partition in a ds::PartitionLinked data structure
+  \param aivectort_radiusClusterK the maximum distance of the instances of each cluster to its centroid
   \param aifunc2p_dist an object of type dist::Dist to calculate distances
-*/ 
+*/
 template < typename INPUT_ITERATOR,
 	   typename T_METRIC, 
 	   typename T_FEATURE,
@@ -2657,6 +2665,7 @@ overlap
  const INPUT_ITERATOR                    aiiterator_instfirst,
  const INPUT_ITERATOR                    aiiterator_instlast,
  const ds::PartitionLinked<T_CLUSTERIDX> &aipartlink_memberShip,
+ const std::vector<T_METRIC>             &aivectort_radiusClusterK,
  const dist::Dist<T_METRIC,T_FEATURE>    &aifunc2p_dist
  )
 {  
@@ -2664,21 +2673,6 @@ overlap
   T_CLUSTERIDX lcidx_numClusterK = 
     (T_CLUSTERIDX) aimatrixt_centroids.getNumRows();
 
-  /*CALCULATE RADIUS CLUSTERS
-   */
-  std::vector<T_METRIC>
-    lvector_radiusClusterK(aimatrixt_centroids.getNumRows());
-  for ( T_CLUSTERIDX lcidx_Ck = 0; lcidx_Ck < lcidx_numClusterK; lcidx_Ck++) {
-    lvector_radiusClusterK.at(lcidx_Ck) = 
-      radiusClusterKj
-      (lcidx_Ck,
-       aimatrixt_centroids.getRow(lcidx_Ck),
-       aipartlink_memberShip,
-       aiiterator_instfirst,
-       aifunc2p_dist
-       );
-  }
-
 #ifdef __VERBOSE_YES
   ++geiinparam_verbose;
   const  char* lpc_labelFunc = "um::overlap";
@@ -2693,7 +2687,7 @@ overlap
       << "\n\t input ds::PartitionLinked<T_CLUSTERIDX>&: aipartlink_memberShip[" 
       << &aipartlink_memberShip << ']'
       << "\n\t input  aifunc2p_dist[" << &aifunc2p_dist << ']'
-      << "\n\t lvector_radiusClusterK[" << lvector_radiusClusterK << ']'
+      << "\n\t aivectort_radiusClusterK[" << aivectort_radiusClusterK << ']'
       << "\n\t)"
       << std::endl;
   }
@@ -2731,7 +2725,7 @@ overlap
 	       aimatrixt_centroids.getRow(lcidx_Ckp),
 	       data::Instance<T_FEATURE>::getNumDimensions()
 	       );
-	    if  ( std::abs(lt_distCOtherK - lvector_radiusClusterK.at(lcidx_Ckp)) <= lt_distCinK ) {
+	    if  ( std::abs(lt_distCOtherK - aivectort_radiusClusterK.at(lcidx_Ckp)) <= lt_distCinK ) {
 
 	      ds::IteratorPartitionLinked <T_CLUSTERIDX>
 		literpart_jp(&aipartlink_memberShip);
@@ -2786,6 +2780,77 @@ overlap
 } /*END overlap*/
 
 
+/*! \fn T_METRIC overlap (const mat::MatrixRow<T_FEATURE> &aimatrixt_centroids, INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, partition::Partition<T_CLUSTERIDX> &aipartition_clusters, const dist::Dist<T_METRIC,T_FEATURE>  &aifunc2p_dist)
+
+  \brief Overlap
+  \details To measure the overlap, we calculated the distance from every point to its centroid (d1) and to its nearest point in another cluster (d2). If this nearest point is closer than its own centroid (d1 > d2), the point is evidence of overlap \cite Franti:Sieranoja:ClusterMeasure:Benchmark:2018. 
+
+  \f[
+  Overlap = \frac{1}{n}\sum ov(d_1,d_2)
+  \f]
+
+  where
+  \f[
+  ov(d_1,d_2) = 
+  \left\{
+        \begin{array}{ll}
+               1,  & \mbox{if } d_1 > d_2  \\
+               0,  & \mbox{otherwise}
+        \end{array}
+  \right
+  \f]
+
+  \param aimatrixt_centroids a mat::MatrixRow with centroids clusters
+  \param aiiterator_instfirst an InputIterator to the initial positions of the sequence of instances
+  \param aiiterator_instlast an InputIterator to the final positions of the sequence of instances
+  \param aipartlink_memberShip a clusters partition in a ds::PartitionLinked data structure
+  \param aifunc2p_dist an object of type dist::Dist to calculate distances
+*/ 
+template < typename INPUT_ITERATOR,
+	   typename T_METRIC, 
+	   typename T_FEATURE,
+	   typename T_CLUSTERIDX /*-1,0,..,K*/
+	   >
+T_METRIC
+overlap
+(const mat::MatrixRow<T_FEATURE>         &aimatrixt_centroids,
+ const INPUT_ITERATOR                    aiiterator_instfirst,
+ const INPUT_ITERATOR                    aiiterator_instlast,
+ const ds::PartitionLinked<T_CLUSTERIDX> &aipartlink_memberShip,
+ const dist::Dist<T_METRIC,T_FEATURE>    &aifunc2p_dist
+ )
+{  
+
+  T_CLUSTERIDX lcidx_numClusterK = 
+    (T_CLUSTERIDX) aimatrixt_centroids.getNumRows();
+
+  /*CALCULATE RADIUS CLUSTERS
+   */
+  std::vector<T_METRIC>
+    lvector_radiusClusterK(aimatrixt_centroids.getNumRows());
+  for ( T_CLUSTERIDX lcidx_Ck = 0; lcidx_Ck < lcidx_numClusterK; lcidx_Ck++) {
+    lvector_radiusClusterK.at(lcidx_Ck) = 
+      radiusClusterKj
+      (lcidx_Ck,
+       aimatrixt_centroids.getRow(lcidx_Ck),
+       aipartlink_memberShip,
+       aiiterator_instfirst,
+       aifunc2p_dist
+       );
+  }
+
+  return overlap
+    (aimatrixt_centroids,
+     aiiterator_instfirst,
+     aiiterator_instlast,
+     aipartlink_memberShip,
+     lvector_radiusClusterK,
+     aifunc2p_dist
+     );
+
+} /*END overlap*/
+
+
 
 /*! \fn T_METRIC DunnIndex(mat::MatrixTriang<T_METRIC> &aimatrixtriagt_dissimilarity, ds::PartitionLinked<T_CLUSTERIDX> &aipartlink_memberShip, const bool aib_withNullK = false) 
   \brief  The Dunn Index (DI) \cite Dunn:ClusterMeasure:CS:1974 \cite Zhang:Cao:KernelclusteringLabelKVar:2011 
@@ -4166,7 +4231,6 @@ SSE
  )
 {  
   T_METRIC              loT_SSE;
-  T_METRIC              lT_distMinCentInst;
 
   loT_SSE = T_METRIC(0);
   std::vector<uintidx> 
@@ -4186,25 +4250,24 @@ SSE
   }
 #endif //__VERBOSE_YES
   
-  for (; aiiterator_instfirst != aiiterator_instlast; ++aiiterator_instfirst) {
+  nearest::DistBlock<T_FEATURE,T_METRIC>
+    ldistblock_centInst(aimatrixt_centroids,aifunc2p_dist);
+  std::vector<intidx>   lvectorcidx_instInClusterJ(ldistblock_centInst.getNumInstBlock());
+  std::vector<T_METRIC> lvectorT_distMinCentInst(ldistblock_centInst.getNumInstBlock());
+  
+  while ( aiiterator_instfirst != aiiterator_instlast ) {
 
-    data::Instance<T_FEATURE>* linst_inter =
-      (data::Instance<T_FEATURE>*) *aiiterator_instfirst;
-    
-    intidx lcidx_instInClusterJ = 
-      nearest::NN
-      <intidx,
-       T_FEATURE,
-       T_METRIC
-       >
-      (lT_distMinCentInst,
-       aimatrixt_centroids,
-       linst_inter->getFeatures(),
-       aifunc2p_dist
+    uintidx lui_numInstBlock =
+      ldistblock_centInst.NN
+      (lvectorcidx_instInClusterJ.data(),
+       lvectorT_distMinCentInst.data(),
+       aiiterator_instfirst,
+       aiiterator_instlast
        );
-    loT_SSE += (T_METRIC) lT_distMinCentInst;
-    lvectorT_numInstancesClusterK[lcidx_instInClusterJ]++;
-       
+    for (uintidx lui_i = 0; lui_i < lui_numInstBlock; lui_i++) {
+      loT_SSE += lvectorT_distMinCentInst[lui_i];
+      lvectorT_numInstancesClusterK[lvectorcidx_instInClusterJ[lui_i]]++;
+    }
 
   }
   
@@ -4868,10 +4931,13 @@ indexI
  const T_METRIC                   airt_p = 2.0
  )
 {
-static T_METRIC lmetric_e1;
- 
-  static utils::RunOnce runOnce ([&]() {
-
+  /*E1 OF THE DATA SET IS COMPUTED ONCE BY PROBLEM
+   */
+  static const char lc_keyE1 = 0;
+  const T_METRIC lmetric_e1 =
+    data::ProblemContext::current().getCached<T_METRIC>
+    (&lc_keyE1,
+     [&]() {
       const uintidx  lui_numInstances = 
 	uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
       
@@ -4896,7 +4962,7 @@ static T_METRIC lmetric_e1;
 	 larray_sumFeatureTmp
 	 );
 
-      lmetric_e1 =
+      const T_METRIC lometric_e1 =
 	e1
 	(larray_centroid1,
 	 aiiterator_instfirst,
@@ -4906,6 +4972,8 @@ static T_METRIC lmetric_e1;
 
       delete [] larray_sumFeatureTmp;
       delete [] larray_centroid1;
+
+      return lometric_e1;
     }
     );
   
@@ -5037,10 +5105,13 @@ indexI
  )
 {
 
-  static T_METRIC lmetric_e1;
- 
-  static utils::RunOnce runOnce ([&]() {
-
+  /*E1 OF THE DATA SET IS COMPUTED ONCE BY PROBLEM
+   */
+  static const char lc_keyE1 = 0;
+  const T_METRIC lmetric_e1 =
+    data::ProblemContext::current().getCached<T_METRIC>
+    (&lc_keyE1,
+     [&]() {
       const uintidx  lui_numInstances = uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
       
       T_FEATURE *larray_centroid1 =
@@ -5064,7 +5135,7 @@ indexI
 	 larray_sumFeatureTmp
 	 );
 
-      lmetric_e1 =
+      const T_METRIC lometric_e1 =
 	e1
 	(larray_centroid1,
 	 aiiterator_instfirst,
@@ -5074,6 +5145,8 @@ indexI
 
       delete [] larray_sumFeatureTmp;
       delete [] larray_centroid1;
+
+      return lometric_e1;
     }
     );
   
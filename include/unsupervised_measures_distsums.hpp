@@ -0,0 +1,296 @@
+/*! \file unsupervised_measures_distsums.hpp
+ *
+ * \brief Silhouette from the sums of the distances of each instance to each cluster, kept while the instances change of cluster
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __UNSUPERVISED_MEASURES_DISTSUMS_HPP
+#define __UNSUPERVISED_MEASURES_DISTSUMS_HPP
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "matrix_triangular.hpp"
+#include "unsupervised_measures.hpp"
+
+#include "verbose_global.hpp"
+
+/*UMDISTSUMS_MIN_PARALLEL: tables with fewer instances are built and
+  updated by one thread
+ */
+#ifndef UMDISTSUMS_MIN_PARALLEL
+#define UMDISTSUMS_MIN_PARALLEL 4096
+#endif
+
+/*! \namespace um
+  \brief  Unsupervised measures for clustering analysis
+  \details Evaluate tries to determine the quality of a given obtained partition of the data without any external information available.
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace um {
+
+/*! \class SilhouetteDistSums
+  \brief Sum of the distances of each instance to the members of each cluster, from a mat::MatrixTriang of dissimilarities
+  \details The table of \f$n \times K\f$ sums is built in one pass over the matrix, the rows of the instances are computed in parallel. When an instance leaves or joins a cluster only the sums of that cluster change, in \f$O(n)\f$, so the silhouette of an instance in every cluster and the silhouette of the partition are computed in \f$O(K)\f$ per instance, instead of \f$O(n)\f$ distances as in um::silhouette. The sums are kept by cluster, so the update of a cluster is contiguous in memory.
+
+  \code{.cpp}
+  um::SilhouetteDistSums<T_REAL,T_CLUSTERIDX,T_INSTANCES_CLUSTER_K>
+    lsilhouettedistsums_memberShip
+    (lmatrixtriagT_dissimilarity,
+     liter_iChrom->getString(),
+     liter_iChrom->getNumClusterK()
+     );
+
+  lsilhouettedistsums_memberShip.subInstanceFromCluster(lcidx_k,lui_i);
+  T_CLUSTERIDX lcidx_max =
+    lsilhouettedistsums_memberShip.getClusterMaxSilhouette(lui_i);
+  lsilhouettedistsums_memberShip.addInstanceToCluster(lcidx_max,lui_i);
+  lsilhouettedistsums_memberShip.silhouette();
+  \endcode
+*/
+template < typename T_METRIC,
+	   typename T_CLUSTERIDX,
+	   typename T_INSTANCES_CLUSTER_K
+	   >
+class SilhouetteDistSums {
+public:
+  SilhouetteDistSums
+  (const mat::MatrixTriang<T_METRIC> &aimatrixtriagt_dissimilarity,
+   const T_CLUSTERIDX                *aiarraycidx_memberShip,
+   const T_CLUSTERIDX                aicidx_numClusterK
+   )
+    : _matrixtriagt_dissimilarity(aimatrixtriagt_dissimilarity)
+    , _ui_numInstances(aimatrixtriagt_dissimilarity.getNumRows())
+    , _cidx_numClusterK(aicidx_numClusterK)
+    , _vectorcidx_memberShip
+      (aiarraycidx_memberShip,
+       aiarraycidx_memberShip + aimatrixtriagt_dissimilarity.getNumRows())
+    , _vectorit_numInstClusterK((uintidx) aicidx_numClusterK,T_INSTANCES_CLUSTER_K(0))
+    , _vectort_sumDist
+      ((uintidx) aicidx_numClusterK * aimatrixtriagt_dissimilarity.getNumRows(),
+       T_METRIC(0))
+  {
+    for ( uintidx lui_j = 0; lui_j < this->_ui_numInstances; lui_j++) {
+      const T_CLUSTERIDX lcidx_xinK = this->_vectorcidx_memberShip[lui_j];
+      if ( 0 <= lcidx_xinK && lcidx_xinK < this->_cidx_numClusterK )
+	++this->_vectorit_numInstClusterK[lcidx_xinK];
+    }
+
+    /*EACH THREAD SUMS THE ROWS OF ITS INSTANCES IN THE ORDER OF THE
+      INSTANCES, SO THE TABLE DOES NOT DEPEND ON THE NUMBER OF THREADS
+     */
+    const long ll_numInstances = (long) this->_ui_numInstances;
+#pragma omp parallel for schedule(dynamic,64) if(this->_ui_numInstances >= UMDISTSUMS_MIN_PARALLEL)
+    for ( long ll_i = 0; ll_i < ll_numInstances; ll_i++) {
+      const uintidx lui_i = (uintidx) ll_i;
+      for ( uintidx lui_j = 0; lui_j < this->_ui_numInstances; lui_j++) {
+	const T_CLUSTERIDX lcidx_xinK = this->_vectorcidx_memberShip[lui_j];
+	if ( 0 <= lcidx_xinK && lcidx_xinK < this->_cidx_numClusterK )
+	  this->_vectort_sumDist[this->getIdxSum(lcidx_xinK,lui_i)] +=
+	    this->_matrixtriagt_dissimilarity(lui_i,lui_j);
+      }
+    }
+  }
+
+  SilhouetteDistSums(const SilhouetteDistSums&) = delete;
+  SilhouetteDistSums& operator=(const SilhouetteDistSums&) = delete;
+
+  inline const std::vector<T_INSTANCES_CLUSTER_K>& getVectorNumInstClusterK() const
+  {
+    return this->_vectorit_numInstClusterK;
+  }
+
+  inline T_CLUSTERIDX getNumPartitions() const
+  {
+    return this->_cidx_numClusterK;
+  }
+
+  /*! \fn T_METRIC getSumDist(const T_CLUSTERIDX aicidx_clusterK, const uintidx aiui_idxInstance) const
+    \brief Sum of the distances of the instance to the members of the cluster
+  */
+  inline T_METRIC getSumDist
+  (const T_CLUSTERIDX aicidx_clusterK,
+   const uintidx      aiui_idxInstance
+   ) const
+  {
+    return this->_vectort_sumDist[this->getIdxSum(aicidx_clusterK,aiui_idxInstance)];
+  }
+
+  /*! \fn void subInstanceFromCluster(const T_CLUSTERIDX aicidx_clusterK, const uintidx aiui_idxInstance)
+    \brief The instance leaves the cluster, the sums of the cluster are updated in \f$O(n)\f$
+  */
+  void subInstanceFromCluster
+  (const T_CLUSTERIDX aicidx_clusterK,
+   const uintidx      aiui_idxInstance
+   )
+  {
+    this->updateSumDist(aicidx_clusterK,aiui_idxInstance,T_METRIC(-1));
+    --this->_vectorit_numInstClusterK[aicidx_clusterK];
+    this->_vectorcidx_memberShip[aiui_idxInstance] = -1;
+  }
+
+  /*! \fn void addInstanceToCluster(const T_CLUSTERIDX aicidx_clusterK, const uintidx aiui_idxInstance)
+    \brief The instance joins the cluster, the sums of the cluster are updated in \f$O(n)\f$
+  */
+  void addInstanceToCluster
+  (const T_CLUSTERIDX aicidx_clusterK,
+   const uintidx      aiui_idxInstance
+   )
+  {
+    this->updateSumDist(aicidx_clusterK,aiui_idxInstance,T_METRIC(1));
+    ++this->_vectorit_numInstClusterK[aicidx_clusterK];
+    this->_vectorcidx_memberShip[aiui_idxInstance] = aicidx_clusterK;
+  }
+
+  /*! \fn T_CLUSTERIDX getClusterMaxSilhouette(const uintidx aiui_idxInstance, T_METRIC &aort_silhouetteMax) const
+    \brief Cluster where the instance, taken out of its cluster, has the greatest silhouette as computed by the um::silhouette of an instance
+    \details The nearest and the second nearest cluster of the instance are found once, so all the clusters are tried in \f$O(K)\f$. The first cluster is kept on ties and -1 is returned if no silhouette is greater than measuare_lowerValueSilhouette
+    \param aiui_idxInstance index of an instance that does not belong to any cluster
+    \param aort_silhouetteMax the silhouette of the instance in the returned cluster
+  */
+  T_CLUSTERIDX getClusterMaxSilhouette
+  (const uintidx aiui_idxInstance,
+   T_METRIC      &aort_silhouetteMax
+   ) const
+  {
+    T_METRIC     lt_minDiC1     = std::numeric_limits<T_METRIC>::max();
+    T_METRIC     lt_minDiC2     = std::numeric_limits<T_METRIC>::max();
+    T_CLUSTERIDX lcidx_minDiC1  = -1;
+    for ( T_CLUSTERIDX lcidx_Ckp = 0; lcidx_Ckp < this->_cidx_numClusterK; lcidx_Ckp++) {
+      if ( this->_vectorit_numInstClusterK[lcidx_Ckp] > 0 ) {
+	T_METRIC lt_diC =
+	  this->getSumDist(lcidx_Ckp,aiui_idxInstance)
+	  / T_METRIC(this->_vectorit_numInstClusterK[lcidx_Ckp]);
+	if ( lt_diC < lt_minDiC1 ) {
+	  lt_minDiC2    = lt_minDiC1;
+	  lt_minDiC1    = lt_diC;
+	  lcidx_minDiC1 = lcidx_Ckp;
+	}
+	else if ( lt_diC < lt_minDiC2 )
+	  lt_minDiC2 = lt_diC;
+      }
+    }
+
+    T_CLUSTERIDX lcidx_max = -1;
+    aort_silhouetteMax = measuare_lowerValueSilhouette(T_METRIC);
+    for ( T_CLUSTERIDX lcidx_Ck = 0; lcidx_Ck < this->_cidx_numClusterK; lcidx_Ck++) {
+      T_METRIC lt_silhouette = measuare_undefSilhouette(T_METRIC);
+      if ( this->_vectorit_numInstClusterK[lcidx_Ck] > 1 ) {
+	T_METRIC lt_ai =
+	  this->getSumDist(lcidx_Ck,aiui_idxInstance)
+	  / T_METRIC(this->_vectorit_numInstClusterK[lcidx_Ck] + 1);
+	T_METRIC lt_bi = (lcidx_Ck == lcidx_minDiC1)?lt_minDiC2:lt_minDiC1;
+	T_METRIC lt_max =  std::max(lt_ai,lt_bi);
+	lt_silhouette = (lt_max == 0.0)?0.0:(lt_bi - lt_ai)/ lt_max;
+      }
+      if ( lt_silhouette > aort_silhouetteMax ) {
+	lcidx_max = lcidx_Ck;
+	aort_silhouetteMax = lt_silhouette;
+      }
+    }
+
+    return lcidx_max;
+  }
+
+  /*! \fn T_CLUSTERIDX getClusterMaxSilhouette(const uintidx aiui_idxInstance) const
+    \brief Cluster where the instance, taken out of its cluster, has the greatest silhouette
+  */
+  inline T_CLUSTERIDX getClusterMaxSilhouette(const uintidx aiui_idxInstance) const
+  {
+    T_METRIC lt_silhouetteMax;
+    return this->getClusterMaxSilhouette(aiui_idxInstance,lt_silhouetteMax);
+  }
+
+  /*! \fn T_METRIC silhouette() const
+    \brief Silhouette of the partition, as um::silhouette with a mat::MatrixTriang
+    \details \f$O(nK)\f$, the instances are added in the order of their indices
+  */
+  T_METRIC silhouette() const
+  {
+    const T_CLUSTERIDX lcidx_numNullCluster =
+      (T_CLUSTERIDX)
+      std::count
+      (this->_vectorit_numInstClusterK.begin(),
+       this->_vectorit_numInstClusterK.end(),
+       T_INSTANCES_CLUSTER_K(0)
+       );
+
+    if ( (this->_cidx_numClusterK - lcidx_numNullCluster) <= 1 )
+      return measuare_undefSilhouette(T_METRIC);
+
+    bool     lb_defined = false;
+    T_METRIC lrt_sumSilhouette = T_METRIC(0.0);
+    for ( uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) {
+      const T_CLUSTERIDX lcidx_Ck = this->_vectorcidx_memberShip[lui_i];
+      if ( lcidx_Ck < 0 || this->_vectorit_numInstClusterK[lcidx_Ck] <= 1 )
+	continue;
+      lb_defined = true;
+      T_METRIC lt_ai =
+	this->getSumDist(lcidx_Ck,lui_i)
+	/ T_METRIC(this->_vectorit_numInstClusterK[lcidx_Ck] - 1);
+      T_METRIC lt_bi = std::numeric_limits<T_METRIC>::max();
+      for ( T_CLUSTERIDX lcidx_Ckp = 0; lcidx_Ckp < this->_cidx_numClusterK; lcidx_Ckp++) {
+	if ( lcidx_Ck != lcidx_Ckp && this->_vectorit_numInstClusterK[lcidx_Ckp] > 0 ) {
+	  T_METRIC lt_diC =
+	    this->getSumDist(lcidx_Ckp,lui_i)
+	    / T_METRIC(this->_vectorit_numInstClusterK[lcidx_Ckp]);
+	  if ( lt_diC < lt_bi ) lt_bi = lt_diC;
+	}
+      }
+      T_METRIC lt_max =  std::max(lt_ai,lt_bi);
+      lrt_sumSilhouette += (lt_max == 0.0)?0.0:(lt_bi - lt_ai)/ lt_max;
+    }
+
+    return (lb_defined)
+      ?lrt_sumSilhouette / (T_METRIC) this->_ui_numInstances
+      :measuare_undefSilhouette(T_METRIC);
+  }
+
+protected:
+
+  inline uintidx getIdxSum
+  (const T_CLUSTERIDX aicidx_clusterK,
+   const uintidx      aiui_idxInstance
+   ) const
+  {
+    return (uintidx) aicidx_clusterK * this->_ui_numInstances + aiui_idxInstance;
+  }
+
+  void updateSumDist
+  (const T_CLUSTERIDX aicidx_clusterK,
+   const uintidx      aiui_idxInstance,
+   const T_METRIC     ait_sign
+   )
+  {
+    T_METRIC *lpt_sumDist =
+      &this->_vectort_sumDist[this->getIdxSum(aicidx_clusterK,0)];
+    const long ll_numInstances = (long) this->_ui_numInstances;
+#pragma omp parallel for schedule(static) if(this->_ui_numInstances >= UMDISTSUMS_MIN_PARALLEL)
+    for ( long ll_j = 0; ll_j < ll_numInstances; ll_j++) {
+      lpt_sumDist[ll_j] +=
+	ait_sign * this->_matrixtriagt_dissimilarity(aiui_idxInstance,(uintidx) ll_j);
+    }
+  }
+
+  const mat::MatrixTriang<T_METRIC> &_matrixtriagt_dissimilarity;
+  uintidx                            _ui_numInstances;
+  T_CLUSTERIDX                       _cidx_numClusterK;
+  std::vector<T_CLUSTERIDX>          _vectorcidx_memberShip;
+  std::vector<T_INSTANCES_CLUSTER_K> _vectorit_numInstClusterK;
+  std::vector<T_METRIC>              _vectort_sumDist;
+
+}; /*SilhouetteDistSums*/
+
+} /*END namespace um
+   */
+
+#endif /*__UNSUPERVISED_MEASURES_DISTSUMS_HPP*/
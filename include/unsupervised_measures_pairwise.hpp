@@ -0,0 +1,427 @@
+/*! \file unsupervised_measures_pairwise.hpp
+ *
+ * \brief Unsupervised measures that need the distances between all the instances, computed by tiles without a dissimilarity matrix
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __UNSUPERVISED_MEASURES_PAIRWISE_HPP
+#define __UNSUPERVISED_MEASURES_PAIRWISE_HPP
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include "matrix.hpp"
+#include "dist.hpp"
+#include "random_ext.hpp"
+#include "unsupervised_measures.hpp"
+
+#include "verbose_global.hpp"
+
+/*UMPAIRWISE_NUMINSTTILE: instances of a tile of columns, the features of
+  the tile are copied together so they stay in cache while all the rows
+  are compared with them
+ */
+#ifndef UMPAIRWISE_NUMINSTTILE
+#define UMPAIRWISE_NUMINSTTILE 1024
+#endif
+
+/*UMPAIRWISE_MIN_DIST_PARALLEL: tiles with fewer distances are computed by
+  one thread
+ */
+#ifndef UMPAIRWISE_MIN_DIST_PARALLEL
+#define UMPAIRWISE_MIN_DIST_PARALLEL 65536
+#endif
+
+/*UMPAIRWISE_ZCONFIDENCE: normal quantile of the confidence bounds of the
+  sampled silhouette, 95%
+ */
+#ifndef UMPAIRWISE_ZCONFIDENCE
+#define UMPAIRWISE_ZCONFIDENCE 1.959963984540054
+#endif
+
+extern thread_local StdMT19937  gmt19937_eng;
+
+/*! \namespace um
+  \brief  Unsupervised measures for clustering analysis
+  \details Evaluate tries to determine the quality of a given obtained partition of the data without any external information available.
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace um {
+
+/*! \class ReportPairwise
+  \brief Silhouette and Dunn's index of a partition given by the membership of the instances, without a mat::MatrixTriang of dissimilarities
+  \details The rows are all the instances, or a random sample of aiui_sizeSample instances, and their features are copied. The columns are read from the iterator once, in tiles of UMPAIRWISE_NUMINSTTILE instances, the rows of a tile are computed in parallel. For each row is kept the sum of the distances to each cluster, the maximum distance to its cluster and the minimum distance to the other clusters, so the memory is \f$O(n_{rows} (K + d))\f$. The sum of a row is in the order of the instances, so the result does not depend on the number of threads.
+
+  With all the instances silhouette() and DunnIndex() are um::silhouette and um::DunnIndex. With a sample, silhouette() is the mean of the silhouettes of the sampled instances, getSilhouetteLower() and getSilhouetteUpper() are its bounds at 95% of confidence, and DunnIndex() is an upper bound, since the distances between clusters are only those of the sampled instances
+
+  \code{.cpp}
+  um::ReportPairwise<DATATYPE_FEATURE,DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+    lreport_pairwise
+    (lpairvec_dataset.first.begin(),
+     lpairvec_dataset.first.end(),
+     lreport_centroids.getMemberShip(),
+     DATATYPE_CLUSTERIDX(lomatrixrowt_centroids.getNumRows()),
+     *pfunct2p_distEuclidean,
+     linparam_ClusteringGA.getSizeSamplePairwise()
+     );
+
+  lreport_pairwise.silhouette();
+  \endcode
+*/
+template < typename T_FEATURE,
+	   typename T_CLUSTERIDX,
+	   typename T_METRIC
+	   >
+class ReportPairwise {
+public:
+  template < typename INPUT_ITERATOR >
+  ReportPairwise
+  (INPUT_ITERATOR                       aiiterator_instfirst,
+   const INPUT_ITERATOR                 aiiterator_instlast,
+   const std::vector<T_CLUSTERIDX>      &aivectorcidx_memberShip,
+   const T_CLUSTERIDX                   aicidx_numClusterK,
+   const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist,
+   const uintidx                        aiui_sizeSample = 0
+   )
+    : _cidx_numClusterK(aicidx_numClusterK)
+    , _ui_numInstances(uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)))
+    , _b_sample(aiui_sizeSample > 0 && aiui_sizeSample < _ui_numInstances)
+    , _vectorui_numInstClusterK(aicidx_numClusterK,0)
+    , _vectorui_rows()
+    , _vectort_silhouette()
+    , _vectort_maxDistOwn()
+    , _vectort_minDistOther()
+    , _t_silhouette(measuare_undefSilhouette(T_METRIC))
+    , _t_silhouetteLower(measuare_undefSilhouette(T_METRIC))
+    , _t_silhouetteUpper(measuare_undefSilhouette(T_METRIC))
+  {
+#ifdef __VERBOSE_YES
+    const char* lpc_labelFunc = "um::ReportPairwise";
+    ++geiinparam_verbose;
+    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+      std::cout << lpc_labelFunc
+		<< ":  IN(" << geiinparam_verbose << ')'
+		<< "\n\t(input std::vector<T_CLUSTERIDX>& aivectorcidx_memberShip["
+		<< &aivectorcidx_memberShip << "]\n"
+		<< "\t input  aicidx_numClusterK = " << aicidx_numClusterK << '\n'
+		<< "\t input  dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist["
+		<< &aifunc2p_dist << "]\n"
+		<< "\t input  aiui_sizeSample = " << aiui_sizeSample
+		<< "\n\t)"
+		<< std::endl;
+    }
+#endif //__VERBOSE_YES
+
+    const uintidx lui_numDimensions = data::Instance<T_FEATURE>::getNumDimensions();
+
+    for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) {
+      const T_CLUSTERIDX lcidx_xinK = aivectorcidx_memberShip[lui_i];
+      if ( 0 <= lcidx_xinK  && lcidx_xinK < aicidx_numClusterK )
+	++this->_vectorui_numInstClusterK[lcidx_xinK];
+    }
+
+    /*ROWS: ALL THE INSTANCES OR A SAMPLE WITHOUT REPLACEMENT IN ORDER
+     */
+    this->_vectorui_rows.resize(this->_ui_numInstances);
+    for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++)
+      this->_vectorui_rows[lui_i] = lui_i;
+
+    if ( this->_b_sample ) {
+      for (uintidx lui_i = 0; lui_i < aiui_sizeSample; lui_i++) {
+	std::uniform_int_distribution<uintidx> uniformdis_uiIdx
+	  (lui_i,this->_ui_numInstances-1);
+	std::swap
+	  (this->_vectorui_rows[lui_i],
+	   this->_vectorui_rows[uniformdis_uiIdx(gmt19937_eng)]
+	   );
+      }
+      this->_vectorui_rows.resize(aiui_sizeSample);
+      std::sort(this->_vectorui_rows.begin(),this->_vectorui_rows.end());
+    }
+
+    const uintidx lui_numRows = (uintidx) this->_vectorui_rows.size();
+
+    mat::MatrixRow<T_FEATURE> lmatrixt_rows(lui_numRows,lui_numDimensions);
+    std::vector<T_CLUSTERIDX> lvectorcidx_rows(lui_numRows);
+    {
+      INPUT_ITERATOR literator_inst = aiiterator_instfirst;
+      uintidx        lui_idxInst = 0;
+      for (uintidx lui_r = 0; lui_r < lui_numRows; lui_r++) {
+	while ( lui_idxInst < this->_vectorui_rows[lui_r] ) {
+	  ++literator_inst;
+	  ++lui_idxInst;
+	}
+	std::copy
+	  (((data::Instance<T_FEATURE>*) *literator_inst)->getFeatures(),
+	   ((data::Instance<T_FEATURE>*) *literator_inst)->getFeatures() + lui_numDimensions,
+	   lmatrixt_rows.getRow(lui_r)
+	   );
+	lvectorcidx_rows[lui_r] = aivectorcidx_memberShip[lui_idxInst];
+      }
+    }
+
+    /*TILES OF COLUMNS: READ SEQUENTIALLY, THE ROWS IN PARALLEL
+     */
+    mat::MatrixRow<T_METRIC> lmatrixt_sumDistClusterK
+      (lui_numRows,(uintidx) aicidx_numClusterK,T_METRIC(0));
+    this->_vectort_maxDistOwn.assign(lui_numRows,T_METRIC(0));
+    this->_vectort_minDistOther.assign(lui_numRows,std::numeric_limits<T_METRIC>::max());
+
+    mat::MatrixRow<T_FEATURE> lmatrixt_tile(UMPAIRWISE_NUMINSTTILE,lui_numDimensions);
+    std::vector<T_CLUSTERIDX> lvectorcidx_tile(UMPAIRWISE_NUMINSTTILE);
+
+    uintidx lui_instTile = 0;
+    while ( aiiterator_instfirst != aiiterator_instlast ) {
+
+      uintidx lui_numInstTile = 0;
+      while ( aiiterator_instfirst != aiiterator_instlast
+	      && lui_numInstTile < UMPAIRWISE_NUMINSTTILE ) {
+	const T_FEATURE *lpt_features =
+	  ((data::Instance<T_FEATURE>*) *aiiterator_instfirst)->getFeatures();
+	std::copy
+	  (lpt_features,
+	   lpt_features + lui_numDimensions,
+	   lmatrixt_tile.getRow(lui_numInstTile)
+	   );
+	lvectorcidx_tile[lui_numInstTile] =
+	  aivectorcidx_memberShip[lui_instTile + lui_numInstTile];
+	++lui_numInstTile;
+	++aiiterator_instfirst;
+      }
+
+      const bool lb_parallel =
+	lui_numRows * lui_numInstTile >= UMPAIRWISE_MIN_DIST_PARALLEL;
+      const long ll_numRows = (long) lui_numRows;
+#pragma omp parallel for schedule(static) if(lb_parallel)
+      for ( long ll_r = 0; ll_r < ll_numRows; ll_r++) {
+	const uintidx      lui_r = (uintidx) ll_r;
+	const T_CLUSTERIDX lcidx_xinK = lvectorcidx_rows[lui_r];
+	if ( lcidx_xinK < 0 || lcidx_xinK >= aicidx_numClusterK )
+	  continue;
+	const T_FEATURE *lpt_row = lmatrixt_rows.getRow(lui_r);
+	T_METRIC *lpt_sumDist  = lmatrixt_sumDistClusterK.getRow(lui_r);
+	T_METRIC lt_maxDistOwn   = this->_vectort_maxDistOwn[lui_r];
+	T_METRIC lt_minDistOther = this->_vectort_minDistOther[lui_r];
+	for (uintidx lui_j = 0; lui_j < lui_numInstTile; lui_j++) {
+	  const T_CLUSTERIDX lcidx_xjinK = lvectorcidx_tile[lui_j];
+	  if ( lcidx_xjinK < 0 || lcidx_xjinK >= aicidx_numClusterK )
+	    continue;
+	  const T_METRIC lt_dist =
+	    aifunc2p_dist
+	    (lpt_row,
+	     lmatrixt_tile.getRow(lui_j),
+	     lui_numDimensions
+	     );
+	  lpt_sumDist[lcidx_xjinK] += lt_dist;
+	  if ( lcidx_xjinK == lcidx_xinK ) {
+	    if ( lt_maxDistOwn < lt_dist )
+	      lt_maxDistOwn = lt_dist;
+	  }
+	  else if ( lt_dist < lt_minDistOther )
+	    lt_minDistOther = lt_dist;
+	}
+	this->_vectort_maxDistOwn[lui_r]   = lt_maxDistOwn;
+	this->_vectort_minDistOther[lui_r] = lt_minDistOther;
+      }
+      lui_instTile += lui_numInstTile;
+    }
+
+    /*SILHOUETTE OF THE ROWS, AS um::silhouette
+     */
+    const T_CLUSTERIDX lcidx_numClusterKNull =
+      T_CLUSTERIDX
+      (std::count
+       (this->_vectorui_numInstClusterK.begin(),
+	this->_vectorui_numInstClusterK.end(),
+	uintidx(0)
+	));
+    const bool lb_haveClusterNotSingleton =
+      std::any_of
+      (this->_vectorui_numInstClusterK.begin(),
+       this->_vectorui_numInstClusterK.end(),
+       [](const uintidx aiui_numInst) {return aiui_numInst > 1;}
+       );
+
+    this->_vectort_silhouette.assign(lui_numRows,T_METRIC(0));
+    for (uintidx lui_r = 0; lui_r < lui_numRows; lui_r++) {
+      const T_CLUSTERIDX lcidx_xinK = lvectorcidx_rows[lui_r];
+      if ( lcidx_xinK < 0 || lcidx_xinK >= aicidx_numClusterK
+	   || this->_vectorui_numInstClusterK[lcidx_xinK] <= 1 )
+	continue;
+      const T_METRIC *lpt_sumDist = lmatrixt_sumDistClusterK.getRow(lui_r);
+      const T_METRIC lt_ai =
+	lpt_sumDist[lcidx_xinK] / T_METRIC(this->_vectorui_numInstClusterK[lcidx_xinK] - 1);
+      T_METRIC lt_bi = std::numeric_limits<T_METRIC>::max();
+      for (T_CLUSTERIDX lcidx_k = 0; lcidx_k < aicidx_numClusterK; lcidx_k++) {
+	if ( lcidx_k != lcidx_xinK && this->_vectorui_numInstClusterK[lcidx_k] > 0 ) {
+	  const T_METRIC lt_diC =
+	    lpt_sumDist[lcidx_k] / T_METRIC(this->_vectorui_numInstClusterK[lcidx_k]);
+	  if ( lt_diC < lt_bi ) lt_bi = lt_diC;
+	}
+      }
+      const T_METRIC lt_max = std::max(lt_ai,lt_bi);
+      this->_vectort_silhouette[lui_r] = (lt_max == 0.0)?0.0:(lt_bi - lt_ai)/ lt_max;
+    }
+
+    if ( (aicidx_numClusterK - lcidx_numClusterKNull) > 1 && lb_haveClusterNotSingleton
+	 && lui_numRows > 0 ) {
+      T_METRIC lt_sumSilhouette = T_METRIC(0);
+      for (uintidx lui_r = 0; lui_r < lui_numRows; lui_r++)
+	lt_sumSilhouette += this->_vectort_silhouette[lui_r];
+      this->_t_silhouette = lt_sumSilhouette / T_METRIC(lui_numRows);
+      this->_t_silhouetteLower = this->_t_silhouette;
+      this->_t_silhouetteUpper = this->_t_silhouette;
+
+      if ( this->_b_sample && lui_numRows > 1 ) {
+	/*STANDARD ERROR OF THE MEAN WITH THE FINITE POPULATION CORRECTION
+	 */
+	T_METRIC lt_sumSqDev = T_METRIC(0);
+	for (uintidx lui_r = 0; lui_r < lui_numRows; lui_r++) {
+	  const T_METRIC lt_dev = this->_vectort_silhouette[lui_r] - this->_t_silhouette;
+	  lt_sumSqDev += lt_dev * lt_dev;
+	}
+	const T_METRIC lt_stdError =
+	  std::sqrt
+	  (lt_sumSqDev / T_METRIC(lui_numRows - 1) / T_METRIC(lui_numRows)
+	   * T_METRIC(this->_ui_numInstances - lui_numRows)
+	   / T_METRIC(this->_ui_numInstances - 1)
+	   );
+	this->_t_silhouetteLower =
+	  std::max(T_METRIC(-1),this->_t_silhouette - T_METRIC(UMPAIRWISE_ZCONFIDENCE) * lt_stdError);
+	this->_t_silhouetteUpper =
+	  std::min(T_METRIC(1),this->_t_silhouette + T_METRIC(UMPAIRWISE_ZCONFIDENCE) * lt_stdError);
+      }
+    }
+
+    this->_vectorcidx_rows.swap(lvectorcidx_rows);
+
+#ifdef __VERBOSE_YES
+    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+      std::cout << lpc_labelFunc
+		<< ": OUT(" << geiinparam_verbose << ')'
+		<< " lui_numRows = " << lui_numRows
+		<< " _t_silhouette = " << this->_t_silhouette
+		<< std::endl;
+    }
+    --geiinparam_verbose;
+#endif //__VERBOSE_YES
+  }
+
+  ReportPairwise(const ReportPairwise<T_FEATURE,T_CLUSTERIDX,T_METRIC> &aireport_b) = delete;
+
+  ReportPairwise<T_FEATURE,T_CLUSTERIDX,T_METRIC>&
+  operator=(const ReportPairwise<T_FEATURE,T_CLUSTERIDX,T_METRIC> &aireport_b) = delete;
+
+  /*! \fn bool isSample() const
+    \brief True if the rows are a sample of the instances
+  */
+  inline bool isSample() const
+  {
+    return this->_b_sample;
+  }
+
+  inline uintidx getSizeSample() const
+  {
+    return (uintidx) this->_vectorui_rows.size();
+  }
+
+  /*! \fn T_METRIC silhouette() const
+    \brief Silhouette, as um::silhouette, or its estimate with a sample
+  */
+  inline T_METRIC silhouette() const
+  {
+    return this->_t_silhouette;
+  }
+
+  inline T_METRIC getSilhouetteLower() const
+  {
+    return this->_t_silhouetteLower;
+  }
+
+  inline T_METRIC getSilhouetteUpper() const
+  {
+    return this->_t_silhouetteUpper;
+  }
+
+  /*! \fn T_METRIC DunnIndex(const bool aib_withNullK = false) const
+    \brief Dunn's index, as um::DunnIndex, or an upper bound with a sample
+    \param aib_withNullK a bool it is possible that for testing you have null clusters and Dunn Index should be calculated omitting cluster nulls
+  */
+  T_METRIC DunnIndex(const bool aib_withNullK = false) const
+  {
+    const T_CLUSTERIDX lcidx_numClusterKNull =
+      T_CLUSTERIDX
+      (std::count
+       (this->_vectorui_numInstClusterK.begin(),
+	this->_vectorui_numInstClusterK.end(),
+	uintidx(0)
+	));
+
+    T_METRIC lot_DunnIndex = measuare_undefDunnIndex(T_METRIC);
+
+    if  ( (this->_cidx_numClusterK - lcidx_numClusterKNull) >= 2
+	  && (lcidx_numClusterKNull == 0 || aib_withNullK) ) {
+
+      /*MINIMUM DISTANCE TO THE OTHER CLUSTERS AND DIAMETER OF EACH CLUSTER
+       */
+      std::vector<T_METRIC> lvectort_delta
+	(this->_cidx_numClusterK,std::numeric_limits<T_METRIC>::max());
+      std::vector<T_METRIC> lvectort_Delta(this->_cidx_numClusterK,T_METRIC(0));
+      std::vector<bool>     lvectorb_haveRow(this->_cidx_numClusterK,false);
+      for (uintidx lui_r = 0; lui_r < this->_vectorcidx_rows.size(); lui_r++) {
+	const T_CLUSTERIDX lcidx_xinK = this->_vectorcidx_rows[lui_r];
+	if ( lcidx_xinK < 0 || lcidx_xinK >= this->_cidx_numClusterK )
+	  continue;
+	lvectorb_haveRow[lcidx_xinK] = true;
+	if ( this->_vectort_minDistOther[lui_r] < lvectort_delta[lcidx_xinK] )
+	  lvectort_delta[lcidx_xinK] = this->_vectort_minDistOther[lui_r];
+	if ( lvectort_Delta[lcidx_xinK] < this->_vectort_maxDistOwn[lui_r] )
+	  lvectort_Delta[lcidx_xinK] = this->_vectort_maxDistOwn[lui_r];
+      }
+
+      lot_DunnIndex = std::numeric_limits<T_METRIC>::max();
+      for (T_CLUSTERIDX lcidx_k = 0; lcidx_k < this->_cidx_numClusterK; lcidx_k++) {
+	if ( lvectorb_haveRow[lcidx_k] ) {
+	  T_METRIC lrt_partilDI  = (lvectort_Delta[lcidx_k] != 0)?
+	    lvectort_delta[lcidx_k] / lvectort_Delta[lcidx_k]
+	    :measuare_undefDunnIndex(T_METRIC);
+	  if ( lrt_partilDI < lot_DunnIndex )
+	    lot_DunnIndex = lrt_partilDI;
+	}
+      }
+    }
+
+    return lot_DunnIndex;
+  }
+
+protected:
+
+  T_CLUSTERIDX              _cidx_numClusterK;
+  uintidx                   _ui_numInstances;
+  bool                      _b_sample;
+  std::vector<uintidx>      _vectorui_numInstClusterK;
+  std::vector<uintidx>      _vectorui_rows;
+  std::vector<T_CLUSTERIDX> _vectorcidx_rows;
+  std::vector<T_METRIC>     _vectort_silhouette;
+  std::vector<T_METRIC>     _vectort_maxDistOwn;
+  std::vector<T_METRIC>     _vectort_minDistOther;
+  T_METRIC                  _t_silhouette;
+  T_METRIC                  _t_silhouetteLower;
+  T_METRIC                  _t_silhouetteUpper;
+
+}; /*ReportPairwise*/
+
+} /*END namespace um*/
+
+#endif  /*__UNSUPERVISED_MEASURES_PAIRWISE_HPP*/
@@ -0,0 +1,598 @@
+/*! \file unsupervised_measures_report.hpp
+ *
+ * \brief Unsupervised measures of a partition given by centroids, computed from one pass over the instances
+ *
+ * \details  This file is part of the LEAC.\n\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __UNSUPERVISED_MEASURES_REPORT_HPP
+#define __UNSUPERVISED_MEASURES_REPORT_HPP
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include "unsupervised_measures.hpp"
+
+#include "verbose_global.hpp"
+
+/*UMREPORT_NUMINSTBLOCK: instances read from the iterator before computing
+  their distances in parallel, less than INSTANCES_MMAP_NUMVIEWS is not
+  needed because only the features are kept
+ */
+#ifndef UMREPORT_NUMINSTBLOCK
+#define UMREPORT_NUMINSTBLOCK 4096
+#endif
+
+/*UMREPORT_MIN_INSTANCES_PARALLEL: smaller blocks are computed by one thread
+ */
+#ifndef UMREPORT_MIN_INSTANCES_PARALLEL
+#define UMREPORT_MIN_INSTANCES_PARALLEL 512
+#endif
+
+/*! \namespace um
+  \brief  Unsupervised measures for clustering analysis
+  \details Evaluate tries to determine the quality of a given obtained partition of the data without any external information available.
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace um {
+
+/*! \class ReportCentroids
+  \brief The intermediates shared by the measures of a partition given by centroids: the membership, the distances of each instance to its centroid, to the nearest centroid, to the nearest other centroid and to the mean of the instances, and the number, sum and maximum of the distances per cluster
+  \details The distances are computed once, in blocks of UMREPORT_NUMINSTBLOCK instances whose distances are evaluated in parallel, then they are added in the order of the instances, so each measure is equal to the function of namespace um that computes it with its own pass. The distance between instances is the square root of aifunc2p_squaredDist, as dist::Euclidean and dist::EuclideanSquared. The partition is read only once, getMemberShip() can be used to build a partition::PartitionLabelVector for the measures that need a ds::PartitionLinked
+
+  \code{.cpp}
+  um::ReportCentroids<DATATYPE_FEATURE,DATATYPE_CLUSTERIDX,DATATYPE_REAL>
+    lreport_centroids
+    (lomatrixrowt_centroids,
+     lpairvec_dataset.first.begin(),
+     lpairvec_dataset.first.end(),
+     lpartition_clusters,
+     *pfunct2p_distEuclidean,
+     *pfunct2p_distEuclideanSq
+     );
+
+  lreport_centroids.dbindex();
+  \endcode
+*/
+template < typename T_FEATURE,
+	   typename T_CLUSTERIDX,
+	   typename T_METRIC
+	   >
+class ReportCentroids {
+public:
+  template < typename INPUT_ITERATOR >
+  ReportCentroids
+  (const mat::MatrixRow<T_FEATURE>      &aimatrixt_centroids,
+   INPUT_ITERATOR                       aiiterator_instfirst,
+   const INPUT_ITERATOR                 aiiterator_instlast,
+   partition::Partition<T_CLUSTERIDX>   &aipartition_clusters,
+   const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist,
+   const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_squaredDist
+   )
+    : _matrixt_centroids(aimatrixt_centroids)
+    , _func2p_dist(aifunc2p_dist)
+    , _func2p_squaredDist(aifunc2p_squaredDist)
+    , _ui_numInstances(uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast)))
+    , _vectort_meanInstances(data::Instance<T_FEATURE>::getNumDimensions())
+    , _vectorcidx_memberShip(_ui_numInstances)
+    , _vectort_distSqCent(_ui_numInstances)
+    , _vectort_distSqNearest(_ui_numInstances)
+    , _vectort_distSqOther(_ui_numInstances)
+    , _vectort_distSqMean(_ui_numInstances)
+    , _vectorui_numInstClusterK(aimatrixt_centroids.getNumRows(),0)
+    , _vectort_sumDistCent(aimatrixt_centroids.getNumRows(),T_METRIC(0))
+    , _vectort_sumDistSqCent(aimatrixt_centroids.getNumRows(),T_METRIC(0))
+    , _vectort_maxDistCent(aimatrixt_centroids.getNumRows(),T_METRIC(0))
+    , _t_SED(T_METRIC(0))
+    , _t_SSE(T_METRIC(0))
+    , _t_sumDistCent(T_METRIC(0))
+    , _t_sumDistSqCent(T_METRIC(0))
+    , _t_e1(T_METRIC(0))
+    , _b_outlier(false)
+  {
+#ifdef __VERBOSE_YES
+    const char* lpc_labelFunc = "um::ReportCentroids";
+    ++geiinparam_verbose;
+    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+      std::cout << lpc_labelFunc
+		<< ":  IN(" << geiinparam_verbose << ')'
+		<< "\n\t(input mat::MatrixRow<T_FEATURE>& aimatrixt_centroids["
+		<< &aimatrixt_centroids << "]\n"
+		<< "\t input  partition::Partition<>&: aipartition_clusters["
+		<< &aipartition_clusters << "]\n"
+		<< "\t input  dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist["
+		<< &aifunc2p_dist << "]\n"
+		<< "\t input  dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_squaredDist["
+		<< &aifunc2p_squaredDist << ']'
+		<< "\n\t)"
+		<< std::endl;
+    }
+#endif //__VERBOSE_YES
+
+    const uintidx      lui_numDimensions = data::Instance<T_FEATURE>::getNumDimensions();
+    const T_CLUSTERIDX lcidx_numClusterK = T_CLUSTERIDX(aimatrixt_centroids.getNumRows());
+
+    /*MEAN OF THE INSTANCES, AS IN um::VRC AND um::indexI
+     */
+    if ( this->_ui_numInstances > 0 ) {
+      decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
+	*larray_sumFeatureTmp =
+	new decltype(utils::InstanceDataType().sum(data::Instance<T_FEATURE>::type()))
+	[lui_numDimensions];
+
+      stats::sumFeactures
+	(larray_sumFeatureTmp,
+	 aiiterator_instfirst,
+	 aiiterator_instlast,
+	 T_FEATURE(0)
+	 );
+
+      stats::meanVector
+	(this->_vectort_meanInstances.data(),
+	 this->_ui_numInstances,
+	 larray_sumFeatureTmp
+	 );
+
+      delete [] larray_sumFeatureTmp;
+    }
+
+    /*DISTANCES OF THE INSTANCES: THE ITERATOR AND THE PARTITION ARE
+      READ SEQUENTIALLY, THE DISTANCES OF A BLOCK IN PARALLEL
+     */
+    std::vector<const T_FEATURE*> lvectorpt_features(UMREPORT_NUMINSTBLOCK);
+    const T_FEATURE *lpt_meanInstances = this->_vectort_meanInstances.data();
+
+    aipartition_clusters.begin();
+    uintidx lui_instBlock = 0;
+    while ( aiiterator_instfirst != aiiterator_instlast ) {
+
+      uintidx lui_numInstBlock = 0;
+      while ( aiiterator_instfirst != aiiterator_instlast
+	      && lui_numInstBlock < UMREPORT_NUMINSTBLOCK ) {
+	lvectorpt_features[lui_numInstBlock] =
+	  ((data::Instance<T_FEATURE>*) *aiiterator_instfirst)->getFeatures();
+	this->_vectorcidx_memberShip[lui_instBlock + lui_numInstBlock] =
+	  aipartition_clusters.next();
+	++lui_numInstBlock;
+	++aiiterator_instfirst;
+      }
+
+      const bool lb_parallel = lui_numInstBlock >= UMREPORT_MIN_INSTANCES_PARALLEL;
+      const long ll_numInstBlock = (long) lui_numInstBlock;
+#pragma omp parallel for schedule(static) if(lb_parallel)
+      for ( long ll_i = 0; ll_i < ll_numInstBlock; ll_i++) {
+	const uintidx      lui_i = lui_instBlock + (uintidx) ll_i;
+	const T_FEATURE    *lpt_features = lvectorpt_features[(uintidx) ll_i];
+	const T_CLUSTERIDX lcidx_xinK = this->_vectorcidx_memberShip[lui_i];
+
+	T_METRIC lt_distSqCent    = std::numeric_limits<T_METRIC>::quiet_NaN();
+	T_METRIC lt_distSqNearest = std::numeric_limits<T_METRIC>::max();
+	T_METRIC lt_distSqOther   = std::numeric_limits<T_METRIC>::max();
+	for (T_CLUSTERIDX lcidx_k = 0; lcidx_k < lcidx_numClusterK; lcidx_k++) {
+	  const T_METRIC lt_distSq =
+	    aifunc2p_squaredDist
+	    (aimatrixt_centroids.getRow(lcidx_k),
+	     lpt_features,
+	     lui_numDimensions
+	     );
+	  if ( lt_distSq < lt_distSqNearest )
+	    lt_distSqNearest = lt_distSq;
+	  if ( lcidx_k == lcidx_xinK )
+	    lt_distSqCent = lt_distSq;
+	  else if ( lt_distSq < lt_distSqOther )
+	    lt_distSqOther = lt_distSq;
+	}
+	this->_vectort_distSqCent[lui_i]    = lt_distSqCent;
+	this->_vectort_distSqNearest[lui_i] = lt_distSqNearest;
+	this->_vectort_distSqOther[lui_i]   = lt_distSqOther;
+	this->_vectort_distSqMean[lui_i]    =
+	  aifunc2p_squaredDist
+	  (lpt_meanInstances,
+	   lpt_features,
+	   lui_numDimensions
+	   );
+      }
+      lui_instBlock += lui_numInstBlock;
+    }
+
+    /*SUMS IN THE ORDER OF THE INSTANCES
+     */
+    for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) {
+
+      this->_t_SED += std::sqrt(this->_vectort_distSqNearest[lui_i]);
+      this->_t_SSE += this->_vectort_distSqNearest[lui_i];
+      this->_t_e1  += std::sqrt(this->_vectort_distSqMean[lui_i]);
+
+      const T_CLUSTERIDX lcidx_xinK = this->_vectorcidx_memberShip[lui_i];
+      if ( 0 <= lcidx_xinK  && lcidx_xinK <  lcidx_numClusterK  ) {
+	const T_METRIC lt_distCent = std::sqrt(this->_vectort_distSqCent[lui_i]);
+	this->_t_sumDistCent   += lt_distCent;
+	this->_t_sumDistSqCent += this->_vectort_distSqCent[lui_i];
+	this->_vectort_sumDistCent[lcidx_xinK]   += lt_distCent;
+	this->_vectort_sumDistSqCent[lcidx_xinK] += this->_vectort_distSqCent[lui_i];
+	if ( this->_vectort_maxDistCent[lcidx_xinK] < lt_distCent )
+	  this->_vectort_maxDistCent[lcidx_xinK] = lt_distCent;
+	++this->_vectorui_numInstClusterK[lcidx_xinK];
+      }
+      else {
+	this->_b_outlier = true;
+      }
+    }
+
+#ifdef __VERBOSE_YES
+    if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+      std::cout << lpc_labelFunc
+		<< ": OUT(" << geiinparam_verbose << ')'
+		<< " _t_SED = " << this->_t_SED
+		<< " _t_SSE = " << this->_t_SSE
+		<< " _t_e1 = " << this->_t_e1
+		<< " _b_outlier = " << this->_b_outlier
+		<< std::endl;
+    }
+    --geiinparam_verbose;
+#endif //__VERBOSE_YES
+  }
+
+  ReportCentroids(const ReportCentroids<T_FEATURE,T_CLUSTERIDX,T_METRIC> &aireport_b) = delete;
+
+  ReportCentroids<T_FEATURE,T_CLUSTERIDX,T_METRIC>&
+  operator=(const ReportCentroids<T_FEATURE,T_CLUSTERIDX,T_METRIC> &aireport_b) = delete;
+
+  /*! \fn std::vector<T_CLUSTERIDX>& getMemberShip()
+    \brief The cluster of each instance read from the partition
+  */
+  inline std::vector<T_CLUSTERIDX>& getMemberShip()
+  {
+    return this->_vectorcidx_memberShip;
+  }
+
+  inline const std::vector<T_FEATURE>& getMeanInstances() const
+  {
+    return this->_vectort_meanInstances;
+  }
+
+  inline const std::vector<uintidx>& getNumInstClusterK() const
+  {
+    return this->_vectorui_numInstClusterK;
+  }
+
+  /*! \fn const std::vector<T_METRIC>& getRadiusClusterK() const
+    \brief The maximum distance of the instances of each cluster to its centroid, as um::radiusClusterKj
+  */
+  inline const std::vector<T_METRIC>& getRadiusClusterK() const
+  {
+    return this->_vectort_maxDistCent;
+  }
+
+  /*! \fn T_METRIC getSED() const
+    \brief SED with the nearest centroid rule, as um::SSE with aifunc2p_dist
+  */
+  inline T_METRIC getSED() const
+  {
+    return this->_t_SED;
+  }
+
+  /*! \fn T_METRIC getSSE() const
+    \brief SSE with the nearest centroid rule, as um::SSE with aifunc2p_squaredDist
+  */
+  inline T_METRIC getSSE() const
+  {
+    return this->_t_SSE;
+  }
+
+  /*! \fn T_METRIC dbindex() const
+    \brief DB Index, as um::dbindex with aifunc2p_dist
+  */
+  T_METRIC dbindex() const
+  {
+    if ( this->_matrixt_centroids.getNumRows() <= 1 )
+      return measuare_undefDBindex(T_METRIC);
+
+    std::vector<T_METRIC> lvectort_scatter(this->_vectort_sumDistCent);
+    for ( uintidx lui_k = 0; lui_k < lvectort_scatter.size(); lui_k++) {
+      if ( this->_vectorui_numInstClusterK[lui_k] != 0 )
+	lvectort_scatter[lui_k] /= (T_METRIC) this->_vectorui_numInstClusterK[lui_k];
+      else
+	lvectort_scatter[lui_k] = std::numeric_limits<T_METRIC>::quiet_NaN();
+    }
+
+    return um::dbindex
+      (this->_matrixt_centroids,
+       lvectort_scatter,
+       this->_func2p_dist
+       );
+  }
+
+  /*! \fn T_METRIC VRC(const bool aib_withNullK = false) const
+    \brief Variance ratio criterion, as um::VRC with aifunc2p_squaredDist
+  */
+  T_METRIC VRC(const bool aib_withNullK = false) const
+  {
+    const T_CLUSTERIDX lcidx_numClusterK =
+      T_CLUSTERIDX(this->_matrixt_centroids.getNumRows());
+    T_METRIC lometric_VRC = measuare_undefVRC(T_METRIC);
+
+    if ( lcidx_numClusterK >= 2 ) {
+
+      const T_CLUSTERIDX lcidx_numClusterKNull =
+	T_CLUSTERIDX
+	(std::count
+	 (this->_vectorui_numInstClusterK.begin(),
+	  this->_vectorui_numInstClusterK.end(),
+	  0)
+	 );
+
+      if ( (lcidx_numClusterK - lcidx_numClusterKNull) >= 2
+	   && (lcidx_numClusterKNull == 0 || aib_withNullK) ) {
+
+	T_METRIC lmetrict_SSw = this->_getSSw();
+
+	if  ( lmetrict_SSw > 0.0 ) {
+	  T_METRIC lmetrict_SSb = this->_getSSb(this->_func2p_squaredDist);
+
+	  lometric_VRC =
+	    (lmetrict_SSb  *
+	     ( (T_METRIC) this->_ui_numInstances -
+	       (T_METRIC) (lcidx_numClusterK - lcidx_numClusterKNull) ))
+	    / (lmetrict_SSw * (T_METRIC) ( lcidx_numClusterK - lcidx_numClusterKNull -1 ));
+	}
+      }
+    }
+
+    return lometric_VRC;
+  }
+
+  /*! \fn T_METRIC WBIndex() const
+    \brief WB-index, as um::WBIndex with aifunc2p_squaredDist
+  */
+  T_METRIC WBIndex() const
+  {
+    T_METRIC lometric_WBIndex = measuare_undefWBIndex(T_METRIC);
+
+    if ( this->_matrixt_centroids.getNumRows() > 1 ) {
+      T_METRIC lmetrict_SSb = this->_getSSb(this->_func2p_squaredDist);
+      if  ( lmetrict_SSb > 0.0 ) {
+	lometric_WBIndex = (this->_getSSw() / lmetrict_SSb) *
+	  (T_METRIC) ( this->_matrixt_centroids.getNumRows() );
+      }
+    }
+
+    return lometric_WBIndex;
+  }
+
+  /*! \fn T_METRIC scoreFunction() const
+    \brief Score function, as um::scoreFunction with aifunc2p_dist
+  */
+  T_METRIC scoreFunction() const
+  {
+    T_METRIC lometric_scoreFunction = measuare_undefScoreFunction(T_METRIC);
+
+    if ( this->_matrixt_centroids.getNumRows() > 0 ) {
+      T_METRIC lmetrict_wcd = T_METRIC(0.0);
+      for ( uintidx lui_k = 0; lui_k < this->_vectort_sumDistCent.size(); lui_k++) {
+	lmetrict_wcd = lmetrict_wcd +
+	  ((this->_vectorui_numInstClusterK[lui_k] != 0)?
+	   this->_vectort_sumDistCent[lui_k] / T_METRIC(this->_vectorui_numInstClusterK[lui_k])
+	   :T_METRIC(0.0));
+      }
+
+      T_METRIC lmetrict_bcd =
+	this->_getSSb(this->_func2p_dist)
+	/ ( T_METRIC(this->_ui_numInstances)
+	    * T_METRIC(this->_matrixt_centroids.getNumRows()) );
+
+      lometric_scoreFunction =
+	1.0 - 1.0 /(std::exp(std::exp(lmetrict_bcd-lmetrict_wcd)));
+    }
+
+    return lometric_scoreFunction;
+  }
+
+  /*! \fn T_METRIC indexI(const T_METRIC airt_p = 2.0) const
+    \brief Validity index I for a crisp partition, as um::indexI with aifunc2p_dist
+  */
+  T_METRIC indexI(const T_METRIC airt_p = 2.0) const
+  {
+    T_METRIC lometric_indexI = measuare_undefIndexI(T_METRIC);
+
+    if ( this->_matrixt_centroids.getNumRows() >= 2 ) {
+      const T_METRIC lmetric_ek =
+	(this->_b_outlier)?measuare_undefSSE(T_METRIC):this->_t_sumDistCent;
+      const T_METRIC lmetric_dk =
+	maxDistCjCjp
+	(this->_matrixt_centroids,
+	 this->_func2p_dist
+	 );
+
+      lometric_indexI = (lmetric_ek > 0.0 )?
+	(( this->_t_e1 / lmetric_ek ) *  lmetric_dk )
+	/ T_METRIC(this->_matrixt_centroids.getNumRows())
+	: measuare_undefIndexI(T_METRIC);
+
+      lometric_indexI = std::pow(lometric_indexI,airt_p);
+    }
+
+    return lometric_indexI;
+  }
+
+  /*! \fn T_METRIC xb() const
+    \brief Xie-Beni index for a crisp partition, as um::xb with aifunc2p_squaredDist
+  */
+  T_METRIC xb() const
+  {
+    T_METRIC lometric_xb = measuare_undefXieBeniIndex(T_METRIC);
+
+    if ( this->_matrixt_centroids.getNumRows() > 1 ) {
+      const T_METRIC lmetric_sigma =
+	(this->_b_outlier)?measuare_undefSSE(T_METRIC):this->_t_sumDistSqCent;
+      const T_METRIC lmetrict_dmin =
+	minDistCjCjp
+	(this->_matrixt_centroids,
+	 this->_func2p_squaredDist
+	 );
+
+      if ( lmetrict_dmin > 0 )
+	lometric_xb = lmetric_sigma / ( T_METRIC(this->_ui_numInstances) *  lmetrict_dmin );
+    }
+
+    return lometric_xb;
+  }
+
+  /*! \fn std::vector<T_METRIC> simplifiedSilhouette(const std::vector<T_INSTANCES_CLUSTER_K> &aivectorit_numInstClusterK) const
+    \brief Simplified silhouette of each cluster, as um::simplifiedSilhouette with aifunc2p_dist
+    \param aivectorit_numInstClusterK a vector with the number of instances per cluster
+  */
+  template < typename T_INSTANCES_CLUSTER_K >
+  std::vector<T_METRIC>
+  simplifiedSilhouette
+  (const std::vector<T_INSTANCES_CLUSTER_K>  &aivectorit_numInstClusterK) const
+  {
+    const T_CLUSTERIDX lcidx_numClusterK =
+      (T_CLUSTERIDX) this->_matrixt_centroids.getNumRows();
+    std::vector<T_METRIC>  lovectort_partialSilhouette
+      (this->_matrixt_centroids.getNumRows(),T_METRIC(0));
+
+    const T_CLUSTERIDX lcidx_numNullCluster =
+      (T_CLUSTERIDX)
+      std::count_if
+      (aivectorit_numInstClusterK.begin(),
+       aivectorit_numInstClusterK.end(),
+       [] (const T_INSTANCES_CLUSTER_K aiit_num) {return aiit_num == T_INSTANCES_CLUSTER_K(0);}
+       );
+
+    if ( (lcidx_numClusterK - lcidx_numNullCluster) > 1)  {
+
+      for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) {
+	const T_CLUSTERIDX lcidx_xinK = this->_vectorcidx_memberShip[lui_i];
+
+	if ( (0 <= lcidx_xinK)  && ( lcidx_xinK < lcidx_numClusterK)  ) {
+	  if ( aivectorit_numInstClusterK[lcidx_xinK] > 1 ) {
+	    const T_METRIC lt_a = std::sqrt(this->_vectort_distSqCent[lui_i]);
+	    const T_METRIC lt_b = std::sqrt(this->_vectort_distSqOther[lui_i]);
+	    lovectort_partialSilhouette[lcidx_xinK] +=
+	      (T_METRIC) (lt_b - lt_a) / (T_METRIC) std::max(lt_a,lt_b);
+	  }
+	  else if  ( aivectorit_numInstClusterK[lcidx_xinK] == 1 ) {
+	    lovectort_partialSilhouette[lcidx_xinK] = (T_METRIC) 0.0;
+	  }
+	}
+      }
+
+      for (uintidx lui_j = 0; lui_j < lovectort_partialSilhouette.size(); lui_j++)  {
+	if ( aivectorit_numInstClusterK[lui_j] > 0 ) {
+	  lovectort_partialSilhouette[lui_j] /=
+	    (T_METRIC) aivectorit_numInstClusterK[lui_j];
+	}
+      }
+    }
+
+    return lovectort_partialSilhouette;
+  }
+
+  /*! \fn T_METRIC simplifiedDunnIndex(const bool aib_withNullK = false) const
+    \brief Simplified Dunn's index, as um::simplifiedDunnIndex with aifunc2p_dist
+  */
+  T_METRIC simplifiedDunnIndex(const bool aib_withNullK = false) const
+  {
+    const T_CLUSTERIDX lcidx_numClusterK =
+      (T_CLUSTERIDX) this->_matrixt_centroids.getNumRows();
+    const T_CLUSTERIDX lcidx_numClusterKNull =
+      T_CLUSTERIDX
+      (std::count
+       (this->_vectorui_numInstClusterK.begin(),
+	this->_vectorui_numInstClusterK.end(),
+	0)
+       );
+    T_METRIC lot_DunnIndex = measuare_undefDunnIndex(T_METRIC);
+
+    if  ( (lcidx_numClusterK - lcidx_numClusterKNull) >= 2
+	  && (lcidx_numClusterKNull == 0 || aib_withNullK) ) {
+
+      lot_DunnIndex = std::numeric_limits<T_METRIC>::max();
+
+      for ( T_CLUSTERIDX lcidx_Ck = 0; lcidx_Ck < lcidx_numClusterK; lcidx_Ck++) {
+	if ( this->_vectorui_numInstClusterK[lcidx_Ck] != 0 ) {
+	  const T_METRIC lrt_delta =
+	    minDistCjCjp
+	    (lcidx_Ck,
+	     this->_matrixt_centroids,
+	     this->_func2p_dist
+	     );
+	  const T_METRIC lrt_Delta = this->_vectort_maxDistCent[lcidx_Ck];
+	  const T_METRIC lrt_partilDI  =
+	    (lrt_Delta != 0)? lrt_delta / (2.0 * lrt_Delta):measuare_undefDunnIndex(T_METRIC);
+
+	  if ( lrt_partilDI < lot_DunnIndex)
+	    lot_DunnIndex = lrt_partilDI;
+	}
+      }
+    }
+
+    return lot_DunnIndex;
+  }
+
+protected:
+
+  /*SS_W: SUM OF THE SQUARED DISTANCES OF THE CLUSTERS, AS um::sumDistInstCentInK
+   */
+  inline T_METRIC _getSSw() const
+  {
+    return interfacesse::sum
+      (this->_vectort_sumDistSqCent.data(),
+       (uintidx) this->_vectort_sumDistSqCent.size()
+       );
+  }
+
+  inline T_METRIC _getSSb(const dist::Dist<T_METRIC,T_FEATURE> &aifunc2p_dist) const
+  {
+    return ssb
+      (this->_matrixt_centroids,
+       this->_vectort_meanInstances.data(),
+       this->_vectorui_numInstClusterK,
+       aifunc2p_dist
+       );
+  }
+
+  const mat::MatrixRow<T_FEATURE>      &_matrixt_centroids;
+  const dist::Dist<T_METRIC,T_FEATURE> &_func2p_dist;
+  const dist::Dist<T_METRIC,T_FEATURE> &_func2p_squaredDist;
+  uintidx                              _ui_numInstances;
+
+  std::vector<T_FEATURE>               _vectort_meanInstances;
+
+  /*BY INSTANCE
+   */
+  std::vector<T_CLUSTERIDX>            _vectorcidx_memberShip;
+  std::vector<T_METRIC>                _vectort_distSqCent;
+  std::vector<T_METRIC>                _vectort_distSqNearest;
+  std::vector<T_METRIC>                _vectort_distSqOther;
+  std::vector<T_METRIC>                _vectort_distSqMean;
+
+  /*BY CLUSTER
+   */
+  std::vector<uintidx>                 _vectorui_numInstClusterK;
+  std::vector<T_METRIC>                _vectort_sumDistCent;
+  std::vector<T_METRIC>                _vectort_sumDistSqCent;
+  std::vector<T_METRIC>                _vectort_maxDistCent;
+
+  T_METRIC                             _t_SED;
+  T_METRIC                             _t_SSE;
+  T_METRIC                             _t_sumDistCent;
+  T_METRIC                             _t_sumDistSqCent;
+  T_METRIC                             _t_e1;
+  bool                                 _b_outlier;
+
+}; /*ReportCentroids*/
+
+} /*END namespace um*/
+
+#endif  /*__UNSUPERVISED_MEASURES_REPORT_HPP*/
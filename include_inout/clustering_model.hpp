@@ -0,0 +1,166 @@
+/*! \file clustering_model.hpp
+ *
+ * \brief Read and write the model learned by a clustering algorithm
+ *
+ * \details This file is part of the LEAC.\n\n
+ * The model are the centroids or medoids written with the option -C and\n
+ * the parameters of the standardization of variables written by\n
+ * stdvar_milligan_cooper1988 with the option --std-var-outfile\n
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __CLUSTERING_MODEL_HPP
+#define __CLUSTERING_MODEL_HPP
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "matrix.hpp"
+#include "matrix_read.hpp"
+
+#include "verbose_global.hpp"
+
+#define CLUSTERINGMODEL_LABEL_CENTROIDS "<CENTROIDS"
+#define CLUSTERINGMODEL_LABEL_MEDOIDS   "<MEDOIDS"
+#define CLUSTERINGMODEL_LABEL_STDVAR    "<STDVAR"
+
+/*! \namespace inout
+  \brief Module for input and output parameters
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace  inout {
+
+/*! \fn std::string readModelLine(const std::string &aistr_fileName, const std::vector<std::string> &aivectorstr_label, const uintidx aiui_numLine)
+  \brief The line aiui_numLine, counting from 1, of the lines of the file that begin with one of the labels
+*/
+std::string
+readModelLine
+(const std::string               &aistr_fileName,
+ const std::vector<std::string>  &aivectorstr_label,
+ const uintidx                   aiui_numLine
+ )
+{
+  std::ifstream lifstream_file(aistr_fileName);
+  if ( !lifstream_file ) {
+    throw std::invalid_argument
+      ("inout::readModelLine: unable to open file: " + aistr_fileName);
+  }
+
+  uintidx     lui_numLine = 0;
+  std::string lstr_line;
+  while ( std::getline(lifstream_file,lstr_line) ) {
+    for ( const auto& lstr_label: aivectorstr_label ) {
+      if ( lstr_line.compare(0,lstr_label.size(),lstr_label) == 0 ) {
+	if ( ++lui_numLine == aiui_numLine )
+	  return lstr_line;
+	break;
+      }
+    }
+  }
+
+  throw std::invalid_argument
+    ("inout::readModelLine: the file " + aistr_fileName
+     + " has fewer lines " + aivectorstr_label.front() + " than requested");
+}
+
+/*! \fn mat::MatrixRow<T_FEATURE> readModel(const std::string &aistr_fileName, const uintidx aiui_numRun = 1)
+  \brief The centroids or medoids of a run written with the option -C
+  \param aistr_fileName a string with the name of the file
+  \param aiui_numRun the number of the run, when the file has the centroids of several runs
+*/
+template < typename T_FEATURE >
+mat::MatrixRow<T_FEATURE>
+readModel
+(const std::string  &aistr_fileName,
+ const uintidx      aiui_numRun = 1
+ )
+{
+  mat::MatrixRow<T_FEATURE> lomatrixrowt_model =
+    mat::matrixread_get<T_FEATURE>
+    (readModelLine
+     (aistr_fileName,
+      {CLUSTERINGMODEL_LABEL_CENTROIDS,CLUSTERINGMODEL_LABEL_MEDOIDS},
+      aiui_numRun
+      )
+     );
+
+  if ( lomatrixrowt_model.getNumRows() == 0 ) {
+    throw std::invalid_argument
+      ("inout::readModel: without centroids in file: " + aistr_fileName);
+  }
+
+  return lomatrixrowt_model;
+}
+
+/*! \fn mat::MatrixRow<T_FEATURE> readStdVar(const std::string &aistr_fileName, const uintidx aiui_numDimensions)
+  \brief The parameters of the standardization of variables, the row 0 has the location and the row 1 the scale of each variable, \f$ z = (x - location) / scale \f$
+*/
+template < typename T_FEATURE >
+mat::MatrixRow<T_FEATURE>
+readStdVar
+(const std::string  &aistr_fileName,
+ const uintidx      aiui_numDimensions
+ )
+{
+  mat::MatrixRow<T_FEATURE> lomatrixrowt_stdVar =
+    mat::matrixread_get<T_FEATURE>
+    (readModelLine(aistr_fileName,{CLUSTERINGMODEL_LABEL_STDVAR},1));
+
+  if ( lomatrixrowt_stdVar.getNumRows() != 2
+       || lomatrixrowt_stdVar.getNumColumns() != aiui_numDimensions ) {
+    throw std::invalid_argument
+      ("inout::readStdVar: the standardization of the file "
+       + aistr_fileName + " does not have the dimensions of the model");
+  }
+
+  return lomatrixrowt_stdVar;
+}
+
+/*! \fn void writeStdVar(std::ostream &aiostream_out, const char *aipc_stdVarName, const T_FEATURE *aiarrayt_location, const T_FEATURE *aiarrayt_scale, const uintidx aiui_numDimensions)
+  \brief Write the parameters of the standardization of variables in a line that readStdVar reads
+*/
+template < typename T_FEATURE >
+void
+writeStdVar
+(std::ostream     &aiostream_out,
+ const char       *aipc_stdVarName,
+ const T_FEATURE  *aiarrayt_location,
+ const T_FEATURE  *aiarrayt_scale,
+ const uintidx    aiui_numDimensions
+ )
+{
+  mat::MatrixRow<T_FEATURE> lmatrixrowt_stdVar(2,aiui_numDimensions);
+  for (uintidx lui_j = 0; lui_j < aiui_numDimensions; lui_j++) {
+    lmatrixrowt_stdVar(0,lui_j) = aiarrayt_location[lui_j];
+    lmatrixrowt_stdVar(1,lui_j) = aiarrayt_scale[lui_j];
+  }
+
+  std::ostringstream lostrstream_labelStdVar;
+  lostrstream_labelStdVar
+    << CLUSTERINGMODEL_LABEL_STDVAR
+    << ",_standardization of variables,"
+    << aipc_stdVarName
+    << ",_location,scale";
+
+  lmatrixrowt_stdVar.print
+    (aiostream_out,
+     lostrstream_labelStdVar.str().c_str(),
+     ',',
+     ';'
+     );
+  aiostream_out << std::endl;
+}
+
+} /*END namespace inout*/
+
+#endif /*__CLUSTERING_MODEL_HPP*/
@@ -0,0 +1,599 @@
+/*! \file clustering_worker.hpp
+ *
+ * \brief resident worker that runs the clustering jobs of a spool directory
+ *
+ * \details This file is part of the LEAC.\n\n
+ * The worker reads each data set once and keeps it in memory, the jobs
+ * placed in a spool directory run in child processes that share the
+ * data sets already read.
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef CLUSTERING_WORKER_HPP
+#define CLUSTERING_WORKER_HPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <getopt.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include "problem_context.hpp"
+#include "instance.hpp"
+#include "instance_interfazclass.hpp"
+#include "inparam_readinst.hpp"
+#include "inparamclustering_getparameter.hpp"
+#include "common.hpp"
+
+/*! \namespace clusteringworker
+  \brief Resident worker: the program stays running and executes the jobs written to a spool directory
+  \details A job is a file NAME.job in the spool directory with the name of the program followed by its options, eg. "gas_fkcentroid -i iris.csv -c 5 -z 12345 --number-clusters=3". The worker of that program takes the job by renaming it to NAME.run, reads the data sets of the job if they are not already in memory and runs it in a child process, so the data sets are shared with the job without reading or copying them. The output of the job is written to NAME.out as it is produced, in the same format as the program run from the command line, at the end the job is renamed to NAME.done or NAME.failed. The worker starts a job when the jobs running and the job fit in the number of jobs and the memory given, SIGINT or SIGTERM stop it after the running jobs end. To submit a job without the worker reading it half written, write it with another name and rename it to NAME.job
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace clusteringworker {
+
+/*! \enum WorkerMode
+  \brief What the program does with the data sets it reads
+*/
+enum WorkerMode {
+  WORKER_NONE,    /*!< Program run from the command line, the data sets are read and deleted by the program*/
+  WORKER_PREPARE, /*!< Worker reading the data sets of a job, they are kept and the job is not run*/
+  WORKER_RUN      /*!< Child process of the worker running a job with the data sets kept*/
+};
+
+/*! Mode of the process, see dataSetReadResident
+ */
+WorkerMode gworkermode_current = WORKER_NONE;
+
+/*! Keys of the data sets of the job being prepared, with the bytes of each one
+ */
+std::vector<std::pair<std::string,size_t> > gvectorpair_dataSetsJob;
+
+/*! Set by SIGINT or SIGTERM, the worker does not take more jobs
+ */
+volatile std::sig_atomic_t gsigatomic_stopWorker = 0;
+
+/*! \fn bool isPreparing()
+  \brief The program only has to read the data sets of the job
+*/
+inline bool isPreparing()
+{
+  return gworkermode_current == WORKER_PREPARE;
+}
+
+/*! \class DataSetResident
+  \brief Data set read by the worker with the context and the class labels of its instances
+*/
+template <typename T_FEATURE,
+	  typename T_INSTANCES_CLUSTER_K,
+	  typename T_CLUSTERIDX
+	  >
+class DataSetResident {
+public:
+  DataSetResident()
+    : _pcontext_problem(new data::ProblemContext())
+    , _st_bytes(0)
+    , _b_taken(false)
+  {}
+
+  std::pair<std::vector<data::Instance<T_FEATURE>* >,
+	    std::vector<data::Instance<T_FEATURE>* > >  _pairvec_dataSet;
+  std::unique_ptr<data::ProblemContext>               _pcontext_problem;
+  std::pair<typename data::InstanceIterfazClass
+	    <T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>::MapClassLabel,
+	    T_CLUSTERIDX>                              _pair_classTable;
+  size_t                                       _st_bytes;
+  bool                                         _b_taken;
+
+}; /*DataSetResident*/
+
+/*! \fn std::string fileKey(const std::string &aistr_file)
+  \brief Name, size and time of modification of the file, a data set is read again when its file changes
+*/
+inline std::string fileKey(const std::string &aistr_file)
+{
+  std::ostringstream lostrstream_key;
+  struct stat lstat_file;
+
+  lostrstream_key << aistr_file;
+  if ( stat(aistr_file.c_str(), &lstat_file) == 0 )
+    lostrstream_key << ':' << lstat_file.st_size
+		    << ':' << lstat_file.st_mtime;
+  return lostrstream_key.str();
+}
+
+/*! \fn std::string dataSetKey(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst)
+  \brief The files of the current data set and the parameters used to read them
+*/
+template <typename T_FEATURE,
+	  typename T_INSTANCES_CLUSTER_K,
+	  typename T_CLUSTERIDX
+	  >
+std::string
+dataSetKey
+(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst)
+{
+  std::ostringstream lostrstream_key;
+
+  lostrstream_key
+    << fileKey(aiipri_inParamReadInst.getCurrentFileInstance());
+  if ( aiipri_inParamReadInst.getNumFilesInstanceTest() > 0 )
+    lostrstream_key
+      << '|' << fileKey(aiipri_inParamReadInst.getCurrentFileInstanceTest());
+  lostrstream_key
+    << '|' << aiipri_inParamReadInst.getFormatInstanceFile()
+    << '|' << aiipri_inParamReadInst.getHaveHeaderFileInstance()
+    << '|' << aiipri_inParamReadInst.getSeparateAttributes()
+    << '|' << aiipri_inParamReadInst.getSelectAttributes()
+    << '|' << aiipri_inParamReadInst.getClassInstanceColumn()
+    << '|' << aiipri_inParamReadInst.getClusterInstanceColumn()
+    << '|' << aiipri_inParamReadInst.getIDInstanceColumn()
+    << '|' << aiipri_inParamReadInst.getInstanceFrequencyColumn()
+    << '|' << aiipri_inParamReadInst.getIDMultiInstanceColumn()
+    << '|' << aiipri_inParamReadInst.getClassMultiInstColumn();
+
+  return lostrstream_key.str();
+}
+
+/*! \fn std::pair< std::vector<data::Instance<T_FEATURE>* >, std::vector<data::Instance<T_FEATURE>* > > dataSetReadResident(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst, FUNCTION_READ aifunc_read)
+  \brief Read the current data set with aifunc_read, in the worker the data set is read only once
+  \details Outside of the worker it only calls aifunc_read. When the worker prepares a job the data set is read with its own data::ProblemContext and kept, the program must not delete it. In the job the data set kept is returned, its context and class labels are installed and the job owns the instances
+  \param aiipri_inParamReadInst a inout::InParamReadInst with the parameters to read the data set
+  \param aifunc_read function that reads the data set, eg. inout::dataSetRead
+*/
+template <typename T_FEATURE,
+	  typename T_INSTANCES_CLUSTER_K,
+	  typename T_CLUSTERIDX,
+	  typename FUNCTION_READ
+	  >
+std::pair< std::vector<data::Instance<T_FEATURE>* >, std::vector<data::Instance<T_FEATURE>* > >
+dataSetReadResident
+(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst,
+ FUNCTION_READ aifunc_read
+ )
+{
+  typedef DataSetResident<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> DataSetResidentT;
+  typedef data::InstanceIterfazClass<T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> InstanceIterfazClassT;
+
+  static std::map<std::string,std::unique_ptr<DataSetResidentT> > lstmap_dataSetResident;
+
+  if ( gworkermode_current == WORKER_NONE )
+    return aifunc_read();
+
+  const std::string lstr_key = dataSetKey(aiipri_inParamReadInst);
+  auto lit_dataSet = lstmap_dataSetResident.find(lstr_key);
+
+  if ( gworkermode_current == WORKER_PREPARE ) {
+
+    if ( lit_dataSet == lstmap_dataSetResident.end() ) {
+
+      std::unique_ptr<DataSetResidentT> lpdataset_read(new DataSetResidentT());
+      {
+	data::ProblemContext::Scope lscope_problem(*lpdataset_read->_pcontext_problem);
+	lpdataset_read->_pairvec_dataSet = aifunc_read();
+	lpdataset_read->_st_bytes =
+	  (lpdataset_read->_pairvec_dataSet.first.size()
+	   + lpdataset_read->_pairvec_dataSet.second.size())
+	  * (sizeof(data::Instance<T_FEATURE>) + 2 * sizeof(void*)
+	     + data::Instance<T_FEATURE>::getNumDimensions() * sizeof(T_FEATURE));
+      }
+      if ( aiipri_inParamReadInst.getClassInstanceColumn() )
+	lpdataset_read->_pair_classTable = InstanceIterfazClassT::getClassTable();
+
+      lit_dataSet = lstmap_dataSetResident.emplace
+	(lstr_key,std::move(lpdataset_read)).first;
+    }
+    gvectorpair_dataSetsJob.push_back
+      (std::make_pair(lstr_key,lit_dataSet->second->_st_bytes));
+
+    return lit_dataSet->second->_pairvec_dataSet;
+  }
+
+  /*WORKER_RUN: THE INSTANCES KEPT ARE GIVEN ONCE, THE JOB DELETES THEM
+   */
+  if ( lit_dataSet == lstmap_dataSetResident.end() ||
+       lit_dataSet->second->_b_taken ) {
+    data::ProblemContext::install(NULL);
+    return aifunc_read();
+  }
+
+  lit_dataSet->second->_b_taken = true;
+  data::ProblemContext::install(lit_dataSet->second->_pcontext_problem.get());
+  InstanceIterfazClassT::setClassTable(lit_dataSet->second->_pair_classTable);
+
+  return lit_dataSet->second->_pairvec_dataSet;
+}
+
+/*! \fn size_t residentBytes()
+  \brief Resident memory of the process, 0 if it is unknown
+*/
+inline size_t residentBytes()
+{
+  std::ifstream lifstream_statm("/proc/self/statm");
+  size_t lst_pagesSize = 0;
+  size_t lst_pagesResident = 0;
+
+  if ( !(lifstream_statm >> lst_pagesSize >> lst_pagesResident) )
+    return 0;
+  return lst_pagesResident * (size_t) sysconf(_SC_PAGESIZE);
+}
+
+/*! \class JobRunning
+  \brief Job of the spool directory running in a child process
+*/
+class JobRunning {
+public:
+  std::string  _str_name;
+  std::string  _str_keyFootprint;
+  size_t       _st_bytesEstimated;
+  size_t       _st_bytesParent;
+}; /*JobRunning*/
+
+extern "C" inline void workerStopHandler(int)
+{
+  gsigatomic_stopWorker = 1;
+}
+
+/*! \fn int runWorker(const std::string &aistr_spoolDir, const std::string &aistr_program, const char *aipc_argv0, uintidx aiui_maxJobs, size_t aist_bytesMax, FUNCTION_MAIN aifunc_main)
+  \brief Take the jobs of aistr_program from the spool directory and run them until SIGINT or SIGTERM
+  \details The memory of a job is estimated as the memory used by the last job with the same data set, or the size of its data sets before one has ended. A job is always started when no other job is running
+  \param aistr_spoolDir directory where the jobs are written
+  \param aistr_program name of the program in the jobs taken by the worker
+  \param aipc_argv0 name of the program passed to the job
+  \param aiui_maxJobs maximum number of jobs running at the same time
+  \param aist_bytesMax maximum memory of the jobs running at the same time, 0 without limit
+  \param aifunc_main main function of the program
+*/
+template <typename FUNCTION_MAIN>
+int
+runWorker
+(const std::string &aistr_spoolDir,
+ const std::string &aistr_program,
+ const char        *aipc_argv0,
+ const uintidx     aiui_maxJobs,
+ const size_t      aist_bytesMax,
+ FUNCTION_MAIN     aifunc_main
+ )
+{
+  std::map<pid_t,JobRunning>    lmap_jobsRunning;
+  std::map<std::string,size_t>  lmap_bytesFootprint;
+  size_t                        lst_bytesRunning = 0;
+
+  struct sigaction lsigaction_stop;
+  std::memset(&lsigaction_stop, 0, sizeof(lsigaction_stop));
+  lsigaction_stop.sa_handler = workerStopHandler;
+  sigemptyset(&lsigaction_stop.sa_mask);
+  sigaction(SIGINT, &lsigaction_stop, NULL);
+  sigaction(SIGTERM, &lsigaction_stop, NULL);
+
+  auto lfunc_pathJob =
+    [&](const std::string &aistr_name, const char *aipc_extension)
+    {
+      return aistr_spoolDir + "/" + aistr_name + aipc_extension;
+    };
+
+  /*END OF A JOB: RENAME IT AND LEARN ITS MEMORY
+   */
+  auto lfunc_waitJob =
+    [&](int aii_options) -> bool
+    {
+      int          li_status;
+      struct rusage lrusage_job;
+      const pid_t  lpid_job = wait4(-1, &li_status, aii_options, &lrusage_job);
+
+      if ( lpid_job <= 0 )
+	return false;
+      auto lit_job = lmap_jobsRunning.find(lpid_job);
+      if ( lit_job == lmap_jobsRunning.end() )
+	return true;
+
+      const bool lb_done =
+	WIFEXITED(li_status) && WEXITSTATUS(li_status) == 0;
+      std::rename
+	(lfunc_pathJob(lit_job->second._str_name, ".run").c_str(),
+	 lfunc_pathJob(lit_job->second._str_name, lb_done?".done":".failed").c_str());
+
+      const size_t lst_bytesPeak = (size_t) lrusage_job.ru_maxrss * 1024;
+      if ( lst_bytesPeak > lit_job->second._st_bytesParent )
+	lmap_bytesFootprint[lit_job->second._str_keyFootprint] =
+	  lst_bytesPeak - lit_job->second._st_bytesParent;
+
+      lst_bytesRunning -= lit_job->second._st_bytesEstimated;
+      std::cout << aistr_program << " worker: "
+		<< lit_job->second._str_name << (lb_done?" done":" failed")
+		<< std::endl;
+      lmap_jobsRunning.erase(lit_job);
+
+      return true;
+    };
+
+  std::cout << aistr_program << " worker: spool " << aistr_spoolDir
+	    << ", jobs " << aiui_maxJobs
+	    << ", memory " << (aist_bytesMax >> 20) << " MB"
+	    << std::endl;
+
+  while ( !gsigatomic_stopWorker || !lmap_jobsRunning.empty() ) {
+
+    while ( lfunc_waitJob(WNOHANG) );
+
+    /*JOBS WAITING IN THE SPOOL, IN ORDER OF NAME
+     */
+    std::vector<std::string> lvectorstr_jobs;
+    if ( !gsigatomic_stopWorker ) {
+      DIR *lpdir_spool = opendir(aistr_spoolDir.c_str());
+      if ( lpdir_spool == NULL ) {
+	std::string lstr_error("clusteringworker::runWorker: can not open spool directory ");
+	lstr_error += aistr_spoolDir;
+	throw std::invalid_argument(lstr_error);
+      }
+      while ( struct dirent *lpdirent_job = readdir(lpdir_spool) ) {
+	std::string lstr_file(lpdirent_job->d_name);
+	if ( lstr_file.size() > 4 &&
+	     lstr_file.compare(lstr_file.size() - 4, 4, ".job") == 0 )
+	  lvectorstr_jobs.push_back(lstr_file.substr(0, lstr_file.size() - 4));
+      }
+      closedir(lpdir_spool);
+      std::sort(lvectorstr_jobs.begin(), lvectorstr_jobs.end());
+    }
+
+    bool lb_started = false;
+
+    for ( const std::string &lstr_name: lvectorstr_jobs ) {
+
+      if ( gsigatomic_stopWorker )
+	break;
+
+      std::vector<std::string> lvectorstr_args;
+      {
+	std::ifstream lifstream_job(lfunc_pathJob(lstr_name, ".job"));
+	lvectorstr_args.assign
+	  (std::istream_iterator<std::string>(lifstream_job),
+	   std::istream_iterator<std::string>());
+      }
+      if ( lvectorstr_args.empty() || lvectorstr_args[0] != aistr_program )
+	continue;
+      /*ANOTHER WORKER CAN TAKE THE SAME JOB, ONLY ONE RENAMES IT
+       */
+      if ( std::rename(lfunc_pathJob(lstr_name, ".job").c_str(),
+		       lfunc_pathJob(lstr_name, ".run").c_str()) != 0 )
+	continue;
+
+      std::vector<char*> lvectorpc_argv;
+      lvectorpc_argv.push_back(const_cast<char*>(aipc_argv0));
+      for (uintidx lui_i = 1; lui_i < lvectorstr_args.size(); lui_i++)
+	lvectorpc_argv.push_back(&lvectorstr_args[lui_i][0]);
+      lvectorpc_argv.push_back(NULL);
+      const int li_argc = (int) lvectorpc_argv.size() - 1;
+
+      const int lfd_out =
+	open(lfunc_pathJob(lstr_name, ".out").c_str(),
+	     O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if ( lfd_out < 0 ) {
+	std::rename(lfunc_pathJob(lstr_name, ".run").c_str(),
+		    lfunc_pathJob(lstr_name, ".failed").c_str());
+	continue;
+      }
+
+      /*READ THE DATA SETS OF THE JOB, THE MESSAGES GO TO ITS OUTPUT
+       */
+      std::cout.flush();
+      std::fflush(stdout);
+      std::cerr.flush();
+      const int lfd_stdout = dup(STDOUT_FILENO);
+      const int lfd_stderr = dup(STDERR_FILENO);
+      dup2(lfd_out, STDOUT_FILENO);
+      dup2(lfd_out, STDERR_FILENO);
+
+      bool lb_prepared = true;
+      gvectorpair_dataSetsJob.clear();
+      gworkermode_current = WORKER_PREPARE;
+      inout::gbinparam_throwUsage = true;
+      optind = 0;
+      try {
+	aifunc_main(li_argc, lvectorpc_argv.data());
+      }
+      catch (const std::exception &aiexception_prepare) {
+	std::cout << aiexception_prepare.what() << std::endl;
+	lb_prepared = false;
+      }
+      gworkermode_current = WORKER_NONE;
+      inout::gbinparam_throwUsage = false;
+
+      std::cout.flush();
+      std::fflush(stdout);
+      std::cerr.flush();
+      dup2(lfd_stdout, STDOUT_FILENO);
+      dup2(lfd_stderr, STDERR_FILENO);
+      close(lfd_stdout);
+      close(lfd_stderr);
+
+      if ( !lb_prepared ) {
+	close(lfd_out);
+	std::rename(lfunc_pathJob(lstr_name, ".run").c_str(),
+		    lfunc_pathJob(lstr_name, ".failed").c_str());
+	std::cout << aistr_program << " worker: " << lstr_name << " failed"
+		  << std::endl;
+	continue;
+      }
+
+      /*ADMISSION: NUMBER OF JOBS AND MEMORY
+       */
+      JobRunning ljob_new;
+      ljob_new._str_name = lstr_name;
+      ljob_new._st_bytesEstimated = 0;
+      for ( const auto &lpair_dataSet: gvectorpair_dataSetsJob )
+	ljob_new._st_bytesEstimated += lpair_dataSet.second;
+      if ( !gvectorpair_dataSetsJob.empty() )
+	ljob_new._str_keyFootprint = gvectorpair_dataSetsJob.front().first;
+      auto lit_footprint = lmap_bytesFootprint.find(ljob_new._str_keyFootprint);
+      if ( lit_footprint != lmap_bytesFootprint.end() )
+	ljob_new._st_bytesEstimated = lit_footprint->second;
+
+      while ( !lmap_jobsRunning.empty() &&
+	      ( lmap_jobsRunning.size() >= aiui_maxJobs ||
+		( aist_bytesMax > 0 &&
+		  lst_bytesRunning + ljob_new._st_bytesEstimated > aist_bytesMax ) ) ) {
+	lfunc_waitJob(0);
+      }
+
+      ljob_new._st_bytesParent = residentBytes();
+      std::cout.flush();
+      std::fflush(stdout);
+
+      const pid_t lpid_job = fork();
+
+      if ( lpid_job == 0 ) { /*JOB*/
+	signal(SIGINT, SIG_DFL);
+	signal(SIGTERM, SIG_DFL);
+	dup2(lfd_out, STDOUT_FILENO);
+	dup2(lfd_out, STDERR_FILENO);
+	close(lfd_out);
+
+	int li_status = EXIT_FAILURE;
+	gworkermode_current = WORKER_RUN;
+	optind = 0;
+	try {
+	  li_status = aifunc_main(li_argc, lvectorpc_argv.data());
+	}
+	catch (const std::exception &aiexception_job) {
+	  std::cerr << aiexception_job.what() << std::endl;
+	}
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(stdout);
+	_exit(li_status);
+      }
+
+      close(lfd_out);
+      if ( lpid_job < 0 ) {
+	std::rename(lfunc_pathJob(lstr_name, ".run").c_str(),
+		    lfunc_pathJob(lstr_name, ".failed").c_str());
+	std::cout << aistr_program << " worker: " << lstr_name
+		  << " failed: " << std::strerror(errno) << std::endl;
+	continue;
+      }
+
+      lst_bytesRunning += ljob_new._st_bytesEstimated;
+      lmap_jobsRunning.emplace(lpid_job, std::move(ljob_new));
+      lb_started = true;
+      std::cout << aistr_program << " worker: " << lstr_name << " running"
+		<< std::endl;
+    }
+
+    if ( !lb_started ) {
+      /*NOTHING TO DO: WAIT FOR A JOB TO END OR A NEW JOB
+       */
+      struct timespec ltimespec_poll = {0, 100000000};
+      nanosleep(&ltimespec_poll, NULL);
+    }
+  }
+
+  return 0;
+}
+
+/*! \fn int runMain(int argc, char **argv, FUNCTION_MAIN aifunc_main)
+  \brief Run the program from the command line, or as a resident worker when the first option is --worker
+  \details Options of the worker:\n
+  --worker=DIRECTORY   spool directory of the jobs\n
+  --worker-jobs=NUMBER maximum number of jobs running at the same time, default is the number of processors\n
+  --worker-memory=MB   maximum memory of the jobs running at the same time, default is without limit
+  \param argc number of arguments
+  \param argv arguments
+  \param aifunc_main main function of the program
+*/
+template <typename FUNCTION_MAIN>
+int runMain(int argc, char **argv, FUNCTION_MAIN aifunc_main)
+{
+  if ( argc < 2 || std::strncmp(argv[1], "--worker", 8) != 0 )
+    return aifunc_main(argc, argv);
+
+  static struct option long_options[] =
+    {
+      {"worker",        required_argument, 0, 'w'},
+      {"worker-jobs",   required_argument, 0, 'j'},
+      {"worker-memory", required_argument, 0, 'm'},
+      {"help",          no_argument,       0, '?'},
+      {0, 0, 0, 0}
+    };
+
+  std::string lstr_spoolDir;
+  uintidx     lui_maxJobs = std::max(1u, std::thread::hardware_concurrency());
+  size_t      lst_bytesMax = 0;
+  int         li_opt;
+  int         option_index = 0;
+
+  while ( (li_opt = getopt_long(argc, argv, "?", long_options, &option_index)) != -1 ) {
+    switch (li_opt) {
+    case 'w':
+      lstr_spoolDir = optarg;
+      break;
+    case 'j':
+      lui_maxJobs = (uintidx) std::max(1l, std::strtol(optarg, NULL, 10));
+      break;
+    case 'm':
+      lst_bytesMax = (size_t) std::strtoull(optarg, NULL, 10) << 20;
+      break;
+    default:
+      lstr_spoolDir.clear();
+      optind = argc;
+      break;
+    }
+  }
+
+  if ( lstr_spoolDir.empty() || optind < argc ) {
+    std::cout << "Usage: " << argv[0] << " --worker=DIRECTORY [OPTION]...\n"
+	      << "Run the jobs written to the spool DIRECTORY as files NAME.job\n"
+	      << "with the program name followed by its options, the output is\n"
+	      << "written to NAME.out and the job is renamed to NAME.done or NAME.failed\n\n"
+	      << "  --worker=DIRECTORY          spool directory of the jobs\n"
+	      << "  --worker-jobs=NUMBER        maximum number of jobs running at the same\n"
+	      << "                              time, default is the number of processors\n"
+	      << "  --worker-memory=MB          maximum memory of the jobs running at the\n"
+	      << "                              same time, default is without limit\n"
+	      << "  -?, --help                  help"
+	      << std::endl;
+    return -1;
+  }
+
+  const char *lpc_program = std::strrchr(argv[0], '/');
+  lpc_program = (lpc_program != NULL)?lpc_program + 1:argv[0];
+
+  return runWorker
+    (lstr_spoolDir,
+     std::string(lpc_program),
+     argv[0],
+     lui_maxJobs,
+     lst_bytesMax,
+     aifunc_main
+     );
+}
+
+} /*END namespace clusteringworker
+   */
+
+#endif /*CLUSTERING_WORKER_HPP*/
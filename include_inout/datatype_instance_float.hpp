@@ -0,0 +1,47 @@
+/*! \file datatype_instance_float.hpp
+ *
+ * \brief datatype instance float
+ *
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef DATA_TYPE_INSTANCE_FLOAT_HPP
+#define DATA_TYPE_INSTANCE_FLOAT_HPP
+
+
+#define DATATYPE_FEATURE               float
+#define DATATYPE_FEATURE_SUM           double
+
+/* CENTROIDS ROUND :
+   if data for floating point to integers must be  
+       DATATYPE_CENTROIDS_ROUND 1
+   else data all floating
+       DATATYPE_CENTROIDS_ROUND 0
+*/
+
+#define DATATYPE_CENTROIDS_ROUND         0
+
+#define DATATYPE_INSTANCES_CLUSTER_K    long
+
+#define DATATYPE_CLUSTERIDX             int    // -1, 0, .., K  
+
+#define DATATYPE_INSTANCEIDX            uintidx
+
+/*When instances consist of occurrences 
+  or frequency
+ */
+#define DATATYPE_INSTANCE_FREQUENCY      int  
+
+/*￼Data type for metrics and distances
+ */
+#define DATATYPE_REAL           double
+
+/*Tipo de dato para almacenar bits
+*/
+#define DATATYPE_BITSIZE unsigned int
+
+#endif /*DATA_TYPE_INSTANCE_FLOAT_HPP*/
+
@@ -0,0 +1,348 @@
+/*! \file ga_checkpoint.hpp
+ *
+ * \brief checkpoint and resume of the genetic algorithms
+ *
+ * \details This file is part of the LEAC.\n\n
+ * The state of a generation is copied to a binary snapshot that a
+ * background thread writes to disk, a later run reads the snapshot
+ * and continues from that generation.
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef GA_CHECKPOINT_HPP
+#define GA_CHECKPOINT_HPP
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <type_traits>
+#include <utility>
+#include "random_ext.hpp"
+#include "chromosome_variablelength.hpp"
+#include "common.hpp"
+
+extern thread_local StdMT19937 gmt19937_eng;
+
+/*! \namespace gacheckpoint
+  \brief Checkpoint of the state of a genetic algorithm and resume of the run
+  \details The algorithm copies its state to a Snapshot at the beginning of a generation and posts it to a CheckpointWriter, the copy is made in memory and the file is written by another thread, so the generation loop does not wait for the disk. A run resumed from the snapshot produces the same result as the run without interruption
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace gacheckpoint {
+
+#define GACHECKPOINT_MAGIC    "LEACCKPT"
+#define GACHECKPOINT_VERSION  1
+
+/*! \class Snapshot
+  \brief Binary buffer with the state of the algorithm, the values are read in the order they were written
+*/
+class Snapshot {
+public:
+  Snapshot(): _st_posRead(0) {}
+
+  template <typename T>
+  void write(const T& ait_value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+		  "gacheckpoint::Snapshot: type is not trivially copyable");
+    const char *lpc_value = reinterpret_cast<const char*>(&ait_value);
+    this->_vectorc_buffer.insert
+      (this->_vectorc_buffer.end(), lpc_value, lpc_value + sizeof(T));
+  }
+
+  template <typename T>
+  void read(T& aot_value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+		  "gacheckpoint::Snapshot: type is not trivially copyable");
+    this->_readBytes(reinterpret_cast<char*>(&aot_value), sizeof(T));
+  }
+
+  /*! \fn void writeArray(const T* aiarrayt_values, const uintidx aiui_size)
+    \brief The values of the array without its size, the size is written before when it is not known on reading
+  */
+  template <typename T>
+  void writeArray(const T* aiarrayt_values, const uintidx aiui_size)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+		  "gacheckpoint::Snapshot: type is not trivially copyable");
+    const char *lpc_values = reinterpret_cast<const char*>(aiarrayt_values);
+    this->_vectorc_buffer.insert
+      (this->_vectorc_buffer.end(), lpc_values, lpc_values + aiui_size * sizeof(T));
+  }
+
+  template <typename T>
+  void readArray(T* aoarrayt_values, const uintidx aiui_size)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+		  "gacheckpoint::Snapshot: type is not trivially copyable");
+    this->_readBytes(reinterpret_cast<char*>(aoarrayt_values), aiui_size * sizeof(T));
+  }
+
+  void writeString(const std::string& aistr_value)
+  {
+    this->write(uintidx(aistr_value.size()));
+    this->writeArray(aistr_value.data(), uintidx(aistr_value.size()));
+  }
+
+  std::string readString()
+  {
+    uintidx lui_size;
+    this->read(lui_size);
+    std::string lostr_value(lui_size, '\0');
+    this->_readBytes(&lostr_value[0], lui_size);
+    return lostr_value;
+  }
+
+  /*! \fn void writeRandomEngine()
+    \brief The state of gmt19937_eng of the calling thread
+  */
+  void writeRandomEngine()
+  {
+    std::ostringstream lostrstream_engine;
+    lostrstream_engine << gmt19937_eng;
+    this->writeString(lostrstream_engine.str());
+  }
+
+  void readRandomEngine()
+  {
+    std::istringstream listrstream_engine(this->readString());
+    listrstream_engine >> gmt19937_eng;
+  }
+
+  /*! \fn void writeHeader(const std::string& aistr_algorithm, const int aii_numRun, const uintidx aiui_numInstances, const uintidx aiui_numDimensions)
+    \brief Identify the run and the data set of the snapshot, it is the first thing written
+  */
+  void writeHeader
+  (const std::string& aistr_algorithm,
+   const int          aii_numRun,
+   const uintidx      aiui_numInstances,
+   const uintidx      aiui_numDimensions
+   )
+  {
+    this->_vectorc_buffer.insert
+      (this->_vectorc_buffer.end(),
+       GACHECKPOINT_MAGIC,
+       GACHECKPOINT_MAGIC + std::strlen(GACHECKPOINT_MAGIC));
+    this->write(int(GACHECKPOINT_VERSION));
+    this->writeString(aistr_algorithm);
+    this->write(aii_numRun);
+    this->write(aiui_numInstances);
+    this->write(aiui_numDimensions);
+  }
+
+  /*! \fn bool readHeader(const std::string& aistr_algorithm, const int aii_numRun, const uintidx aiui_numInstances, const uintidx aiui_numDimensions)
+    \brief False when the snapshot belongs to another run of the algorithm, throws std::invalid_argument when it is not a snapshot of the algorithm or of the data set
+  */
+  bool readHeader
+  (const std::string& aistr_algorithm,
+   const int          aii_numRun,
+   const uintidx      aiui_numInstances,
+   const uintidx      aiui_numDimensions
+   )
+  {
+    const size_t lst_lenMagic = std::strlen(GACHECKPOINT_MAGIC);
+    int          li_version;
+    int          li_numRun;
+    uintidx      lui_numInstances;
+    uintidx      lui_numDimensions;
+
+    if ( this->_vectorc_buffer.size() < lst_lenMagic
+	 || std::memcmp(this->_vectorc_buffer.data(), GACHECKPOINT_MAGIC, lst_lenMagic) != 0 )
+      throw std::invalid_argument("gacheckpoint::Snapshot: it is not a checkpoint file");
+    this->_st_posRead = lst_lenMagic;
+    this->read(li_version);
+    if ( li_version != GACHECKPOINT_VERSION )
+      throw std::invalid_argument("gacheckpoint::Snapshot: version of the checkpoint not supported");
+    if ( this->readString() != aistr_algorithm )
+      throw std::invalid_argument("gacheckpoint::Snapshot: checkpoint of another algorithm");
+    this->read(li_numRun);
+    this->read(lui_numInstances);
+    this->read(lui_numDimensions);
+    if ( lui_numInstances != aiui_numInstances || lui_numDimensions != aiui_numDimensions )
+      throw std::invalid_argument("gacheckpoint::Snapshot: checkpoint of another data set");
+
+    return ( li_numRun == aii_numRun );
+  }
+
+  /*! \fn bool save(const std::string& aistr_fileName) const
+    \brief Write the snapshot to a temporary file and rename it, the previous checkpoint remains complete if the write fails
+  */
+  bool save(const std::string& aistr_fileName) const
+  {
+    const std::string lstr_fileNameTmp = aistr_fileName + ".tmp";
+    {
+      std::ofstream lfileout_snapshot
+	(lstr_fileNameTmp.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      if ( !lfileout_snapshot.is_open() )
+	return false;
+      lfileout_snapshot.write
+	(this->_vectorc_buffer.data(), std::streamsize(this->_vectorc_buffer.size()));
+      if ( !lfileout_snapshot.good() )
+	return false;
+    }
+    return ( std::rename(lstr_fileNameTmp.c_str(), aistr_fileName.c_str()) == 0 );
+  }
+
+  void load(const std::string& aistr_fileName)
+  {
+    std::ifstream lfilein_snapshot
+      (aistr_fileName.c_str(), std::ios::in | std::ios::binary);
+    if ( !lfilein_snapshot.is_open() ) {
+      std::string lstr_error("gacheckpoint::Snapshot: could not open file ");
+      lstr_error += aistr_fileName;
+      throw std::invalid_argument(lstr_error);
+    }
+    this->_vectorc_buffer.assign
+      ((std::istreambuf_iterator<char>(lfilein_snapshot)),
+       std::istreambuf_iterator<char>());
+    this->_st_posRead = 0;
+  }
+
+protected:
+
+  void _readBytes(char* aopc_bytes, const size_t aist_numBytes)
+  {
+    if ( this->_st_posRead + aist_numBytes > this->_vectorc_buffer.size() )
+      throw std::runtime_error("gacheckpoint::Snapshot: checkpoint truncated");
+    if ( aist_numBytes > 0 )
+      std::memcpy(aopc_bytes, this->_vectorc_buffer.data() + this->_st_posRead, aist_numBytes);
+    this->_st_posRead += aist_numBytes;
+  }
+
+  std::vector<char> _vectorc_buffer;
+  size_t            _st_posRead;
+
+}; /*Snapshot*/
+
+
+/*! \fn void writeChromosome(Snapshot& aosnapshot, const gaencode::ChromVariableLength<T_GENE,T_METRIC>& aichrom)
+  \brief The genes, objective function, fitness and validity of the chromosome
+*/
+template < typename T_GENE,
+	   typename T_METRIC
+	   >
+void
+writeChromosome
+(Snapshot                                             &aosnapshot,
+ const gaencode::ChromVariableLength<T_GENE,T_METRIC> &aichrom
+ )
+{
+  aosnapshot.write(aichrom.getStringSize());
+  aosnapshot.writeArray(aichrom.getString(), aichrom.getStringSize());
+  aosnapshot.write(aichrom.getObjetiveFunc());
+  aosnapshot.write(aichrom.getFitness());
+  aosnapshot.write(aichrom.getValidString());
+}
+
+template < typename T_GENE,
+	   typename T_METRIC
+	   >
+void
+readChromosome
+(Snapshot                                       &aisnapshot,
+ gaencode::ChromVariableLength<T_GENE,T_METRIC> &aochrom
+ )
+{
+  uintidx  lui_stringSize;
+  T_METRIC lt_objetiveFunc;
+  T_METRIC lt_fitness;
+  bool     lb_validString;
+
+  aisnapshot.read(lui_stringSize);
+  gaencode::ChromVariableLength<T_GENE,T_METRIC> lchrom_read(lui_stringSize);
+  aisnapshot.readArray(lchrom_read.getString(), lui_stringSize);
+  aisnapshot.read(lt_objetiveFunc);
+  aisnapshot.read(lt_fitness);
+  aisnapshot.read(lb_validString);
+  lchrom_read.setObjetiveFunc(lt_objetiveFunc);
+  lchrom_read.setFitness(lt_fitness);
+  lchrom_read.setValidString(lb_validString);
+  aochrom = std::move(lchrom_read);
+}
+
+
+/*! \class CheckpointWriter
+  \brief Write the snapshots on its own thread
+  \details post() returns immediately, if the thread is still writing the previous snapshot only the last one posted is kept. The destructor writes the pending snapshot and joins the thread
+*/
+class CheckpointWriter {
+public:
+  CheckpointWriter(const std::string& aistr_fileName)
+    : _str_fileName(aistr_fileName)
+    , _b_pending(false)
+    , _b_stop(false)
+    , _thread_writer(&CheckpointWriter::_run, this)
+  {}
+
+  ~CheckpointWriter()
+  {
+    {
+      std::lock_guard<std::mutex> llock_writer(this->_mutex_writer);
+      this->_b_stop = true;
+    }
+    this->_condvar_writer.notify_one();
+    this->_thread_writer.join();
+  }
+
+  void post(Snapshot&& aisnapshot)
+  {
+    {
+      std::lock_guard<std::mutex> llock_writer(this->_mutex_writer);
+      this->_snapshot_pending = std::move(aisnapshot);
+      this->_b_pending = true;
+    }
+    this->_condvar_writer.notify_one();
+  }
+
+protected:
+
+  void _run()
+  {
+    std::unique_lock<std::mutex> llock_writer(this->_mutex_writer);
+    while ( 1 ) {
+      this->_condvar_writer.wait
+	(llock_writer,
+	 [&]() { return this->_b_pending || this->_b_stop; }
+	 );
+      if ( !this->_b_pending )
+	break;
+      Snapshot lsnapshot_write(std::move(this->_snapshot_pending));
+      this->_b_pending = false;
+      llock_writer.unlock();
+      if ( !lsnapshot_write.save(this->_str_fileName) )
+	std::cerr << "gacheckpoint: could not write the checkpoint "
+		  << this->_str_fileName << std::endl;
+      llock_writer.lock();
+    }
+  }
+
+  std::string             _str_fileName;
+  Snapshot                _snapshot_pending;
+  bool                    _b_pending;
+  bool                    _b_stop;
+  std::mutex              _mutex_writer;
+  std::condition_variable _condvar_writer;
+  std::thread             _thread_writer;
+
+}; /*CheckpointWriter*/
+
+} /*END namespace gacheckpoint
+   */
+
+#endif /*GA_CHECKPOINT_HPP*/
@@ -0,0 +1,537 @@
+/*! \file ga_island.hpp
+ *
+ * \brief island model of the genetic algorithms
+ *
+ * \details This file is part of the LEAC.\n\n
+ * Several sub-populations of the same algorithm evolve on separate
+ * threads and periodically exchange their best chromosomes.
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef GA_ISLAND_HPP
+#define GA_ISLAND_HPP
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include "random_ext.hpp"
+#include "problem_context.hpp"
+#include "execution_time.hpp"
+#include "inparam_gaclustering.hpp"
+#include "outparam_clustering.hpp"
+#include "common.hpp"
+
+extern thread_local StdMT19937 gmt19937_eng;
+
+/*! \namespace gaisland
+  \brief Island model: sub-populations of an algorithm evolved in parallel with migration
+  \details runIslands runs the algorithm once per island, each one on its own thread with its own random engine. The algorithms call migrate each generation, outside of runIslands the call does nothing, so the algorithms are not changed when they run without islands
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace gaisland {
+
+/*! \class MailboxBase
+  \brief Emigrants of an island in a migration, the type of the chromosome is that of the algorithm
+*/
+class MailboxBase {
+public:
+  MailboxBase(): ui_numMigration(0) {}
+  virtual ~MailboxBase() {}
+
+  uintidx ui_numMigration;
+}; /*MailboxBase*/
+
+template <typename T_CHROMOSOME>
+class Mailbox: public MailboxBase {
+public:
+  std::vector<T_CHROMOSOME> vector_emigrants;
+}; /*Mailbox*/
+
+
+/*! \class IslandModel
+  \brief Barrier and mailboxes shared by the islands
+  \details Each island writes its emigrants in its own mailbox and waits in the barrier until the islands still running arrive, then it reads the mailboxes of its sources. The mailboxes are double buffered by the parity of the migration, so an island that leaves the barrier first does not overwrite the emigrants that the others are still reading. An island that finishes leaves the model with depart(), the others do not wait for it
+*/
+class IslandModel {
+public:
+  IslandModel
+  (const uintidx aiui_numIslands,
+   const uintidx aiui_interval,
+   const uintidx aiui_numElites,
+   const int     aii_opTopology
+   )
+    : _ui_numIslands(aiui_numIslands)
+    , _ui_interval(aiui_interval)
+    , _ui_numElites(aiui_numElites)
+    , _i_opTopology(aii_opTopology)
+    , _ui_numActive(aiui_numIslands)
+    , _ui_numArrived(0)
+    , _ui_phase(0)
+    , _vectorptr_mailbox(2 * aiui_numIslands)
+  {}
+
+  inline uintidx getNumIslands() const
+  {
+    return this->_ui_numIslands;
+  }
+
+  inline uintidx getInterval() const
+  {
+    return this->_ui_interval;
+  }
+
+  inline uintidx getNumElites() const
+  {
+    return this->_ui_numElites;
+  }
+
+  /*! \fn bool isSource(const uintidx aiui_idxIsland, const uintidx aiui_idxSource) const
+    \brief True when the island receives the emigrants of the source, in the ring the source is the previous island
+  */
+  inline bool isSource(const uintidx aiui_idxIsland, const uintidx aiui_idxSource) const
+  {
+    if ( aiui_idxIsland == aiui_idxSource )
+      return false;
+    if ( this->_i_opTopology == INPARAM_MIGRATION_ALL )
+      return true;
+    return ( (aiui_idxSource + 1) % this->_ui_numIslands == aiui_idxIsland );
+  }
+
+  /*! \fn Mailbox<T_CHROMOSOME>& getMailbox(const uintidx aiui_idxIsland, const uintidx aiui_parity)
+    \brief The mailbox of the island, it is created in the first migration. Only the island writes its mailbox
+  */
+  template <typename T_CHROMOSOME>
+  Mailbox<T_CHROMOSOME>& getMailbox(const uintidx aiui_idxIsland, const uintidx aiui_parity)
+  {
+    std::unique_ptr<MailboxBase>& lptr_mailbox =
+      this->_vectorptr_mailbox[2 * aiui_idxIsland + aiui_parity];
+    if ( !lptr_mailbox )
+      lptr_mailbox.reset(new Mailbox<T_CHROMOSOME>());
+    return static_cast<Mailbox<T_CHROMOSOME>&>(*lptr_mailbox);
+  }
+
+  /*! \fn const Mailbox<T_CHROMOSOME>* findMailbox(const uintidx aiui_idxSource, const uintidx aiui_parity, const uintidx aiui_numMigration) const
+    \brief The mailbox of the source if it was written in the migration, otherwise NULL, eg. the source finished before
+  */
+  template <typename T_CHROMOSOME>
+  const Mailbox<T_CHROMOSOME>* findMailbox
+  (const uintidx aiui_idxSource,
+   const uintidx aiui_parity,
+   const uintidx aiui_numMigration
+   ) const
+  {
+    const MailboxBase *lpmailbox_source =
+      this->_vectorptr_mailbox[2 * aiui_idxSource + aiui_parity].get();
+    if ( lpmailbox_source == NULL
+	 || lpmailbox_source->ui_numMigration != aiui_numMigration )
+      return NULL;
+    return static_cast<const Mailbox<T_CHROMOSOME>*>(lpmailbox_source);
+  }
+
+  /*! \fn void wait()
+    \brief Barrier of a migration, returns when all the islands still running have arrived
+  */
+  void wait()
+  {
+    std::unique_lock<std::mutex> llock_barrier(this->_mutex_barrier);
+    const uintidx lui_phase = this->_ui_phase;
+    if ( ++this->_ui_numArrived >= this->_ui_numActive )
+      this->_release();
+    else
+      this->_condvar_barrier.wait
+	(llock_barrier,
+	 [&]() { return lui_phase != this->_ui_phase; }
+	 );
+  }
+
+  /*! \fn void depart()
+    \brief The island finished, it does not take part in the next migrations
+  */
+  void depart()
+  {
+    std::lock_guard<std::mutex> llock_barrier(this->_mutex_barrier);
+    --this->_ui_numActive;
+    if ( this->_ui_numArrived > 0
+	 && this->_ui_numArrived >= this->_ui_numActive )
+      this->_release();
+  }
+
+protected:
+
+  void _release()
+  {
+    this->_ui_numArrived = 0;
+    ++this->_ui_phase;
+    this->_condvar_barrier.notify_all();
+  }
+
+  uintidx                                   _ui_numIslands;
+  uintidx                                   _ui_interval;
+  uintidx                                   _ui_numElites;
+  int                                       _i_opTopology;
+  uintidx                                   _ui_numActive;
+  uintidx                                   _ui_numArrived;
+  uintidx                                   _ui_phase;
+  std::mutex                                _mutex_barrier;
+  std::condition_variable                   _condvar_barrier;
+  std::vector<std::unique_ptr<MailboxBase>> _vectorptr_mailbox;
+
+}; /*IslandModel*/
+
+
+/*! \struct IslandContext
+  \brief Island of the calling thread, pmodel is NULL outside of runIslands
+*/
+struct IslandContext {
+  IslandModel *pmodel;
+  uintidx     ui_idxIsland;
+  uintidx     ui_numMigration;
+};
+
+inline IslandContext& getIslandContext()
+{
+  static thread_local IslandContext ltlcontext_island = {NULL, 0, 0};
+
+  return ltlcontext_island;
+}
+
+/*! \fn bool isMigration(const COMMON_IDOMAIN aiidomain_generation)
+  \brief True when the calling thread is an island and the generation is a multiple of the migration interval
+*/
+inline bool isMigration(const COMMON_IDOMAIN aiidomain_generation)
+{
+  const IslandContext& lcontext_island = getIslandContext();
+
+  return ( lcontext_island.pmodel != NULL
+	   && lcontext_island.pmodel->getInterval() > 0
+	   && aiidomain_generation > 0
+	   && aiidomain_generation % lcontext_island.pmodel->getInterval() == 0 );
+}
+
+/*! \struct FitnessChromosome
+  \brief Default rank of the chromosomes in the migration, the greater the better
+*/
+struct FitnessChromosome {
+  template <typename T_CHROMOSOME>
+  double operator()(const T_CHROMOSOME& aichrom_iter) const
+  {
+    return double(aichrom_iter.getFitness());
+  }
+};
+
+/*! \struct ObjetiveFuncChromosome
+  \brief Rank of the chromosomes by the objective function, when the fitness is not comparable between islands
+*/
+struct ObjetiveFuncChromosome {
+  template <typename T_CHROMOSOME>
+  double operator()(const T_CHROMOSOME& aichrom_iter) const
+  {
+    return double(aichrom_iter.getObjetiveFunc());
+  }
+};
+
+/*! \fn void migrateptr(const std::vector<T_CHROMOSOME*> &aivectorptr_population, FUNCTION_FITNESS aifunc_fitness)
+  \brief Send copies of the best chromosomes to the islands of the topology and replace the worst chromosomes with the immigrants that are better. The elites of the island are not replaced
+  \details The immigrants are taken in the order of the source islands, so with the termination by number of generations the result does not depend on the scheduling of the threads
+*/
+template <typename T_CHROMOSOME,
+	  typename FUNCTION_FITNESS
+	  >
+void migrateptr
+(const std::vector<T_CHROMOSOME*> &aivectorptr_population,
+ FUNCTION_FITNESS                 aifunc_fitness
+ )
+{
+  IslandContext& lcontext_island = getIslandContext();
+  IslandModel&   lislandmodel    = *lcontext_island.pmodel;
+  const uintidx  lui_parity      = lcontext_island.ui_numMigration % 2;
+
+  /*RANK THE POPULATION FROM THE BEST TO THE WORST
+   */
+  std::vector<uintidx> lvectorui_rank(aivectorptr_population.size());
+  std::iota(lvectorui_rank.begin(),lvectorui_rank.end(),0);
+  std::stable_sort
+    (lvectorui_rank.begin(),
+     lvectorui_rank.end(),
+     [&](const uintidx aiui_a, const uintidx aiui_b)
+     {
+       return aifunc_fitness(*aivectorptr_population[aiui_a])
+	 > aifunc_fitness(*aivectorptr_population[aiui_b]);
+     }
+     );
+
+  const uintidx lui_numElites =
+    std::min(lislandmodel.getNumElites(),uintidx(aivectorptr_population.size()));
+
+  Mailbox<T_CHROMOSOME>& lmailbox_out =
+    lislandmodel.template getMailbox<T_CHROMOSOME>
+    (lcontext_island.ui_idxIsland,lui_parity);
+  lmailbox_out.vector_emigrants.clear();
+  for (uintidx lui_i = 0; lui_i < lui_numElites; lui_i++)
+    lmailbox_out.vector_emigrants.push_back
+      (*aivectorptr_population[lvectorui_rank[lui_i]]);
+  lmailbox_out.ui_numMigration = lcontext_island.ui_numMigration;
+
+  lislandmodel.wait();
+
+  std::vector<const T_CHROMOSOME*> lvectorptr_immigrants;
+  for (uintidx lui_s = 0; lui_s < lislandmodel.getNumIslands(); lui_s++) {
+    if ( !lislandmodel.isSource(lcontext_island.ui_idxIsland,lui_s) )
+      continue;
+    const Mailbox<T_CHROMOSOME>* lpmailbox_source =
+      lislandmodel.template findMailbox<T_CHROMOSOME>
+      (lui_s,lui_parity,lcontext_island.ui_numMigration);
+    if ( lpmailbox_source != NULL ) {
+      for ( const auto& lchrom_emigrant: lpmailbox_source->vector_emigrants )
+	lvectorptr_immigrants.push_back(&lchrom_emigrant);
+    }
+  }
+  std::stable_sort
+    (lvectorptr_immigrants.begin(),
+     lvectorptr_immigrants.end(),
+     [&](const T_CHROMOSOME* aiptr_a, const T_CHROMOSOME* aiptr_b)
+     {
+       return aifunc_fitness(*aiptr_a) > aifunc_fitness(*aiptr_b);
+     }
+     );
+
+  /*THE BEST IMMIGRANT AGAINST THE WORST CHROMOSOME, THEN THE NEXT PAIR
+   */
+  uintidx lui_idxWorst = uintidx(aivectorptr_population.size());
+  for ( auto lptr_immigrant: lvectorptr_immigrants ) {
+    if ( lui_idxWorst <= lui_numElites )
+      break;
+    T_CHROMOSOME& lchrom_worst =
+      *aivectorptr_population[lvectorui_rank[lui_idxWorst-1]];
+    if ( !(aifunc_fitness(*lptr_immigrant) > aifunc_fitness(lchrom_worst)) )
+      break;
+    lchrom_worst = *lptr_immigrant;
+    --lui_idxWorst;
+  }
+
+  ++lcontext_island.ui_numMigration;
+}
+
+/*! \fn void migrate(const COMMON_IDOMAIN aiidomain_generation, std::vector<T_CHROMOSOME> &aiovector_population, FUNCTION_FITNESS aifunc_fitness)
+  \brief Migration of the generation, see migrateptr. Nothing is done outside of runIslands or when the generation is not a multiple of the interval
+  \param aiidomain_generation the number of generations completed
+  \param aiovector_population the population evaluated, the immigrants keep their fitness
+  \param aifunc_fitness the rank of a chromosome, the greater the better
+*/
+template <typename T_CHROMOSOME,
+	  typename FUNCTION_FITNESS
+	  >
+void migrate
+(const COMMON_IDOMAIN      aiidomain_generation,
+ std::vector<T_CHROMOSOME> &aiovector_population,
+ FUNCTION_FITNESS          aifunc_fitness
+ )
+{
+  if ( !isMigration(aiidomain_generation) )
+    return;
+
+  std::vector<T_CHROMOSOME*> lvectorptr_population;
+  lvectorptr_population.reserve(aiovector_population.size());
+  for ( auto& lchrom_iter: aiovector_population )
+    lvectorptr_population.push_back(&lchrom_iter);
+
+  migrateptr(lvectorptr_population,aifunc_fitness);
+}
+
+template <typename T_CHROMOSOME,
+	  typename FUNCTION_FITNESS
+	  >
+void migrate
+(const COMMON_IDOMAIN       aiidomain_generation,
+ std::vector<T_CHROMOSOME*> &aiovectorptr_population,
+ FUNCTION_FITNESS           aifunc_fitness
+ )
+{
+  if ( !isMigration(aiidomain_generation) )
+    return;
+
+  migrateptr(aiovectorptr_population,aifunc_fitness);
+}
+
+template <typename T_POPULATION>
+void migrate
+(const COMMON_IDOMAIN aiidomain_generation,
+ T_POPULATION         &aiopopulation
+ )
+{
+  migrate(aiidomain_generation,aiopopulation,FitnessChromosome());
+}
+
+
+/*! \struct FitnessOutParam
+  \brief Default rank of the islands, the fitness of inout::OutParamGAC
+*/
+struct FitnessOutParam {
+  template <typename T_OUTPARAM,
+	    typename T_RESULT
+	    >
+  double operator()(T_OUTPARAM& aiop_outParam, const T_RESULT&) const
+  {
+    return double(aiop_outParam.getFitness());
+  }
+};
+
+/*! \struct ObjetiveFuncResult
+  \brief Rank of the islands by the objective function of their best chromosome
+*/
+struct ObjetiveFuncResult {
+  template <typename T_OUTPARAM,
+	    typename T_RESULT
+	    >
+  double operator()(T_OUTPARAM&, const T_RESULT& aichrom_best) const
+  {
+    return double(aichrom_best.getObjetiveFunc());
+  }
+};
+
+/*! \fn T_RESULT runIslands(T_OUTPARAM &aoop_outParam, T_INPARAM &aiinp_inParam, FUNCTION_ALGORITHM aifunc_algorithm, FUNCTION_FITNESS aifunc_fitness)
+  \brief Run the algorithm in inout::InParamGAClustering::getNumIslands() islands and return the result of the best one
+  \details With one island the algorithm is called directly. Otherwise each island is a thread with the data::ProblemContext of the caller, copies of the parameters and a random engine seeded from the engine of the caller, so a run is repeated with the same seed when the termination is by number of generations. Only the first island writes the plot-stat file. The output parameters are those of the best island, with the execution time of the model and the invalid offspring of all the islands
+  \param aoop_outParam the output parameters of the algorithm
+  \param aiinp_inParam the input parameters, with the options of the islands
+  \param aifunc_algorithm the algorithm, a function (T_OUTPARAM&, T_INPARAM&) that returns the best chromosome
+  \param aifunc_fitness the rank of an island, a function (T_OUTPARAM&, const T_RESULT&), the greater the better
+*/
+template <typename T_OUTPARAM,
+	  typename T_INPARAM,
+	  typename FUNCTION_ALGORITHM,
+	  typename FUNCTION_FITNESS
+	  >
+auto runIslands
+(T_OUTPARAM         &aoop_outParam,
+ T_INPARAM          &aiinp_inParam,
+ FUNCTION_ALGORITHM aifunc_algorithm,
+ FUNCTION_FITNESS   aifunc_fitness
+ )
+  -> typename std::decay<decltype(aifunc_algorithm(aoop_outParam,aiinp_inParam))>::type
+{
+  typedef typename std::decay
+    <decltype(aifunc_algorithm(aoop_outParam,aiinp_inParam))>::type T_RESULT;
+
+  const uintidx lui_numIslands = aiinp_inParam.getNumIslands();
+
+  if ( lui_numIslands <= 1 )
+    return aifunc_algorithm(aoop_outParam,aiinp_inParam);
+
+  runtime::ExecutionTime let_executionTime = runtime::start();
+
+  IslandModel lislandmodel
+    (lui_numIslands,
+     aiinp_inParam.getMigrationInterval(),
+     aiinp_inParam.getMigrationElites(),
+     aiinp_inParam.getOpMigrationTopology()
+     );
+
+  /*ONE SEED PER ISLAND, DRAWN FROM THE ENGINE OF THE CALLER
+   */
+  std::vector<StdMT19937::result_type> lvector_seed(lui_numIslands);
+  for ( auto& lseed_island: lvector_seed )
+    lseed_island = gmt19937_eng();
+
+  std::vector<T_OUTPARAM> lvectorop_outParam(lui_numIslands,aoop_outParam);
+  std::vector<T_INPARAM>  lvectorinp_inParam(lui_numIslands,aiinp_inParam);
+  for (uintidx lui_i = 1; lui_i < lui_numIslands; lui_i++)
+    lvectorinp_inParam[lui_i].setFileNamePlotStatObjetiveFunc(NULL);
+
+  /*THE ISLANDS SOLVE THE PROBLEM OF THE CALLER
+   */
+  data::ProblemContext& lcontext_problem = data::ProblemContext::current();
+
+  std::vector<std::unique_ptr<T_RESULT> > lvectorptr_result(lui_numIslands);
+  std::vector<std::exception_ptr>        lvectorexcept_island(lui_numIslands);
+  std::vector<std::thread>               lvectorthread_island;
+  lvectorthread_island.reserve(lui_numIslands);
+
+  for (uintidx lui_i = 0; lui_i < lui_numIslands; lui_i++) {
+    lvectorthread_island.emplace_back
+      ([&,lui_i]()
+       {
+	 data::ProblemContext::Scope lscope_problem(lcontext_problem);
+	 IslandContext& lcontext_island = getIslandContext();
+	 lcontext_island.pmodel          = &lislandmodel;
+	 lcontext_island.ui_idxIsland    = lui_i;
+	 lcontext_island.ui_numMigration = 0;
+	 gmt19937_eng.seed(lvector_seed[lui_i]);
+	 try {
+	   lvectorptr_result[lui_i].reset
+	     (new T_RESULT
+	      (aifunc_algorithm
+	       (lvectorop_outParam[lui_i],
+		lvectorinp_inParam[lui_i])
+	       )
+	      );
+	 }
+	 catch (...) {
+	   lvectorexcept_island[lui_i] = std::current_exception();
+	 }
+	 lislandmodel.depart();
+	 lcontext_island.pmodel = NULL;
+       }
+       );
+  }
+  for ( auto& lthread_island: lvectorthread_island )
+    lthread_island.join();
+  for ( auto& lexcept_island: lvectorexcept_island ) {
+    if ( lexcept_island )
+      std::rethrow_exception(lexcept_island);
+  }
+
+  uintidx lui_idxBest = 0;
+  long    ll_invalidOffspring = 0;
+  bool    lb_invalidOffspring = false;
+  for (uintidx lui_i = 0; lui_i < lui_numIslands; lui_i++) {
+    if ( aifunc_fitness(lvectorop_outParam[lui_i],*lvectorptr_result[lui_i]) >
+	 aifunc_fitness(lvectorop_outParam[lui_idxBest],*lvectorptr_result[lui_idxBest]) )
+      lui_idxBest = lui_i;
+    if ( lvectorop_outParam[lui_i].getTotalInvalidOffspring()
+	 != OUTPARAMCLUSTERING_INT_NaN ) {
+      ll_invalidOffspring += lvectorop_outParam[lui_i].getTotalInvalidOffspring();
+      lb_invalidOffspring = true;
+    }
+  }
+
+  aoop_outParam = lvectorop_outParam[lui_idxBest];
+  if ( lb_invalidOffspring )
+    aoop_outParam.setTotalInvalidOffspring(ll_invalidOffspring);
+  aoop_outParam.setAlgorithmRunTime(runtime::elapsedTime(let_executionTime));
+
+  return std::move(*lvectorptr_result[lui_idxBest]);
+}
+
+template <typename T_OUTPARAM,
+	  typename T_INPARAM,
+	  typename FUNCTION_ALGORITHM
+	  >
+auto runIslands
+(T_OUTPARAM         &aoop_outParam,
+ T_INPARAM          &aiinp_inParam,
+ FUNCTION_ALGORITHM aifunc_algorithm
+ )
+  -> typename std::decay<decltype(aifunc_algorithm(aoop_outParam,aiinp_inParam))>::type
+{
+  return runIslands
+    (aoop_outParam,aiinp_inParam,aifunc_algorithm,FitnessOutParam());
+}
+
+} /*END namespace gaisland
+   */
+
+#endif  /*GA_ISLAND_HPP*/
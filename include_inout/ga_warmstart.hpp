@@ -0,0 +1,537 @@
+/*! \file ga_warmstart.hpp
+ *
+ * \brief warm start of the genetic algorithms from a saved solution
+ *
+ * \details This file is part of the LEAC.\n\n
+ * The centroids, medoids or membership written by an earlier run
+ * with the options --centroids (-C) or --membership (-M) are read
+ * back to initialize a fraction of the population.
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef GA_WARMSTART_HPP
+#define GA_WARMSTART_HPP
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_set>
+#include "line_split.hpp"
+#include "matrix_read.hpp"
+#include "matrix_triangular.hpp"
+#include "probability_distribution.hpp"
+#include "interface_level1.hpp"
+#include "instance.hpp"
+#include "dist.hpp"
+#include "common.hpp"
+
+extern thread_local StdMT19937 gmt19937_eng;
+
+/*! \namespace gawarmstart
+  \brief Warm start of a genetic algorithm from the solutions saved by an earlier run
+  \details Each line of the file is a solution, the chromosomes selected for the warm start take the solutions in turn, the first time without change and then perturbed, so the population keeps its diversity. The rest of the chromosomes are initialized by the algorithm as usual
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+namespace gawarmstart {
+
+/*GAWARMSTART_LABEL_MEMBERSHIP: the label of the lines written with
+  --membership, the other lines are centroids or medoids
+*/
+#define GAWARMSTART_LABEL_MEMBERSHIP "<MEMBERCLUSTER"
+
+/*GAWARMSTART_MIN_PARALLEL: the labels of fewer instances are
+  assigned by one thread
+ */
+#ifndef GAWARMSTART_MIN_PARALLEL
+#define GAWARMSTART_MIN_PARALLEL 4096
+#endif /*GAWARMSTART_MIN_PARALLEL*/
+
+/*! \fn std::vector<std::string> readLines(const std::string &aistr_fileName)
+  \brief The lines of the file with the centroids or labels of a solution, it skips the lines with other data, eg. the weights <Vi
+*/
+std::vector<std::string>
+readLines(const std::string &aistr_fileName)
+{
+  std::ifstream lifstream_file(aistr_fileName);
+  if ( !lifstream_file ) {
+    throw std::invalid_argument
+      ("gawarmstart::readLines: unable to open file: " + aistr_fileName);
+  }
+
+  std::vector<std::string> lovectorstr_lines;
+  std::string              lstr_line;
+  while ( std::getline(lifstream_file,lstr_line) ) {
+    if ( lstr_line.empty() )
+      continue;
+    if ( lstr_line.compare(0,10,"<CENTROIDS") == 0
+	 || lstr_line.compare(0,8,"<MEDOIDS") == 0
+	 || lstr_line.compare(0,14,GAWARMSTART_LABEL_MEMBERSHIP) == 0
+	 || lstr_line.at(0) != '<' )
+      lovectorstr_lines.push_back(lstr_line);
+  }
+  if ( lovectorstr_lines.empty() ) {
+    throw std::invalid_argument
+      ("gawarmstart::readLines: without centroids or membership in file: " + aistr_fileName);
+  }
+
+  return lovectorstr_lines;
+}
+
+/*! \fn std::vector<long> readLabels(const std::string &aistr_line, const uintidx aiui_numInstances)
+  \brief The cluster of each instance in a line written with --membership
+*/
+std::vector<long>
+readLabels(const std::string &aistr_line, const uintidx aiui_numInstances)
+{
+  inout::LineSplit lls_columns(std::string(","),std::string(""));
+
+  std::string       lstr_lineData =
+    aistr_line.substr(aistr_line.find_last_of('>')+1);
+  const uintidx     lui_numLabels = lls_columns.split(lstr_lineData);
+  if ( lui_numLabels != aiui_numInstances ) {
+    throw std::invalid_argument
+      ("gawarmstart::readLabels: the number of labels is different from the number of instances");
+  }
+
+  std::vector<long> lovectorl_labels(aiui_numInstances);
+  std::istringstream liss_stringstream;
+  for (uintidx lui_i = 0; lui_i < aiui_numInstances; lui_i++) {
+    liss_stringstream.clear();
+    liss_stringstream.str(lls_columns.getItem(lui_i+1));
+    liss_stringstream >> lovectorl_labels[lui_i];
+  }
+
+  return lovectorl_labels;
+}
+
+
+/*! \class WarmStart
+  \brief Centroids of the solutions saved by an earlier run, for the algorithms encoded with centroids or labels
+  \details The centroids of a membership are the means of its clusters. A chromosome with more clusters than the solution takes random instances for the rest, with fewer clusters a random subset of the centroids. The perturbation moves each centroid toward a random instance by a uniform fraction in [0,perturbation]
+
+  \code{.cpp}
+  gawarmstart::WarmStart<T_FEATURE>
+    lwarmstart_population
+    (aiinp_inParamPcPmFk.getFileNameWarmStart(),
+     aiinp_inParamPcPmFk.getFractionWarmStart(),
+     aiinp_inParamPcPmFk.getPerturbationWarmStart(),
+     aiinp_inParamPcPmFk.getSizePopulation(),
+     aiiterator_instfirst,
+     aiiterator_instlast
+     );
+
+  for ( auto& lchromfixleng_iter: lvectorchromfixleng_population ) {
+    ..
+    if ( lwarmstart_population.hasNext() )
+      lwarmstart_population.initialize
+	(lmatrixrowt_centroidsChrom,aiiterator_instfirst,aiiterator_instlast);
+    else
+      clusteringop::randomInitialize
+	(lmatrixrowt_centroidsChrom,aiiterator_instfirst,aiiterator_instlast);
+  }
+  \endcode
+*/
+template < typename T_FEATURE >
+class WarmStart {
+public:
+  /*! \fn WarmStart(const std::string &aistr_fileName, const double aid_fraction, const double aid_perturbation, const uintidx aiui_sizePopulation, const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast)
+    \param aistr_fileName file written with --centroids or --membership, empty without warm start
+    \param aid_fraction fraction of the population initialized from the solutions, at least one chromosome
+    \param aid_perturbation fraction of the distance to a random instance that a centroid can be moved
+    \param aiui_sizePopulation number of chromosomes of the population
+    \param aiiterator_instfirst a input iterator of the instances
+    \param aiiterator_instlast a const input iterator of the instances
+  */
+  template < typename INPUT_ITERATOR >
+  WarmStart
+  (const std::string    &aistr_fileName,
+   const double         aid_fraction,
+   const double         aid_perturbation,
+   const uintidx        aiui_sizePopulation,
+   const INPUT_ITERATOR aiiterator_instfirst,
+   const INPUT_ITERATOR aiiterator_instlast
+   )
+    : _vectormatrixt_centroids()
+    , _d_perturbation(aid_perturbation)
+    , _ui_numChromosomes(0)
+    , _ui_idxNext(0)
+  {
+    if ( aistr_fileName.empty() || !(aid_fraction > 0.0) )
+      return;
+
+    const uintidx lui_numInstances =
+      uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
+    const uintidx lui_numDimensions = data::Instance<T_FEATURE>::getNumDimensions();
+
+    for ( const auto& lstr_line: readLines(aistr_fileName) ) {
+
+      if ( lstr_line.compare(0,14,GAWARMSTART_LABEL_MEMBERSHIP) == 0 ) {
+
+	/*CENTROIDS OF THE CLUSTERS WITH INSTANCES
+	 */
+	const std::vector<long>&& lvectorl_labels =
+	  readLabels(lstr_line,lui_numInstances);
+	const long ll_numClusterK =
+	  1 + *std::max_element(lvectorl_labels.begin(),lvectorl_labels.end());
+	if ( ll_numClusterK <= 0 ) {
+	  throw std::invalid_argument
+	    ("gawarmstart::WarmStart: membership without clusters");
+	}
+	std::vector<double> lvectord_sum((uintidx) ll_numClusterK * lui_numDimensions,0.0);
+	std::vector<uintidx> lvectorui_numInst((uintidx) ll_numClusterK,0);
+	INPUT_ITERATOR literator_inst = aiiterator_instfirst;
+	for (uintidx lui_i = 0; lui_i < lui_numInstances; lui_i++, ++literator_inst) {
+	  const long ll_label = lvectorl_labels[lui_i];
+	  if ( ll_label < 0 )
+	    continue;
+	  const T_FEATURE *larrayt_features = (*literator_inst)->getFeatures();
+	  double *larrayd_sum = &lvectord_sum[(uintidx) ll_label * lui_numDimensions];
+	  for (uintidx lui_l = 0; lui_l < lui_numDimensions; lui_l++)
+	    larrayd_sum[lui_l] += double(larrayt_features[lui_l]);
+	  ++lvectorui_numInst[(uintidx) ll_label];
+	}
+	const uintidx lui_numClusterNotNull = (uintidx)
+	  std::count_if
+	  (lvectorui_numInst.begin(),
+	   lvectorui_numInst.end(),
+	   [](const uintidx aiui_numInst) {return aiui_numInst > 0;}
+	   );
+	mat::MatrixRow<T_FEATURE> lmatrixrowt_centroids(lui_numClusterNotNull,lui_numDimensions);
+	uintidx lui_k = 0;
+	for (uintidx lui_j = 0; lui_j < lvectorui_numInst.size(); lui_j++) {
+	  if ( lvectorui_numInst[lui_j] == 0 )
+	    continue;
+	  T_FEATURE *larrayt_centroid = lmatrixrowt_centroids.getRow(lui_k++);
+	  for (uintidx lui_l = 0; lui_l < lui_numDimensions; lui_l++)
+	    larrayt_centroid[lui_l] = T_FEATURE
+	      (lvectord_sum[lui_j * lui_numDimensions + lui_l] / double(lvectorui_numInst[lui_j]));
+	}
+	this->_vectormatrixt_centroids.push_back(std::move(lmatrixrowt_centroids));
+      }
+      else {
+	mat::MatrixRow<T_FEATURE>&& lmatrixrowt_centroids =
+	  mat::matrixread_get<T_FEATURE>(lstr_line);
+	if ( lmatrixrowt_centroids.getNumColumns() != lui_numDimensions ) {
+	  throw std::invalid_argument
+	    ("gawarmstart::WarmStart: the centroids have a number of columns different from the number of dimensions");
+	}
+	this->_vectormatrixt_centroids.push_back(std::move(lmatrixrowt_centroids));
+      }
+    }
+
+    this->_ui_numChromosomes = numChromosomes(aid_fraction,aiui_sizePopulation);
+  }
+
+  /*! \fn bool hasNext() const
+    \brief There are chromosomes to initialize from the solutions
+  */
+  inline bool hasNext() const
+  {
+    return this->_ui_idxNext < this->_ui_numChromosomes;
+  }
+
+  inline uintidx getNumChromosomes() const
+  {
+    return this->_ui_numChromosomes;
+  }
+
+  /*! \fn void initialize(mat::MatrixBase<T_FEATURE> &aomatrixt_centroids, const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast)
+    \brief Initialize the centroids of the next chromosome
+  */
+  template < typename INPUT_ITERATOR >
+  void initialize
+  (mat::MatrixBase<T_FEATURE> &aomatrixt_centroids,
+   const INPUT_ITERATOR       aiiterator_instfirst,
+   const INPUT_ITERATOR       aiiterator_instlast
+   )
+  {
+    const uintidx lui_numSolutions = (uintidx) this->_vectormatrixt_centroids.size();
+    const mat::MatrixRow<T_FEATURE> &lmatrixrowt_solution =
+      this->_vectormatrixt_centroids[this->_ui_idxNext % lui_numSolutions];
+    const bool lb_perturb = this->_ui_idxNext >= lui_numSolutions;
+    ++this->_ui_idxNext;
+
+    const uintidx lui_numInstances =
+      uintidx(std::distance(aiiterator_instfirst,aiiterator_instlast));
+    const uintidx lui_numDimensions = data::Instance<T_FEATURE>::getNumDimensions();
+    std::uniform_int_distribution<uintidx> luniformdis_uiidxInstances0n
+      (0,lui_numInstances-1);
+
+    /*THE CENTROIDS OF THE SOLUTION, A RANDOM SUBSET WHEN THERE ARE MORE
+     */
+    const uintidx lui_numRows     = aomatrixt_centroids.getNumRows();
+    const uintidx lui_numCopied   = std::min(lui_numRows,lmatrixrowt_solution.getNumRows());
+    std::vector<uintidx> lvectorui_idxRows(lui_numCopied);
+    if ( lui_numCopied < lmatrixrowt_solution.getNumRows() ) {
+      std::uniform_int_distribution<uintidx> luniformdis_uiidxRows0n
+	(0,lmatrixrowt_solution.getNumRows()-1);
+      std::unordered_set<uintidx>&& lunorderedset_idxRows =
+	prob::getWithoutRepeatsSet
+	( lui_numCopied,
+	  [&]() -> uintidx
+	  {
+	    return luniformdis_uiidxRows0n(gmt19937_eng);
+	  }
+	  );
+      std::copy
+	(lunorderedset_idxRows.begin(),lunorderedset_idxRows.end(),lvectorui_idxRows.begin());
+    }
+    else {
+      std::iota(lvectorui_idxRows.begin(),lvectorui_idxRows.end(),0);
+    }
+
+    for (uintidx lui_j = 0; lui_j < lui_numRows; lui_j++) {
+      T_FEATURE *larrayt_centroid = aomatrixt_centroids.getRow(lui_j);
+      const T_FEATURE *larrayt_source =
+	( lui_j < lui_numCopied )?lmatrixrowt_solution.getRow(lvectorui_idxRows[lui_j])
+	:(*std::next(aiiterator_instfirst,luniformdis_uiidxInstances0n(gmt19937_eng)))->getFeatures();
+      interfacesse::copy(larrayt_centroid,larrayt_source,lui_numDimensions);
+
+      if ( lb_perturb && lui_j < lui_numCopied ) {
+	std::uniform_real_distribution<double> luniformdis_perturbation
+	  (0.0,this->_d_perturbation);
+	const double ld_delta = luniformdis_perturbation(gmt19937_eng);
+	const T_FEATURE *larrayt_instance =
+	  (*std::next(aiiterator_instfirst,luniformdis_uiidxInstances0n(gmt19937_eng)))->getFeatures();
+	for (uintidx lui_l = 0; lui_l < lui_numDimensions; lui_l++) {
+	  larrayt_centroid[lui_l] = T_FEATURE
+	    (larrayt_centroid[lui_l]
+	     + ld_delta * (double(larrayt_instance[lui_l]) - double(larrayt_centroid[lui_l])));
+	}
+      }
+    }
+  }
+
+  /*! \fn void initialize(T_CLUSTERIDX *aoarraycidx_memberShip, const T_CLUSTERIDX aicidx_numClusterK, const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist)
+    \brief Initialize the labels of the next chromosome with the nearest of aicidx_numClusterK centroids
+  */
+  template < typename T_CLUSTERIDX,
+	     typename T_DIST,
+	     typename INPUT_ITERATOR
+	     >
+  void initialize
+  (T_CLUSTERIDX                       *aoarraycidx_memberShip,
+   const T_CLUSTERIDX                 aicidx_numClusterK,
+   const INPUT_ITERATOR               aiiterator_instfirst,
+   const INPUT_ITERATOR               aiiterator_instlast,
+   const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist
+   )
+  {
+    mat::MatrixRow<T_FEATURE> lmatrixrowt_centroids
+      ((uintidx) aicidx_numClusterK,data::Instance<T_FEATURE>::getNumDimensions());
+    this->initialize(lmatrixrowt_centroids,aiiterator_instfirst,aiiterator_instlast);
+    nearestLabels
+      (aoarraycidx_memberShip,
+       lmatrixrowt_centroids,
+       aiiterator_instfirst,
+       aiiterator_instlast,
+       aifunc2p_dist
+       );
+  }
+
+  /*! \fn static void nearestLabels(T_CLUSTERIDX *aoarraycidx_memberShip, const mat::MatrixBase<T_FEATURE> &aimatrixt_centroids, const INPUT_ITERATOR aiiterator_instfirst, const INPUT_ITERATOR aiiterator_instlast, const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist)
+    \brief The label of each instance is its nearest centroid
+  */
+  template < typename T_CLUSTERIDX,
+	     typename T_DIST,
+	     typename INPUT_ITERATOR
+	     >
+  static void nearestLabels
+  (T_CLUSTERIDX                       *aoarraycidx_memberShip,
+   const mat::MatrixBase<T_FEATURE>   &aimatrixt_centroids,
+   const INPUT_ITERATOR               aiiterator_instfirst,
+   const INPUT_ITERATOR               aiiterator_instlast,
+   const dist::Dist<T_DIST,T_FEATURE> &aifunc2p_dist
+   )
+  {
+    const long ll_numInstances =
+      (long) std::distance(aiiterator_instfirst,aiiterator_instlast);
+
+#pragma omp parallel for schedule(static) if(ll_numInstances >= GAWARMSTART_MIN_PARALLEL)
+    for ( long ll_i = 0; ll_i < ll_numInstances; ll_i++) {
+      const T_FEATURE *larrayt_instance =
+	(*std::next(aiiterator_instfirst,ll_i))->getFeatures();
+      T_DIST       lrt_distMin   = std::numeric_limits<T_DIST>::max();
+      T_CLUSTERIDX lcidx_nearest = 0;
+      for (uintidx lui_j = 0; lui_j < aimatrixt_centroids.getNumRows(); lui_j++) {
+	const T_DIST lrt_dist =
+	  aifunc2p_dist
+	  (aimatrixt_centroids.getRow(lui_j),
+	   larrayt_instance,
+	   data::Instance<T_FEATURE>::getNumDimensions()
+	   );
+	if ( lrt_dist < lrt_distMin ) {
+	  lrt_distMin   = lrt_dist;
+	  lcidx_nearest = (T_CLUSTERIDX) lui_j;
+	}
+      }
+      aoarraycidx_memberShip[ll_i] = lcidx_nearest;
+    }
+  }
+
+  /*! \fn static uintidx numChromosomes(const double aid_fraction, const uintidx aiui_sizePopulation)
+    \brief Number of chromosomes initialized from the solutions, at least one
+  */
+  static uintidx numChromosomes(const double aid_fraction, const uintidx aiui_sizePopulation)
+  {
+    const uintidx lui_numChromosomes =
+      (uintidx) std::round(aid_fraction * double(aiui_sizePopulation));
+    return std::min(aiui_sizePopulation,std::max(lui_numChromosomes,uintidx(1)));
+  }
+
+protected:
+  std::vector<mat::MatrixRow<T_FEATURE> > _vectormatrixt_centroids;
+  double                                 _d_perturbation;
+  uintidx                                _ui_numChromosomes;
+  uintidx                                _ui_idxNext;
+
+}; /*WarmStart*/
+
+
+/*! \class WarmStartMedoids
+  \brief Medoids of the solutions saved by an earlier run with --membership, for the algorithms encoded with medoids
+  \details The medoid of a cluster is the instance with the smallest sum of dissimilarities to the other instances of the cluster. The saved medoids are features and not instances, so a file written with --centroids is not accepted. The perturbation replaces each medoid by a random instance with probability perturbation
+*/
+template < typename T_REAL >
+class WarmStartMedoids {
+public:
+  WarmStartMedoids
+  (const std::string              &aistr_fileName,
+   const double                   aid_fraction,
+   const double                   aid_perturbation,
+   const uintidx                  aiui_sizePopulation,
+   const mat::MatrixTriang<T_REAL> &aimatrixtriagrt_dissimilarity
+   )
+    : _vectorvectorui_medoids()
+    , _d_perturbation(aid_perturbation)
+    , _ui_numInstances(aimatrixtriagrt_dissimilarity.getNumRows())
+    , _ui_numChromosomes(0)
+    , _ui_idxNext(0)
+  {
+    if ( aistr_fileName.empty() || !(aid_fraction > 0.0) )
+      return;
+
+    for ( const auto& lstr_line: readLines(aistr_fileName) ) {
+      if ( lstr_line.compare(0,14,GAWARMSTART_LABEL_MEMBERSHIP) != 0 ) {
+	throw std::invalid_argument
+	  ("gawarmstart::WarmStartMedoids: the medoids are read from a file written with --membership");
+      }
+      const std::vector<long>&& lvectorl_labels =
+	readLabels(lstr_line,this->_ui_numInstances);
+      const long ll_numClusterK =
+	1 + *std::max_element(lvectorl_labels.begin(),lvectorl_labels.end());
+
+      std::vector<std::vector<uintidx> > lvectorvectorui_clusters
+	((uintidx) std::max(ll_numClusterK,0L));
+      for (uintidx lui_i = 0; lui_i < this->_ui_numInstances; lui_i++) {
+	if ( lvectorl_labels[lui_i] >= 0 )
+	  lvectorvectorui_clusters[(uintidx) lvectorl_labels[lui_i]].push_back(lui_i);
+      }
+      std::vector<uintidx> lvectorui_medoids;
+      for ( const auto& lvectorui_cluster: lvectorvectorui_clusters ) {
+	if ( lvectorui_cluster.empty() )
+	  continue;
+	T_REAL  lrt_sumMin = std::numeric_limits<T_REAL>::max();
+	uintidx lui_medoid = lvectorui_cluster.front();
+	for ( const auto lui_i: lvectorui_cluster ) {
+	  T_REAL lrt_sum = T_REAL(0);
+	  for ( const auto lui_j: lvectorui_cluster )
+	    lrt_sum += aimatrixtriagrt_dissimilarity(lui_i,lui_j);
+	  if ( lrt_sum < lrt_sumMin ) {
+	    lrt_sumMin = lrt_sum;
+	    lui_medoid = lui_i;
+	  }
+	}
+	lvectorui_medoids.push_back(lui_medoid);
+      }
+      if ( lvectorui_medoids.empty() ) {
+	throw std::invalid_argument
+	  ("gawarmstart::WarmStartMedoids: membership without clusters");
+      }
+      this->_vectorvectorui_medoids.push_back(std::move(lvectorui_medoids));
+    }
+
+    this->_ui_numChromosomes =
+      WarmStart<T_REAL>::numChromosomes(aid_fraction,aiui_sizePopulation);
+  }
+
+  inline bool hasNext() const
+  {
+    return this->_ui_idxNext < this->_ui_numChromosomes;
+  }
+
+  /*! \fn void initialize(T_INSTANCEIDX *aoarrayidx_medoids, const uintidx aiui_numClusterK)
+    \brief Initialize the medoids of the next chromosome, different instances
+  */
+  template < typename T_INSTANCEIDX >
+  void initialize(T_INSTANCEIDX *aoarrayidx_medoids, const uintidx aiui_numClusterK)
+  {
+    const uintidx lui_numSolutions = (uintidx) this->_vectorvectorui_medoids.size();
+    std::vector<uintidx> lvectorui_medoids =
+      this->_vectorvectorui_medoids[this->_ui_idxNext % lui_numSolutions];
+    const bool lb_perturb = this->_ui_idxNext >= lui_numSolutions;
+    ++this->_ui_idxNext;
+
+    std::uniform_int_distribution<uintidx> luniformdis_uiidxInstances0n
+      (0,this->_ui_numInstances-1);
+    std::uniform_real_distribution<double> luniformdis_real01(0.0,1.0);
+
+    std::shuffle(lvectorui_medoids.begin(),lvectorui_medoids.end(),gmt19937_eng);
+    if ( lvectorui_medoids.size() > aiui_numClusterK )
+      lvectorui_medoids.resize(aiui_numClusterK);
+    std::unordered_set<uintidx> lunorderedset_medoids
+      (lvectorui_medoids.begin(),lvectorui_medoids.end());
+
+    auto lfunc_newMedoid =
+      [&]() -> uintidx
+      {
+	uintidx lui_idxInstance;
+	do {
+	  lui_idxInstance = luniformdis_uiidxInstances0n(gmt19937_eng);
+	} while ( lunorderedset_medoids.count(lui_idxInstance) > 0 );
+	lunorderedset_medoids.insert(lui_idxInstance);
+	return lui_idxInstance;
+      };
+
+    if ( lb_perturb ) {
+      for ( auto& lui_medoid: lvectorui_medoids ) {
+	if ( luniformdis_real01(gmt19937_eng) < this->_d_perturbation ) {
+	  const uintidx lui_old = lui_medoid;
+	  lui_medoid = lfunc_newMedoid();
+	  lunorderedset_medoids.erase(lui_old);
+	}
+      }
+    }
+    while ( lvectorui_medoids.size() < aiui_numClusterK )
+      lvectorui_medoids.push_back(lfunc_newMedoid());
+
+    std::copy(lvectorui_medoids.begin(),lvectorui_medoids.end(),aoarrayidx_medoids);
+  }
+
+protected:
+  std::vector<std::vector<uintidx> > _vectorvectorui_medoids;
+  double                            _d_perturbation;
+  uintidx                           _ui_numInstances;
+  uintidx                           _ui_numChromosomes;
+  uintidx                           _ui_idxNext;
+
+}; /*WarmStartMedoids*/
+
+} /*END namespace gawarmstart
+   */
+
+#endif /*GA_WARMSTART_HPP*/
@@ -0,0 +1,134 @@
+/*! \file inparam_assignclustering.hpp
+ *
+ * \brief Definition of the program parameters for the assignment of instances to a model
+ *
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef __IN_PARAM_ASSIGNCLUSTERING_HPP
+#define __IN_PARAM_ASSIGNCLUSTERING_HPP
+
+#include "inparam.hpp"
+#include "inparam_readinst.hpp"
+
+#define __INPARAM_ASSIGN_CLUSTERING__
+
+#define INPARAM_ASSIGNCLUSTERING_NUMINSTCHUNK_DEFAULT 65536
+
+/*! \namespace inout
+  \brief Module for input and output parameters
+  \details
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace  inout {
+
+/*! \class InParamAssignClustering
+  \brief Input parameter for the assignment of new instances to the centroids or medoids of a model
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX
+	   >
+class InParamAssignClustering
+  : public InParamAlgorithmo
+  , public InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+{
+public:
+  InParamAssignClustering
+  (std::string        ais_algorithmoName,
+   std::string        ais_algorithmoAuthor,
+   InParam_algTypeOut aiato_algTypeOut)
+    : InParamAlgorithmo(ais_algorithmoName,ais_algorithmoAuthor,aiato_algTypeOut)
+    , InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>()
+    , _str_fileNameModel()
+    , _ui_numRunModel(1)
+    , _str_fileNameStdVar()
+    , _b_printDistance(false)
+    , _ui_numInstChunk(INPARAM_ASSIGNCLUSTERING_NUMINSTCHUNK_DEFAULT)
+  {}
+
+  ~InParamAssignClustering() {}
+
+  inline void setFileNameModel(const char *aips_fileNameModel)
+  {
+    _str_fileNameModel = aips_fileNameModel;
+  }
+
+  inline const std::string& getFileNameModel() const
+  {
+    return _str_fileNameModel;
+  }
+
+  inline void setNumRunModel(uintidx aiui_numRunModel)
+  {
+    _ui_numRunModel = aiui_numRunModel;
+  }
+
+  inline uintidx getNumRunModel() const
+  {
+    return _ui_numRunModel;
+  }
+
+  inline void setFileNameStdVar(const char *aips_fileNameStdVar)
+  {
+    _str_fileNameStdVar = aips_fileNameStdVar;
+  }
+
+  inline const std::string& getFileNameStdVar() const
+  {
+    return _str_fileNameStdVar;
+  }
+
+  inline void setPrintDistance(bool aib_printDistance)
+  {
+    _b_printDistance = aib_printDistance;
+  }
+
+  inline bool getPrintDistance() const
+  {
+    return _b_printDistance;
+  }
+
+  inline void setNumInstChunk(uintidx aiui_numInstChunk)
+  {
+    _ui_numInstChunk = aiui_numInstChunk;
+  }
+
+  inline uintidx getNumInstChunk() const
+  {
+    return _ui_numInstChunk;
+  }
+
+  virtual void  print(std::ostream& aipf_outFile=std::cout, const char aic_separator=',') const
+  {
+    InParamAlgorithmo::print(aipf_outFile,aic_separator);
+    InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>::print(aipf_outFile,aic_separator);
+    aipf_outFile << aic_separator << "_model"
+		 << aic_separator << this->_str_fileNameModel
+		 << aic_separator << "_model run"
+		 << aic_separator << this->_ui_numRunModel;
+    if ( !this->_str_fileNameStdVar.empty() ) {
+      aipf_outFile << aic_separator << "_standardization of variables"
+		   << aic_separator << this->_str_fileNameStdVar;
+    }
+  }
+
+protected:
+
+  std::string  _str_fileNameModel;
+  uintidx      _ui_numRunModel;
+  std::string  _str_fileNameStdVar;
+  bool         _b_printDistance;
+  uintidx      _ui_numInstChunk;
+
+}; /*InParamAssignClustering*/
+
+} /* END namespace inout*/
+
+#endif /*__IN_PARAM_ASSIGNCLUSTERING_HPP*/
@@ -15,6 +15,8 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <limits>
+#include "common.hpp"
 #include "inparam.hpp"
 #include "standardize_variable.hpp"
 
@@ -90,6 +92,10 @@ public:
     ,  ps_fileNamePlotStatObjetiveFunc(NULL)
     , _str_randomSeed()
     , _rd_maxExecutiontime(INPARAMCLUSTERING_MAXEXECUTIONTIME)
+    , _ui_numStagnation(0)
+    , _rd_tolStagnation(0.0)
+    , _rd_targetFitness(std::numeric_limits<double>::max())
+    , _ui_sizeSamplePairwise(0)
     , _b_printCentroidsFormat(false)
     , _b_printTableFormat(false)
   {}
@@ -209,7 +215,7 @@ public:
     return this->i_opDistance;
   }
 
-  inline double getMaxExecutiontime() 
+  inline double getMaxExecutiontime() const
   {
     return _rd_maxExecutiontime;
   }
@@ -219,6 +225,58 @@ public:
     _rd_maxExecutiontime = aird_maxExecutiontime;
   }
 
+  /*! \fn void setNumStagnation(uintidx aiui_numStagnation)
+    \brief Generations without improvement of the best fitness to stop, 0 disable the criterion, see runtime::TerminationCriteria
+  */
+  inline void setNumStagnation(uintidx aiui_numStagnation) 
+  {
+    _ui_numStagnation = aiui_numStagnation;
+  }
+
+  inline uintidx getNumStagnation() const
+  {
+    return _ui_numStagnation;
+  }
+
+  /*! \fn void setTolStagnation(double aird_tolStagnation)
+    \brief Relative improvement of the best fitness below which a generation counts as stagnant
+  */
+  inline void setTolStagnation(double aird_tolStagnation) 
+  {
+    _rd_tolStagnation = aird_tolStagnation;
+  }
+
+  inline double getTolStagnation() const
+  {
+    return _rd_tolStagnation;
+  }
+
+  /*! \fn void setTargetFitness(double aird_targetFitness)
+    \brief The algorithm stops when the best fitness reaches this value
+  */
+  inline void setTargetFitness(double aird_targetFitness) 
+  {
+    _rd_targetFitness = aird_targetFitness;
+  }
+
+  inline double getTargetFitness() const
+  {
+    return _rd_targetFitness;
+  }
+
+  /*! \fn void setSizeSamplePairwise(uintidx aiui_sizeSamplePairwise)
+    \brief Instances sampled to estimate the silhouette and Dunn's index, 0 uses all the instances, see um::ReportPairwise
+  */
+  inline void setSizeSamplePairwise(uintidx aiui_sizeSamplePairwise) 
+  {
+    _ui_sizeSamplePairwise = aiui_sizeSamplePairwise;
+  }
+
+  inline uintidx getSizeSamplePairwise() const
+  {
+    return _ui_sizeSamplePairwise;
+  }
+
   inline bool getPrintCentroidsFormat() 
   {
     return  _b_printCentroidsFormat;
@@ -261,6 +319,20 @@ public:
 		 << aic_separator << this->_str_randomSeed;
     aipf_outFile << aic_separator << "_maximum execution time"
 		 << aic_separator << _rd_maxExecutiontime;
+    if ( _ui_numStagnation > 0 ) {
+      aipf_outFile << aic_separator << "_stagnation generations"
+		   << aic_separator << _ui_numStagnation;
+      aipf_outFile << aic_separator << "_stagnation tolerance"
+		   << aic_separator << _rd_tolStagnation;
+    }
+    if ( _rd_targetFitness != std::numeric_limits<double>::max() ) {
+      aipf_outFile << aic_separator << "_target fitness"
+		   << aic_separator << _rd_targetFitness;
+    }
+    if ( _ui_sizeSamplePairwise > 0 ) {
+      aipf_outFile << aic_separator << "_pairwise sample"
+		   << aic_separator << _ui_sizeSamplePairwise;
+    }
     aipf_outFile << aic_separator << "_print centroids format"
 		 << aic_separator << _b_printCentroidsFormat;
     aipf_outFile << aic_separator << "_print table format"
@@ -279,6 +351,10 @@ protected:
 
   std::string         _str_randomSeed;
   double              _rd_maxExecutiontime;
+  uintidx             _ui_numStagnation;
+  double              _rd_tolStagnation;
+  double              _rd_targetFitness;
+  uintidx             _ui_sizeSamplePairwise;
 
   bool                _b_printCentroidsFormat;
   bool                _b_printTableFormat;
@@ -24,6 +24,28 @@
 */
 
 namespace  inout {
+
+#define INPARAM_MINIBATCH_GROWTH_DEFAULT 1.1
+
+#define INPARAM_MIGRATION_RING              0
+#define INPARAM_MIGRATION_ALL               1
+#define INPARAMCLUSTERING_MIGRATION         {"ring", "all", (char *) NULL }
+#define INPARAM_MIGRATION_INTERVAL_DEFAULT  10
+#define INPARAM_MIGRATION_ELITES_DEFAULT    1
+#define INPARAM_CHECKPOINT_INTERVAL_DEFAULT 10
+
+/*SAME ORDER AS CLUSTERINGOP_SEEDS_RANDOM, CLUSTERINGOP_SEEDS_KMEANSPP
+  AND CLUSTERINGOP_SEEDS_KMEANSPARALLEL, see clusteringop::Seeds
+ */
+#define INPARAM_INITIALIZATION_RANDOM               0
+#define INPARAM_INITIALIZATION_KMEANSPP             1
+#define INPARAM_INITIALIZATION_KMEANSPARALLEL       2
+#define INPARAMCLUSTERING_INITIALIZATION            {"random", "kmeans++", "kmeans||", (char *) NULL }
+#define INPARAM_INITIALIZATION_ROUNDS_DEFAULT       5
+#define INPARAM_INITIALIZATION_OVERSAMPLING_DEFAULT 2.0
+
+#define INPARAM_WARMSTART_FRACTION_DEFAULT      0.2
+#define INPARAM_WARMSTART_PERTURBATION_DEFAULT  0.1
   
 /*! \class InParamGAClustering
   \brief Input parameter for genetic algorithm 
@@ -38,7 +60,23 @@ public:
    InParam_algTypeOut aiato_algTypeOut,
    int                aii_opNorm):
     InParamClustering
-    (ais_algorithmoName,ais_algorithmoAuthor,aiato_algTypeOut,aii_opNorm) {}
+    (ais_algorithmoName,ais_algorithmoAuthor,aiato_algTypeOut,aii_opNorm)
+    , _ui_sizeMiniBatch(0)
+    , _d_growthMiniBatch(INPARAM_MINIBATCH_GROWTH_DEFAULT)
+    , _ui_numIslands(1)
+    , _ui_migrationInterval(INPARAM_MIGRATION_INTERVAL_DEFAULT)
+    , _ui_migrationElites(INPARAM_MIGRATION_ELITES_DEFAULT)
+    , _i_opMigrationTopology(INPARAM_MIGRATION_RING)
+    , _str_fileNameCheckpoint()
+    , _ui_checkpointInterval(INPARAM_CHECKPOINT_INTERVAL_DEFAULT)
+    , _str_fileNameResume()
+    , _i_opInitialization(INPARAM_INITIALIZATION_RANDOM)
+    , _ui_roundsInitialization(INPARAM_INITIALIZATION_ROUNDS_DEFAULT)
+    , _d_oversamplingInitialization(INPARAM_INITIALIZATION_OVERSAMPLING_DEFAULT)
+    , _str_fileNameWarmStart()
+    , _d_fractionWarmStart(INPARAM_WARMSTART_FRACTION_DEFAULT)
+    , _d_perturbationWarmStart(INPARAM_WARMSTART_PERTURBATION_DEFAULT)
+  {}
  
   ~InParamGAClustering() {}
 
@@ -62,6 +100,195 @@ public:
     return this->st_sizePopulation;
   }
 
+  /*! \fn void setSizeMiniBatch(uintidx aiui_sizeMiniBatch)
+    \brief Size of the sample used to estimate the fitness in the first generation, 0 the fitness is computed on all the instances, see minibatch::StratifiedSample
+  */
+  inline void setSizeMiniBatch(uintidx aiui_sizeMiniBatch)
+  {
+    this->_ui_sizeMiniBatch = aiui_sizeMiniBatch;
+  }
+
+  inline uintidx getSizeMiniBatch() const
+  {
+    return this->_ui_sizeMiniBatch;
+  }
+
+  inline void setGrowthMiniBatch(double aid_growthMiniBatch)
+  {
+    this->_d_growthMiniBatch = aid_growthMiniBatch;
+  }
+
+  inline double getGrowthMiniBatch() const
+  {
+    return this->_d_growthMiniBatch;
+  }
+
+  /*! \fn void setNumIslands(uintidx aiui_numIslands)
+    \brief Number of sub-populations evolved in parallel, one per thread, 1 runs the algorithm without islands, see gaisland::runIslands
+  */
+  inline void setNumIslands(uintidx aiui_numIslands)
+  {
+    this->_ui_numIslands = aiui_numIslands;
+  }
+
+  inline uintidx getNumIslands() const
+  {
+    return this->_ui_numIslands;
+  }
+
+  /*! \fn void setMigrationInterval(uintidx aiui_migrationInterval)
+    \brief Number of generations between migrations, 0 the islands never exchange chromosomes
+  */
+  inline void setMigrationInterval(uintidx aiui_migrationInterval)
+  {
+    this->_ui_migrationInterval = aiui_migrationInterval;
+  }
+
+  inline uintidx getMigrationInterval() const
+  {
+    return this->_ui_migrationInterval;
+  }
+
+  /*! \fn void setMigrationElites(uintidx aiui_migrationElites)
+    \brief Number of the best chromosomes that each island sends in a migration
+  */
+  inline void setMigrationElites(uintidx aiui_migrationElites)
+  {
+    this->_ui_migrationElites = aiui_migrationElites;
+  }
+
+  inline uintidx getMigrationElites() const
+  {
+    return this->_ui_migrationElites;
+  }
+
+  /*! \fn void setOpMigrationTopology(int aii_opMigrationTopology)
+    \brief Islands that receive the emigrants, INPARAM_MIGRATION_RING the next island, INPARAM_MIGRATION_ALL all the islands
+  */
+  inline void setOpMigrationTopology(int aii_opMigrationTopology)
+  {
+    this->_i_opMigrationTopology = aii_opMigrationTopology;
+  }
+
+  inline int getOpMigrationTopology() const
+  {
+    return this->_i_opMigrationTopology;
+  }
+
+  /*! \fn void setFileNameCheckpoint(const std::string& aistr_fileNameCheckpoint)
+    \brief File where the state of the algorithm is written every getCheckpointInterval() generations, empty does not write checkpoints, see gacheckpoint::CheckpointWriter
+  */
+  inline void setFileNameCheckpoint(const std::string& aistr_fileNameCheckpoint)
+  {
+    this->_str_fileNameCheckpoint = aistr_fileNameCheckpoint;
+  }
+
+  inline const std::string& getFileNameCheckpoint() const
+  {
+    return this->_str_fileNameCheckpoint;
+  }
+
+  inline void setCheckpointInterval(uintidx aiui_checkpointInterval)
+  {
+    this->_ui_checkpointInterval = aiui_checkpointInterval;
+  }
+
+  inline uintidx getCheckpointInterval() const
+  {
+    return this->_ui_checkpointInterval;
+  }
+
+  /*! \fn void setFileNameResume(const std::string& aistr_fileNameResume)
+    \brief Checkpoint from which the run continues, empty starts the run from the first generation
+  */
+  inline void setFileNameResume(const std::string& aistr_fileNameResume)
+  {
+    this->_str_fileNameResume = aistr_fileNameResume;
+  }
+
+  inline const std::string& getFileNameResume() const
+  {
+    return this->_str_fileNameResume;
+  }
+
+  /*! \fn void setOpInitialization(int aii_opInitialization)
+    \brief Selection of the instances that initialize the chromosomes, INPARAM_INITIALIZATION_RANDOM, INPARAM_INITIALIZATION_KMEANSPP or INPARAM_INITIALIZATION_KMEANSPARALLEL, see clusteringop::Seeds
+  */
+  inline void setOpInitialization(int aii_opInitialization)
+  {
+    this->_i_opInitialization = aii_opInitialization;
+  }
+
+  inline int getOpInitialization() const
+  {
+    return this->_i_opInitialization;
+  }
+
+  /*! \fn void setRoundsInitialization(uintidx aiui_roundsInitialization)
+    \brief Rounds of sampling of k-means||
+  */
+  inline void setRoundsInitialization(uintidx aiui_roundsInitialization)
+  {
+    this->_ui_roundsInitialization = aiui_roundsInitialization;
+  }
+
+  inline uintidx getRoundsInitialization() const
+  {
+    return this->_ui_roundsInitialization;
+  }
+
+  /*! \fn void setOversamplingInitialization(double aid_oversamplingInitialization)
+    \brief Candidates sampled by each round of k-means|| per cluster
+  */
+  inline void setOversamplingInitialization(double aid_oversamplingInitialization)
+  {
+    this->_d_oversamplingInitialization = aid_oversamplingInitialization;
+  }
+
+  inline double getOversamplingInitialization() const
+  {
+    return this->_d_oversamplingInitialization;
+  }
+
+  /*! \fn void setFileNameWarmStart(const std::string &aistr_fileNameWarmStart)
+    \brief File with the centroids or membership written by an earlier run, see gawarmstart::WarmStart
+  */
+  inline void setFileNameWarmStart(const std::string &aistr_fileNameWarmStart)
+  {
+    this->_str_fileNameWarmStart = aistr_fileNameWarmStart;
+  }
+
+  inline const std::string& getFileNameWarmStart() const
+  {
+    return this->_str_fileNameWarmStart;
+  }
+
+  /*! \fn void setFractionWarmStart(double aid_fractionWarmStart)
+    \brief Fraction of the population initialized from the saved solutions
+  */
+  inline void setFractionWarmStart(double aid_fractionWarmStart)
+  {
+    this->_d_fractionWarmStart = aid_fractionWarmStart;
+  }
+
+  inline double getFractionWarmStart() const
+  {
+    return this->_d_fractionWarmStart;
+  }
+
+  /*! \fn void setPerturbationWarmStart(double aid_perturbationWarmStart)
+    \brief Perturbation of the copies of a saved solution after the first
+  */
+  inline void setPerturbationWarmStart(double aid_perturbationWarmStart)
+  {
+    this->_d_perturbationWarmStart = aid_perturbationWarmStart;
+  }
+
+  inline double getPerturbationWarmStart() const
+  {
+    return this->_d_perturbationWarmStart;
+  }
+
   virtual void print(std::ostream&  aipf_outFile=std::cout, const char aic_separator=',') const
   {
     InParamClustering::print(aipf_outFile,aic_separator);
@@ -69,10 +296,71 @@ public:
 		 << aic_separator << this->st_sizePopulation;
     aipf_outFile << aic_separator << "_number maximum generations" 
 		 << aic_separator << this->t_numMaxGenerations;
+    if ( this->_ui_sizeMiniBatch > 0 ) {
+      aipf_outFile << aic_separator << "_minibatch size"
+		   << aic_separator << this->_ui_sizeMiniBatch;
+      aipf_outFile << aic_separator << "_minibatch growth"
+		   << aic_separator << this->_d_growthMiniBatch;
+    }
+    if ( this->_ui_numIslands > 1 ) {
+      const char *las_opMigrationTopology[] = INPARAMCLUSTERING_MIGRATION;
+      aipf_outFile << aic_separator << "_number islands"
+		   << aic_separator << this->_ui_numIslands;
+      aipf_outFile << aic_separator << "_migration interval"
+		   << aic_separator << this->_ui_migrationInterval;
+      aipf_outFile << aic_separator << "_migration elites"
+		   << aic_separator << this->_ui_migrationElites;
+      aipf_outFile << aic_separator << "_migration topology"
+		   << aic_separator << las_opMigrationTopology[this->_i_opMigrationTopology];
+    }
+    if ( !this->_str_fileNameCheckpoint.empty() ) {
+      aipf_outFile << aic_separator << "_checkpoint"
+		   << aic_separator << this->_str_fileNameCheckpoint;
+      aipf_outFile << aic_separator << "_checkpoint interval"
+		   << aic_separator << this->_ui_checkpointInterval;
+    }
+    if ( !this->_str_fileNameResume.empty() ) {
+      aipf_outFile << aic_separator << "_resume"
+		   << aic_separator << this->_str_fileNameResume;
+    }
+    if ( this->_i_opInitialization != INPARAM_INITIALIZATION_RANDOM ) {
+      const char *las_opInitialization[] = INPARAMCLUSTERING_INITIALIZATION;
+      aipf_outFile << aic_separator << "_initialization"
+		   << aic_separator << las_opInitialization[this->_i_opInitialization];
+    }
+    if ( this->_i_opInitialization == INPARAM_INITIALIZATION_KMEANSPARALLEL ) {
+      aipf_outFile << aic_separator << "_initialization rounds"
+		   << aic_separator << this->_ui_roundsInitialization;
+      aipf_outFile << aic_separator << "_initialization oversampling"
+		   << aic_separator << this->_d_oversamplingInitialization;
+    }
+    if ( !this->_str_fileNameWarmStart.empty() ) {
+      aipf_outFile << aic_separator << "_warm start"
+		   << aic_separator << this->_str_fileNameWarmStart;
+      aipf_outFile << aic_separator << "_warm start fraction"
+		   << aic_separator << this->_d_fractionWarmStart;
+      aipf_outFile << aic_separator << "_warm start perturbation"
+		   << aic_separator << this->_d_perturbationWarmStart;
+    }
   }
 protected:
   uintidx          st_sizePopulation;
   COMMON_IDOMAIN t_numMaxGenerations;
+  uintidx          _ui_sizeMiniBatch;
+  double           _d_growthMiniBatch;
+  uintidx          _ui_numIslands;
+  uintidx          _ui_migrationInterval;
+  uintidx          _ui_migrationElites;
+  int              _i_opMigrationTopology;
+  std::string      _str_fileNameCheckpoint;
+  uintidx          _ui_checkpointInterval;
+  std::string      _str_fileNameResume;
+  int              _i_opInitialization;
+  uintidx          _ui_roundsInitialization;
+  double           _d_oversamplingInitialization;
+  std::string      _str_fileNameWarmStart;
+  double           _d_fractionWarmStart;
+  double           _d_perturbationWarmStart;
 }; 
 
 
@@ -373,8 +373,16 @@ protected:
 
 }; /*InParamReadInst*/
 
+#define INPARAM_CORESET_NONE      0
+#define INPARAM_CORESET_DEDUP     1
+#define INPARAM_CORESET_GRID      2
+#define INPARAM_CORESET_SAMPLING  3
+#define INPARAMCLUSTERING_CORESET {"none", "dedup", "grid", "sampling", (char *) NULL }
+#define INPARAM_CORESET_SIZE_DEFAULT 20000
+
 /*! \class InParamReadInstFreq
   \brief Input parameter for read instances with frequency
+  \details The data set can be compressed in a coreset of instances with frequency, see coreset.hpp
 */
 template <typename T_FEATURE,         
 	  typename T_INSTANCES_CLUSTER_K,
@@ -386,7 +394,10 @@ class InParamReadInstFreq
 public:
   InParamReadInstFreq()
     : InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>()
+    , _i_opCoreset(INPARAM_CORESET_NONE)
+    , _ui_sizeCoreset(INPARAM_CORESET_SIZE_DEFAULT)
   {}
+
   InParamReadInstFreq
   (const char *aips_fileNameInstance,
    EnumFormatInstanceFile aienum_formatInstanceFile,
@@ -401,8 +412,49 @@ public:
      aips_selectAttributes,
      aib_haveHeaderFile
      )
+    , _i_opCoreset(INPARAM_CORESET_NONE)
+    , _ui_sizeCoreset(INPARAM_CORESET_SIZE_DEFAULT)
   {}
-};
+
+  inline void setOpCoreset(int aii_opCoreset)
+  {
+    this->_i_opCoreset = aii_opCoreset;
+  }
+
+  inline const int getOpCoreset() const
+  {
+    return this->_i_opCoreset;
+  }
+
+  inline void setSizeCoreset(uintidx aiui_sizeCoreset)
+  {
+    this->_ui_sizeCoreset = aiui_sizeCoreset;
+  }
+
+  inline const uintidx getSizeCoreset() const
+  {
+    return this->_ui_sizeCoreset;
+  }
+
+  virtual void print(std::ostream&  aipf_outFile=std::cout, const char aic_separator=',') const
+  {
+    const char  *las_opCoreset[] = INPARAMCLUSTERING_CORESET;
+
+    InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>::print(aipf_outFile,aic_separator);
+    if ( this->_i_opCoreset != INPARAM_CORESET_NONE ) {
+      aipf_outFile << aic_separator << "_coreset"
+		   << aic_separator << las_opCoreset[this->_i_opCoreset];
+      aipf_outFile << aic_separator << "_coreset size"
+		   << aic_separator << this->_ui_sizeCoreset;
+    }
+  }
+
+protected:
+
+  int          _i_opCoreset;
+  uintidx      _ui_sizeCoreset;
+
+}; /*InParamReadInstFreq*/
 
 } /*END namespace inout 
    */
@@ -48,6 +48,7 @@ public:
     : InParamAlgorithmo(ais_algorithmoName,ais_algorithmoAuthor,aiato_algTypeOut)
     , InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>()
     , _i_standardizationVar(STD_VAR_Z0)
+    , _str_outFileStdVar()
   {}
 
   ~InParamStdVar() {}
@@ -61,6 +62,16 @@ public:
   { 
     return _i_standardizationVar;
   }
+
+  inline void setOutFileStdVar(const char *aips_outFileStdVar)
+  {
+    _str_outFileStdVar = aips_outFileStdVar;
+  }
+
+  inline const std::string& getOutFileStdVar() const
+  {
+    return _str_outFileStdVar;
+  }
   
   virtual void  print(std::ostream& aipf_outFile=std::cout, const char aic_separator=',') const
   {
@@ -78,6 +89,7 @@ public:
 protected:
 
   int          _i_standardizationVar;
+  std::string  _str_outFileStdVar;
   
 }; /*InParamStdVar*/
 
@@ -35,6 +35,11 @@ extern char  *optarg;
 */
 namespace  inout {
 
+/*! When it is true the usage message ends with an exception instead of
+  ending the process, see clusteringworker::runMain
+ */
+bool gbinparam_throwUsage = false;
+
 /*---< inparam_usageClustering>------------------------------------------------------------*/
 
 #ifdef __INPARAM_KMEANS__  
@@ -103,6 +108,18 @@ template < typename T_FEATURE,
    InParamStdVar<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>   &aoipc_inParamClustering
    )
 #endif /* __INPARAM_STDVAR_MILLIGAN_COOPER1988__ */
+
+#ifdef  __INPARAM_ASSIGN_CLUSTERING__
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX
+	   >
+  void
+  inparamclustering_usage
+  (char            *argv0, 
+   InParamAssignClustering<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>   &aoipc_inParamClustering
+   )
+#endif /* __INPARAM_ASSIGN_CLUSTERING__ */
   
 #ifdef  __INPARAM_PLOT_CLUSTERING__ 
 template < typename T_FEATURE,
@@ -585,6 +602,112 @@ template<typename T_CLUSTERIDX,
   std::cout << "  -f, --freq-instances-column[=NUMBER]\n"
 	    << "                              the input file instance is assigned a column\n"
 	    << "                                frequency instances [NUMBER=undefined]\n";
+
+#ifdef __INSTANCES_WITH_FREQUENCY
+  {
+    const char   *las_opCoresetType[] = INPARAMCLUSTERING_CORESET;
+    std::cout << "      --coreset[=NAME]        compress the instances in a coreset with\n"
+	      << "                                frequency: ";
+    li_i = 0;
+    while (las_opCoresetType[li_i+1] !=  NULL) {
+      std::cout << las_opCoresetType[li_i] << ", ";
+      ++li_i;
+    } 
+    std::cout << "or " 
+	      << las_opCoresetType[li_i] << ",\n                                by default " 
+	      << las_opCoresetType[aoipc_inParamClustering.getOpCoreset()]
+	      << '\n';
+    std::cout << "      --coreset-size[=NUMBER] maximum number of instances of the coreset\n"
+	      << "                                [NUMBER="
+	      << aoipc_inParamClustering.getSizeCoreset()
+	      << "]\n";
+  }
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+#if defined(__INPARAM_MINIBATCH__) && !defined(__INSTANCES_MMAP)
+  std::cout << "      --minibatch-size[=NUMBER]\n"
+	    << "                              estimate the fitness on a stratified sample\n"
+	    << "                                of NUMBER instances, a new sample is drawn\n"
+	    << "                                each generation. 0 uses all the instances\n"
+	    << "                                [NUMBER="
+	    << aoipc_inParamClustering.getSizeMiniBatch()
+	    << "]\n";
+  std::cout << "      --minibatch-growth[=NUMBER]\n"
+	    << "                              factor that increases the size of the sample\n"
+	    << "                                each generation [NUMBER="
+	    << aoipc_inParamClustering.getGrowthMiniBatch()
+	    << "]\n";
+#endif /*__INPARAM_MINIBATCH__*/
+#ifdef __INPARAM_ISLANDS__
+  {
+    const char   *las_opMigrationTopology[] = INPARAMCLUSTERING_MIGRATION;
+    std::cout << "      --islands[=NUMBER]      number of sub-populations evolved in parallel,\n"
+	      << "                                one thread per island [NUMBER="
+	      << aoipc_inParamClustering.getNumIslands()
+	      << "]\n";
+    std::cout << "      --migration-interval[=NUMBER]\n"
+	      << "                              generations between migrations [NUMBER="
+	      << aoipc_inParamClustering.getMigrationInterval()
+	      << "]\n";
+    std::cout << "      --migration-elites[=NUMBER]\n"
+	      << "                              best chromosomes sent by each island [NUMBER="
+	      << aoipc_inParamClustering.getMigrationElites()
+	      << "]\n";
+    std::cout << "      --migration-topology[=METHOD]\n"
+	      << "                              METHOD: "
+	      << las_opMigrationTopology[INPARAM_MIGRATION_RING] << ", "
+	      << las_opMigrationTopology[INPARAM_MIGRATION_ALL]
+	      << ", by default "
+	      << las_opMigrationTopology[aoipc_inParamClustering.getOpMigrationTopology()]
+	      << '\n';
+  }
+#endif /*__INPARAM_ISLANDS__*/
+#ifdef __INPARAM_CHECKPOINT__
+  std::cout << "      --checkpoint=[FILE]     file where the state of the algorithm is written\n"
+	    << "                                in the background\n";
+  std::cout << "      --checkpoint-interval[=NUMBER]\n"
+	    << "                              generations between checkpoints [NUMBER="
+	    << aoipc_inParamClustering.getCheckpointInterval()
+	    << "]\n";
+  std::cout << "      --resume=[FILE]         continue the run from a checkpoint\n";
+#endif /*__INPARAM_CHECKPOINT__*/
+#ifdef __INPARAM_INITIALIZATION__
+  {
+    const char   *las_opInitialization[] = INPARAMCLUSTERING_INITIALIZATION;
+    std::cout << "      --initialization[=METHOD]\n"
+	      << "                              instances that initialize the population,\n"
+	      << "                                METHOD: "
+	      << las_opInitialization[INPARAM_INITIALIZATION_RANDOM] << ", "
+	      << las_opInitialization[INPARAM_INITIALIZATION_KMEANSPP] << " or "
+	      << las_opInitialization[INPARAM_INITIALIZATION_KMEANSPARALLEL]
+	      << ", by default "
+	      << las_opInitialization[aoipc_inParamClustering.getOpInitialization()]
+	      << '\n';
+    std::cout << "      --initialization-rounds[=NUMBER]\n"
+	      << "                              rounds of sampling of kmeans|| [NUMBER="
+	      << aoipc_inParamClustering.getRoundsInitialization()
+	      << "]\n";
+    std::cout << "      --initialization-oversampling[=NUMBER]\n"
+	      << "                              candidates sampled by each round of kmeans||\n"
+	      << "                                per cluster [NUMBER="
+	      << aoipc_inParamClustering.getOversamplingInitialization()
+	      << "]\n";
+  }
+#endif /*__INPARAM_INITIALIZATION__*/
+#ifdef __INPARAM_WARMSTART__
+  std::cout << "      --warm-start=FILE       initialize part of the population with the\n"
+	    << "                                centroids or membership written by an\n"
+	    << "                                earlier run with -C or -M\n";
+  std::cout << "      --warm-start-fraction[=NUMBER]\n"
+	    << "                              fraction of the population initialized\n"
+	    << "                                from FILE [NUMBER="
+	    << aoipc_inParamClustering.getFractionWarmStart()
+	    << "]\n";
+  std::cout << "      --warm-start-perturbation[=NUMBER]\n"
+	    << "                              perturbation of the repeated solutions\n"
+	    << "                                in [0,1] [NUMBER="
+	    << aoipc_inParamClustering.getPerturbationWarmStart()
+	    << "]\n";
+#endif /*__INPARAM_WARMSTART__*/
   std::cout << "  -r, --number-runs[=NUMBER]  number of runs or repetitions of the algorithm\n"
 	    << "                                (by default [NUMBER=1])\n";
   std::cout << "  -R, --runtime-filename=[FILE]\n"
@@ -622,6 +745,25 @@ template<typename T_CLUSTERIDX,
 	    << "                                by default is "
 	    << aoipc_inParamClustering.getMaxExecutiontime()
 	    << "\n";
+  std::cout << "      --stagnation[=NUMBER]   stop after NUMBER generations without\n"
+	    << "                                improvement of the best fitness, 0 disable\n"
+	    << "                                [NUMBER="
+	    << aoipc_inParamClustering.getNumStagnation()
+	    << "]\n";
+  std::cout << "      --stagnation-tolerance[=NUMBER]\n"
+	    << "                              relative improvement of the best fitness\n"
+	    << "                                that is counted as stagnation [NUMBER="
+	    << aoipc_inParamClustering.getTolStagnation()
+	    << "]\n";
+  std::cout << "      --target-fitness[=NUMBER]\n"
+	    << "                              stop when the best fitness reaches NUMBER,\n"
+	    << "                                by default disabled\n";
+  std::cout << "      --pairwise-sample[=NUMBER]\n"
+	    << "                              estimate the silhouette and Dunn's index of\n"
+	    << "                                the solution with NUMBER random instances,\n"
+	    << "                                0 uses all the instances [NUMBER="
+	    << aoipc_inParamClustering.getSizeSamplePairwise()
+	    << "]\n";
 
   std::cout << "  --print-mulline[=yes/no]\n"
 	    << "                              metrics to print on multiple lines\n"
@@ -809,7 +951,30 @@ template<typename T_CLUSTERIDX,
 	    << "                                Z2, Z3, Z4, Z5, Z6, Z7 [ARG=" 
 	    << las_opStdVarName[aoipc_inParamClustering.getStandardizationVar()] 
 	    << "]\n";
+  std::cout << "      --std-var-outfile=FILE  write the location and scale of each variable\n"
+	    << "                                to standardize other instances, see\n"
+	    << "                                assign_clustering\n";
 #endif /*__INPARAM_STDVAR_MILLIGAN_COOPER1988__*/
+
+#ifdef __INPARAM_ASSIGN_CLUSTERING__
+  std::cout << "      --model-infile=FILE     centroids or medoids written with -C by\n"
+	    << "                                a clustering algorithm\n";
+  std::cout << "      --model-run[=NUMBER]    run of FILE with several runs [NUMBER="
+	    << aoipc_inParamClustering.getNumRunModel()
+	    << "]\n";
+  std::cout << "      --std-var-infile=FILE   standardize the instances with the location\n"
+	    << "                                and scale written with --std-var-outfile\n";
+  std::cout << "      --print-distance=[yes/no]\n"
+	    << "                              print the distance to the nearest centroid,\n"
+	    << "                                by default is "
+	    << las_optTokensYesNo[aoipc_inParamClustering.getPrintDistance()]
+	    << '\n';
+  std::cout << "      --chunk-instances[=NUMBER]\n"
+	    << "                              instances read and assigned at a time\n"
+	    << "                                [NUMBER="
+	    << aoipc_inParamClustering.getNumInstChunk()
+	    << "]\n";
+#endif /*__INPARAM_ASSIGN_CLUSTERING__*/
   
 #ifdef  __INPARAM_KMEANS__
   std::cout << "      --number-clusters[=NUMBER]\n"
@@ -1409,6 +1574,9 @@ template<typename T_CLUSTERIDX,
 
   std::cout << "  -?, --help                  help";
   std::cout <<  std::endl;
+
+  if ( gbinparam_throwUsage )
+    throw std::invalid_argument("inparamclustering_usage: invalid parameters");
   
   exit(-1);
 }
@@ -1426,6 +1594,19 @@ inparamclustering_getParameter
  char                **argv
  )
 #endif /* __INPARAM_STDVAR_MILLIGAN_COOPER1988__ */
+
+#ifdef  __INPARAM_ASSIGN_CLUSTERING__ 
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX
+	   >
+void 
+inparamclustering_getParameter
+(InParamAssignClustering<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aoipc_inParamClustering,
+ int                 argc, 
+ char                **argv
+ )
+#endif /* __INPARAM_ASSIGN_CLUSTERING__ */
   
 
 #ifdef  __INPARAM_PCA__
@@ -1958,8 +2139,19 @@ inparamclustering_getParameter
 
 #ifdef  __INPARAM_STDVAR_MILLIGAN_COOPER1988__
   const char   *las_optStanVar[] =  STD_VAR_NAME;
-  const char   *las_optStandardizationVar[] =  {"std-var", (char *) NULL };
+  const char   *las_optStandardizationVar[] =  {"std-var", "std-var-outfile", (char *) NULL };
 #endif /* __INPARAM_STDVAR_MILLIGAN_COOPER1988__ */
+
+#ifdef  __INPARAM_ASSIGN_CLUSTERING__
+  const char   *las_optAssignClustering[] =
+    {"model-infile",      //0
+     "model-run",         //1
+     "std-var-infile",    //2
+     "print-distance",    //3
+     "chunk-instances",   //4
+     (char *) NULL
+    };
+#endif /* __INPARAM_ASSIGN_CLUSTERING__ */
  
 #ifdef __INPARAM_PCATRANSMATRIX__
   const char   *las_optPCAtransmatrix[] = 
@@ -2259,6 +2451,37 @@ inparamclustering_getParameter
   
   const char   *las_opGeneral[] = {"centroids-format", "table-format", "print-mulline", (char *) NULL };
 
+#ifdef __INSTANCES_WITH_FREQUENCY
+  const char   *las_opCoreset[]     = {"coreset", "coreset-size", (char *) NULL };
+  const char   *las_opCoresetType[] = INPARAMCLUSTERING_CORESET;
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+
+#if defined(__INPARAM_MINIBATCH__) && !defined(__INSTANCES_MMAP)
+  const char   *las_opMiniBatch[]   = {"minibatch-size", "minibatch-growth", (char *) NULL };
+#endif /*__INPARAM_MINIBATCH__*/
+
+#ifdef __INPARAM_ISLANDS__
+  const char   *las_opIslands[]     = {"islands", "migration-interval", "migration-elites", "migration-topology", (char *) NULL };
+  const char   *las_opMigrationTopology[] = INPARAMCLUSTERING_MIGRATION;
+#endif /*__INPARAM_ISLANDS__*/
+
+#ifdef __INPARAM_CHECKPOINT__
+  const char   *las_opCheckpoint[]  = {"checkpoint", "checkpoint-interval", "resume", (char *) NULL };
+#endif /*__INPARAM_CHECKPOINT__*/
+
+#ifdef __INPARAM_INITIALIZATION__
+  const char   *las_opInitialization[] = {"initialization", "initialization-rounds", "initialization-oversampling", (char *) NULL };
+  const char   *las_opInitializationType[] = INPARAMCLUSTERING_INITIALIZATION;
+#endif /*__INPARAM_INITIALIZATION__*/
+
+#ifdef __INPARAM_WARMSTART__
+  const char   *las_opWarmStart[] = {"warm-start", "warm-start-fraction", "warm-start-perturbation", (char *) NULL };
+#endif /*__INPARAM_WARMSTART__*/
+
+  const char   *las_opTermination[] = {"stagnation", "stagnation-tolerance", "target-fitness", (char *) NULL };
+
+  const char   *las_opReport[] = {"pairwise-sample", (char *) NULL };
+
 #endif /* __ALG_CLUSTERING__ */
   
   int          li_opt;
@@ -2292,12 +2515,53 @@ inparamclustering_getParameter
       {"number-runs",             required_argument, 0, 'r'},
       {"random-seed",             required_argument, 0, 'z'},
       {"max-execution-time",      required_argument, 0, 'w'},
+#ifdef __ALG_CLUSTERING__
+      {"stagnation",              required_argument, 0, 0},
+      {"stagnation-tolerance",    required_argument, 0, 0},
+      {"target-fitness",          required_argument, 0, 0},
+      {"pairwise-sample",         required_argument, 0, 0},
+#endif /*__ALG_CLUSTERING__*/
       {"centroids-outfile",       required_argument, 0, 'C'},
       {"centroids-format",        required_argument, 0, 0},
       {"membership-outfile",      required_argument, 0, 'M'},
       {"partitionstable-outfile", required_argument, 0, 'T'},
       {"table-format",            required_argument, 0, 0},
       {"print-mulline",           required_argument, 0, 0},
+
+#ifdef __INSTANCES_WITH_FREQUENCY
+      {"coreset",                 required_argument, 0, 0},
+      {"coreset-size",            required_argument, 0, 0},
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+
+#if defined(__INPARAM_MINIBATCH__) && !defined(__INSTANCES_MMAP)
+      {"minibatch-size",          required_argument, 0, 0},
+      {"minibatch-growth",        required_argument, 0, 0},
+#endif /*__INPARAM_MINIBATCH__*/
+
+#ifdef __INPARAM_ISLANDS__
+      {"islands",                 required_argument, 0, 0},
+      {"migration-interval",      required_argument, 0, 0},
+      {"migration-elites",        required_argument, 0, 0},
+      {"migration-topology",      required_argument, 0, 0},
+#endif /*__INPARAM_ISLANDS__*/
+
+#ifdef __INPARAM_CHECKPOINT__
+      {"checkpoint",              required_argument, 0, 0},
+      {"checkpoint-interval",     required_argument, 0, 0},
+      {"resume",                  required_argument, 0, 0},
+#endif /*__INPARAM_CHECKPOINT__*/
+
+#ifdef __INPARAM_INITIALIZATION__
+      {"initialization",          required_argument, 0, 0},
+      {"initialization-rounds",   required_argument, 0, 0},
+      {"initialization-oversampling", required_argument, 0, 0},
+#endif /*__INPARAM_INITIALIZATION__*/
+
+#ifdef __INPARAM_WARMSTART__
+      {"warm-start",              required_argument, 0, 0},
+      {"warm-start-fraction",     required_argument, 0, 0},
+      {"warm-start-perturbation", required_argument, 0, 0},
+#endif /*__INPARAM_WARMSTART__*/
       
 #ifdef _ALG_GRAPH_BASED_
       {"graph-outfile",           required_argument, 0, 'G'},
@@ -2312,8 +2576,17 @@ inparamclustering_getParameter
 
 #ifdef  __INPARAM_STDVAR_MILLIGAN_COOPER1988__
       {"std-var",                 required_argument, 0, 0},
+      {"std-var-outfile",         required_argument, 0, 0},
 #endif /* __INPARAM_STDVAR_MILLIGAN_COOPER1988__ */
 
+#ifdef  __INPARAM_ASSIGN_CLUSTERING__
+      {"model-infile",            required_argument, 0, 0},
+      {"model-run",               required_argument, 0, 0},
+      {"std-var-infile",          required_argument, 0, 0},
+      {"print-distance",          required_argument, 0, 0},
+      {"chunk-instances",         required_argument, 0, 0},
+#endif /* __INPARAM_ASSIGN_CLUSTERING__ */
+
 #ifdef __INPARAM_PCATRANSMATRIX__
       {"transmatrix-outfile",     required_argument, 0, 0},
 #endif /*__INPARAM_PCATRANSMATRIX__*/
@@ -2623,6 +2896,221 @@ inparamclustering_getParameter
 	  aoipc_inParamClustering.setPrintMulLine
 	    (aoipc_inParamClustering.isYesNo(optarg, argv[0],long_options[option_index].name));
 	}
+
+#ifdef __INSTANCES_WITH_FREQUENCY
+      else if ( strcmp //coreset
+		(long_options[option_index].name,
+		 las_opCoreset[0] ) == 0 ) 
+	{
+	  if ( (li_idxSubOpt = 
+		getsubopt_getsubopt
+		(&optarg, las_opCoresetType, &lps_optsubValue)) != -1) 
+	    {
+	      aoipc_inParamClustering.setOpCoreset(li_idxSubOpt);
+	    }
+	  else {
+	    aoipc_inParamClustering.errorArgument
+	      (argv[0],long_options[option_index].name, las_opCoresetType);
+	  }
+	}
+      else if ( strcmp //coreset-size
+		(long_options[option_index].name,
+		 las_opCoreset[1] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setSizeCoreset(luintidx_read);
+	}
+#endif /*__INSTANCES_WITH_FREQUENCY*/
+
+#if defined(__INPARAM_MINIBATCH__) && !defined(__INSTANCES_MMAP)
+      else if ( strcmp //minibatch-size
+		(long_options[option_index].name,
+		 las_opMiniBatch[0] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setSizeMiniBatch(luintidx_read);
+	}
+      else if ( strcmp //minibatch-growth
+		(long_options[option_index].name,
+		 las_opMiniBatch[1] ) == 0 ) 
+	{
+	  double ld_growthMiniBatch;
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> ld_growthMiniBatch;
+	  aoipc_inParamClustering.setGrowthMiniBatch(ld_growthMiniBatch);
+	}
+#endif /*__INPARAM_MINIBATCH__*/
+#ifdef __INPARAM_ISLANDS__
+      else if ( strcmp //islands
+		(long_options[option_index].name,
+		 las_opIslands[0] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setNumIslands
+	    ( (luintidx_read > 0)?luintidx_read:1 );
+	}
+      else if ( strcmp //migration-interval
+		(long_options[option_index].name,
+		 las_opIslands[1] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setMigrationInterval(luintidx_read);
+	}
+      else if ( strcmp //migration-elites
+		(long_options[option_index].name,
+		 las_opIslands[2] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setMigrationElites(luintidx_read);
+	}
+      else if ( strcmp //migration-topology
+		(long_options[option_index].name,
+		 las_opIslands[3] ) == 0 ) 
+	{
+	  if ( (li_idxSubOpt = 
+		getsubopt_getsubopt
+		(&optarg, las_opMigrationTopology, &lps_optsubValue)) != -1) 
+	    {
+	      aoipc_inParamClustering.setOpMigrationTopology(li_idxSubOpt);
+	    }
+	  else {
+	    aoipc_inParamClustering.errorArgument
+	      (argv[0],long_options[option_index].name, las_opMigrationTopology);
+	  }
+	}
+#endif /*__INPARAM_ISLANDS__*/
+#ifdef __INPARAM_CHECKPOINT__
+      else if ( strcmp //checkpoint
+		(long_options[option_index].name,
+		 las_opCheckpoint[0] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setFileNameCheckpoint(optarg);
+	}
+      else if ( strcmp //checkpoint-interval
+		(long_options[option_index].name,
+		 las_opCheckpoint[1] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setCheckpointInterval
+	    ( (luintidx_read > 0)?luintidx_read:1 );
+	}
+      else if ( strcmp //resume
+		(long_options[option_index].name,
+		 las_opCheckpoint[2] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setFileNameResume(optarg);
+	}
+#endif /*__INPARAM_CHECKPOINT__*/
+#ifdef __INPARAM_INITIALIZATION__
+      else if ( strcmp //initialization
+		(long_options[option_index].name,
+		 las_opInitialization[0] ) == 0 ) 
+	{
+	  if ( (li_idxSubOpt = 
+		getsubopt_getsubopt
+		(&optarg, las_opInitializationType, &lps_optsubValue)) != -1) 
+	    {
+	      aoipc_inParamClustering.setOpInitialization(li_idxSubOpt);
+	    }
+	  else {
+	    aoipc_inParamClustering.errorArgument
+	      (argv[0],long_options[option_index].name, las_opInitializationType);
+	  }
+	}
+      else if ( strcmp //initialization-rounds
+		(long_options[option_index].name,
+		 las_opInitialization[1] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setRoundsInitialization(luintidx_read);
+	}
+      else if ( strcmp //initialization-oversampling
+		(long_options[option_index].name,
+		 las_opInitialization[2] ) == 0 ) 
+	{
+	  double ld_oversampling;
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> ld_oversampling;
+	  aoipc_inParamClustering.setOversamplingInitialization
+	    ( (ld_oversampling > 0.0)?ld_oversampling:INPARAM_INITIALIZATION_OVERSAMPLING_DEFAULT );
+	}
+#endif /*__INPARAM_INITIALIZATION__*/
+#ifdef __INPARAM_WARMSTART__
+      else if ( strcmp //warm-start
+		(long_options[option_index].name,
+		 las_opWarmStart[0] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setFileNameWarmStart(optarg);
+	}
+      else if ( strcmp //warm-start-fraction
+		(long_options[option_index].name,
+		 las_opWarmStart[1] ) == 0 ) 
+	{
+	  double ld_fraction;
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> ld_fraction;
+	  aoipc_inParamClustering.setFractionWarmStart
+	    ( std::min(std::max(ld_fraction,0.0),1.0) );
+	}
+      else if ( strcmp //warm-start-perturbation
+		(long_options[option_index].name,
+		 las_opWarmStart[2] ) == 0 ) 
+	{
+	  double ld_perturbation;
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> ld_perturbation;
+	  aoipc_inParamClustering.setPerturbationWarmStart
+	    ( std::min(std::max(ld_perturbation,0.0),1.0) );
+	}
+#endif /*__INPARAM_WARMSTART__*/
+      else if ( strcmp //stagnation
+		(long_options[option_index].name,
+		 las_opTermination[0] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setNumStagnation(luintidx_read);
+	}
+      else if ( strcmp //stagnation-tolerance
+		(long_options[option_index].name,
+		 las_opTermination[1] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setTolStagnation(atof(optarg));
+	}
+      else if ( strcmp //target-fitness
+		(long_options[option_index].name,
+		 las_opTermination[2] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setTargetFitness(atof(optarg));
+	}
+      else if ( strcmp //pairwise-sample
+		(long_options[option_index].name,
+		 las_opReport[0] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setSizeSamplePairwise(luintidx_read);
+	}
      
 
 #endif /* __ALG_CLUSTERING__ */
@@ -2653,6 +3141,12 @@ inparamclustering_getParameter
 		 );
 	    }
 	}
+      else if ( strcmp
+		(long_options[option_index].name,
+		 las_optStandardizationVar[1] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setOutFileStdVar(optarg);
+	}
       else 
 	{
 	  aoipc_inParamClustering.errorArgument
@@ -2663,6 +3157,61 @@ inparamclustering_getParameter
 	}
 	  
 #endif /* __INPARAM_STDVAR_MILLIGAN_COOPER1988__ */
+
+#ifdef  __INPARAM_ASSIGN_CLUSTERING__
+
+      if ( strcmp
+	   (long_options[option_index].name,
+	    las_optAssignClustering[0] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setFileNameModel(optarg);
+	}
+      else if ( strcmp
+		(long_options[option_index].name,
+		 las_optAssignClustering[1] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setNumRunModel(luintidx_read);
+	}
+      else if ( strcmp
+		(long_options[option_index].name,
+		 las_optAssignClustering[2] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setFileNameStdVar(optarg);
+	}
+      else if ( strcmp
+		(long_options[option_index].name,
+		 las_optAssignClustering[3] ) == 0 ) 
+	{
+	  aoipc_inParamClustering.setPrintDistance
+	    (aoipc_inParamClustering.isYesNo
+	     (optarg,
+	      argv[0],
+	      long_options[option_index].name
+	      )
+	     );
+	}
+      else if ( strcmp
+		(long_options[option_index].name,
+		 las_optAssignClustering[4] ) == 0 ) 
+	{
+	  liss_stringstream.clear();
+	  liss_stringstream.str(optarg);
+	  liss_stringstream >> luintidx_read;
+	  aoipc_inParamClustering.setNumInstChunk(luintidx_read);
+	}
+      else 
+	{
+	  aoipc_inParamClustering.errorArgument
+	    (argv[0],
+	     long_options[option_index].name, 
+	     las_optAssignClustering
+	     );
+	}
+	  
+#endif /* __INPARAM_ASSIGN_CLUSTERING__ */
       
 #ifdef __INPARAM_PCATRANSMATRIX__
       
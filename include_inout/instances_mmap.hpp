@@ -0,0 +1,776 @@
+/*! \file instances_mmap.hpp
+ *
+ * \brief instances read from a binary file mapped in memory
+ *
+ * \details The instances are stored in a binary file, row by row, and the
+ * file is mapped in memory. The data set is traversed by blocks of rows,
+ * while a block is processed the operating system reads the next one,
+ * so data sets larger than the memory can be used with the algorithms
+ * that only access the instances through an iterator.\n
+ * Format of the file:
+ * <ul>
+ * <li> InstancesBinaryHeader
+ * <li> features, n rows of d values of type T_FEATURE
+ * <li> class index, n values of int32_t, only if numClass > 0
+ * <li> class labels, numClass strings (uint32_t length and characters)
+ * <li> source key, a string with the options used to read the text file
+ * </ul>
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+#ifndef __INSTANCES_MMAP_HPP
+#define __INSTANCES_MMAP_HPP
+
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "instance_view.hpp"
+#include "instances_read.hpp"
+
+#include "verbose_global.hpp"
+
+#define INSTANCES_BINARY_MAGIC         "LEACBIN1"
+#define INSTANCES_BINARY_EXTENSION     ".leacbin"
+
+/*SIZE IN BYTES OF THE BLOCK THAT IS READ IN ADVANCE
+ */
+#define INSTANCES_MMAP_SIZEBLOCK       (uintidx(1) << 22)
+
+/*NUMBER OF VIEWS, A POINTER RETURNED BY THE ITERATOR IS VALID
+  UNTIL THIS NUMBER OF INSTANCES ARE ACCESSED
+ */
+#define INSTANCES_MMAP_NUMVIEWS        1024
+
+/*! \namespace inout
+  \brief Module for input and output parameters
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace  inout {
+
+/*! \struct InstancesBinaryHeader
+  \brief Header of the binary file of instances
+*/
+struct InstancesBinaryHeader {
+  char     _ac_magic[8];
+  uint64_t _ui64_numInstances;
+  uint64_t _ui64_numDimensions;
+  uint64_t _ui64_sizeFeature;
+  uint64_t _ui64_numClass;        /*0 WITHOUT CLASS*/
+  uint64_t _ui64_offsetFeatures;
+  uint64_t _ui64_offsetClass;
+  uint64_t _ui64_offsetLabels;
+};
+
+
+/*! \fn std::string instancesBinaryKey(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst)
+    \brief Options used to read the text file, a binary file is only reused if it was created with the same options
+    \param aiipri_inParamReadInst a inout::InParamReadInst with the necessary parameters to read a data set file
+ */
+template <typename T_FEATURE,
+	  typename T_INSTANCES_CLUSTER_K,
+	  typename T_CLUSTERIDX
+	  >
+std::string
+instancesBinaryKey
+(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst)
+{
+  std::ostringstream lostrstream_key;
+
+  lostrstream_key
+    << aiipri_inParamReadInst.getSeparateAttributes()
+    << '|' << aiipri_inParamReadInst.getSelectAttributes()
+    << '|' << aiipri_inParamReadInst.getHaveHeaderFileInstance()
+    << '|' << aiipri_inParamReadInst.getClassInstanceColumn()
+    << '|' << aiipri_inParamReadInst.getClusterInstanceColumn()
+    << '|' << sizeof(T_FEATURE);
+
+  return lostrstream_key.str();
+}
+
+/*! \fn void instancesWriteBinary(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst, const std::string &aistr_fileBinary)
+    \brief Convert the current file of instances to the binary format
+    \details The text file is read line by line, only one instance is kept in memory
+    \param aiipri_inParamReadInst a inout::InParamReadInst with the necessary parameters to read a data set file
+    \param aistr_fileBinary a string with the name of the binary file
+ */
+template <typename T_FEATURE,
+	  typename T_INSTANCES_CLUSTER_K,
+	  typename T_CLUSTERIDX
+	  >
+void
+instancesWriteBinary
+(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst,
+ const std::string                                                      &aistr_fileBinary
+ )
+{
+  const std::string& lstr_fileInstance = aiipri_inParamReadInst.getCurrentFileInstance();
+
+#ifdef __VERBOSE_YES
+  const char* lpc_labelFunc = "inout::instancesWriteBinary";
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ":  IN(" << geiinparam_verbose << ')'
+	      << "\n\t(input  const std::string &aistr_fileInstance = "
+	      << lstr_fileInstance
+	      << "\n\t input  const std::string &aistr_fileBinary = "
+	      << aistr_fileBinary
+	      << "\n\t)"
+	      << std::endl;
+  }
+#endif /*__VERBOSE_YES*/
+
+  std::pair<uintidx,uintidx> lpair_dimInstance =
+    readNumInstances
+    (aiipri_inParamReadInst,
+     false
+     );
+  data::Instance<T_FEATURE>::setNumDimensions(lpair_dimInstance.second);
+
+  InstancesBinaryHeader lheader_file;
+  std::memcpy(lheader_file._ac_magic,INSTANCES_BINARY_MAGIC,sizeof(lheader_file._ac_magic));
+  lheader_file._ui64_numInstances   = lpair_dimInstance.first;
+  lheader_file._ui64_numDimensions  = data::Instance<T_FEATURE>::getNumDimensions();
+  lheader_file._ui64_sizeFeature    = sizeof(T_FEATURE);
+  lheader_file._ui64_numClass       = 0;
+  lheader_file._ui64_offsetFeatures = sizeof(InstancesBinaryHeader);
+  lheader_file._ui64_offsetClass    =
+    lheader_file._ui64_offsetFeatures
+    + lheader_file._ui64_numInstances * lheader_file._ui64_numDimensions * sizeof(T_FEATURE);
+  lheader_file._ui64_offsetLabels   =
+    lheader_file._ui64_offsetClass
+    + ((aiipri_inParamReadInst.getClassInstanceColumn())?
+       lheader_file._ui64_numInstances * sizeof(int32_t):0);
+
+  std::ifstream lfp_file(lstr_fileInstance);
+  if (!lfp_file) {
+    std::string lstr_error("instancesWriteBinary: no file input data ");
+    lstr_error += lstr_fileInstance;
+    throw  std::invalid_argument(lstr_error);
+  }
+
+  std::ofstream lfp_fileBinary(aistr_fileBinary, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!lfp_fileBinary) {
+    std::string lstr_error("instancesWriteBinary: can not create the file ");
+    lstr_error += aistr_fileBinary;
+    throw  std::invalid_argument(lstr_error);
+  }
+  lfp_fileBinary.write((const char*) &lheader_file, sizeof(InstancesBinaryHeader));
+  lfp_fileBinary.flush();
+
+  /*THE CLASS INDEX IS WRITTEN WITH ANOTHER STREAM AFTER THE FEATURES
+   */
+  std::fstream lfp_fileClass;
+  if ( aiipri_inParamReadInst.getClassInstanceColumn() ) {
+    lfp_fileClass.open(aistr_fileBinary, std::ios::in | std::ios::out | std::ios::binary);
+    lfp_fileClass.seekp(lheader_file._ui64_offsetClass);
+  }
+
+  std::map<std::string,int32_t> lmap_classIdx;
+  std::vector<std::string>      lvectorstr_classLabel;
+
+  LineSplit
+    lls_lineSplit
+    (aiipri_inParamReadInst.getSeparateAttributes(),
+     aiipri_inParamReadInst.getSelectAttributes()
+     );
+
+  data::Instance<T_FEATURE> linst_row;
+
+  uintidx lui_countLines = 0;
+  uintidx lui_countInstances = 0;
+  std::string lstr_linedata;
+  //JUMPING FILE COMMENTS
+  while ( std::getline(lfp_file, lstr_linedata) )  {
+    ++lui_countLines;
+    if ( (lstr_linedata.size() > 0) && !(lstr_linedata.at(0) == '@' ||  lstr_linedata.at(0) == '#') )
+      break;
+  }
+  /*READ HEADER*/
+  if ( aiipri_inParamReadInst.getHaveHeaderFileInstance() ) {
+    std::getline(lfp_file, lstr_linedata);
+  }
+
+  try {
+
+    do {
+      ++lui_countLines;
+      if ( (lstr_linedata.size() > 0) && !(lstr_linedata.at(0) == '@' ||  lstr_linedata.at(0) == '#')) {
+	if ( lls_lineSplit.split( lstr_linedata ) > 0 ) {
+
+	  linst_row.readFeature(lls_lineSplit);
+	  lfp_fileBinary.write
+	    ((const char*) linst_row.getFeatures(),
+	     data::Instance<T_FEATURE>::getNumDimensions() * sizeof(T_FEATURE)
+	     );
+
+	  if ( aiipri_inParamReadInst.getClassInstanceColumn() ) { /*IF BEGIN CLASS LABEL*/
+	    std::string lstr_keyMapClass =
+	      lls_lineSplit.getItem( aiipri_inParamReadInst.getClassInstanceColumn() );
+	    if ( aiipri_inParamReadInst.getClusterInstanceColumn() ) {
+	      lstr_keyMapClass +=
+		"_" + lls_lineSplit.getItem( aiipri_inParamReadInst.getClusterInstanceColumn() );
+	    }
+	    std::map<std::string,int32_t>::iterator literator_class =
+	      lmap_classIdx.find(lstr_keyMapClass);
+	    int32_t li32_classIdx;
+	    if ( literator_class != lmap_classIdx.end() ) {
+	      li32_classIdx = literator_class->second;
+	    }
+	    else {
+	      li32_classIdx = (int32_t) lvectorstr_classLabel.size();
+	      lmap_classIdx.insert(std::make_pair(lstr_keyMapClass,li32_classIdx));
+	      lvectorstr_classLabel.push_back(lstr_keyMapClass);
+	    }
+	    lfp_fileClass.write((const char*) &li32_classIdx, sizeof(int32_t));
+	  } /*IF END CLASS LABEL*/
+
+	  ++lui_countInstances;
+	}
+      }
+    } while ( std::getline(lfp_file, lstr_linedata) );
+
+  } catch (std::out_of_range &ex) {
+    std::ostringstream lostrstream_error;
+    lostrstream_error
+      << "Error: On line "
+      << lui_countLines
+      << " of file "
+      << lstr_fileInstance
+      << " incomplete data";
+    throw std::out_of_range(lostrstream_error.str() );
+  }
+
+  lfp_file.close();
+  if ( lfp_fileClass.is_open() )
+    lfp_fileClass.close();
+
+  if ( lui_countInstances != lheader_file._ui64_numInstances ) {
+    std::ostringstream lostrstream_error;
+    lostrstream_error
+      << "instancesWriteBinary: the file " << lstr_fileInstance
+      << " changed while it was read";
+    throw std::runtime_error(lostrstream_error.str());
+  }
+
+  /*CLASS LABELS AND SOURCE KEY
+   */
+  lheader_file._ui64_numClass = lvectorstr_classLabel.size();
+  lvectorstr_classLabel.push_back
+    (instancesBinaryKey(aiipri_inParamReadInst));
+  lfp_fileBinary.seekp(lheader_file._ui64_offsetLabels);
+  for ( const auto& liter_label: lvectorstr_classLabel ) {
+    uint32_t lui32_length = (uint32_t) liter_label.size();
+    lfp_fileBinary.write((const char*) &lui32_length, sizeof(uint32_t));
+    lfp_fileBinary.write(liter_label.data(), lui32_length);
+  }
+
+  lfp_fileBinary.seekp(0);
+  lfp_fileBinary.write((const char*) &lheader_file, sizeof(InstancesBinaryHeader));
+  lfp_fileBinary.close();
+
+  if ( !lfp_fileBinary ) {
+    std::string lstr_error("instancesWriteBinary: error writing the file ");
+    lstr_error += aistr_fileBinary;
+    throw  std::runtime_error(lstr_error);
+  }
+
+#ifdef __VERBOSE_YES
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ": OUT(" << geiinparam_verbose << ')'
+	      << "\n\tnumber of instances = " << lui_countInstances
+	      << std::endl;
+  }
+  --geiinparam_verbose;
+#endif /*__VERBOSE_YES*/
+}
+
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX
+	   >
+class InstancesMmap;
+
+/*! \class InstancesMmapIterator
+  \brief Random access iterator over the instances of a InstancesMmap
+  \details The value is a pointer to a data::Instance, as the iterator of a std::vector<data::Instance<T_FEATURE>*>. The pointer is a view of the row that remains valid until INSTANCES_MMAP_NUMVIEWS other instances are accessed, the features are in the mapped file
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX
+	   >
+class InstancesMmapIterator {
+public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef data::Instance<T_FEATURE>*      value_type;
+  typedef std::ptrdiff_t                  difference_type;
+  typedef data::Instance<T_FEATURE>**     pointer;
+  typedef data::Instance<T_FEATURE>*      reference;
+
+  InstancesMmapIterator()
+    : _ptinstmmap_instances(NULL)
+    , _ui_idx(0)
+  {}
+
+  InstancesMmapIterator
+  (const InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> *aiptinstmmap_instances,
+   const uintidx                                                      aiui_idx
+   )
+    : _ptinstmmap_instances(aiptinstmmap_instances)
+    , _ui_idx(aiui_idx)
+  {}
+
+  inline reference operator*() const
+  {
+    return _ptinstmmap_instances->getView(_ui_idx);
+  }
+
+  inline reference operator[](const difference_type aidt_n) const
+  {
+    return _ptinstmmap_instances->getView(uintidx(difference_type(_ui_idx) + aidt_n));
+  }
+
+  inline InstancesMmapIterator& operator++()
+  {
+    ++_ui_idx;
+    return *this;
+  }
+
+  inline InstancesMmapIterator operator++(int)
+  {
+    InstancesMmapIterator lit_old(*this);
+    ++_ui_idx;
+    return lit_old;
+  }
+
+  inline InstancesMmapIterator& operator--()
+  {
+    --_ui_idx;
+    return *this;
+  }
+
+  inline InstancesMmapIterator operator--(int)
+  {
+    InstancesMmapIterator lit_old(*this);
+    --_ui_idx;
+    return lit_old;
+  }
+
+  inline InstancesMmapIterator& operator+=(const difference_type aidt_n)
+  {
+    _ui_idx = uintidx(difference_type(_ui_idx) + aidt_n);
+    return *this;
+  }
+
+  inline InstancesMmapIterator& operator-=(const difference_type aidt_n)
+  {
+    _ui_idx = uintidx(difference_type(_ui_idx) - aidt_n);
+    return *this;
+  }
+
+  inline InstancesMmapIterator operator+(const difference_type aidt_n) const
+  {
+    return InstancesMmapIterator(_ptinstmmap_instances,uintidx(difference_type(_ui_idx) + aidt_n));
+  }
+
+  friend inline InstancesMmapIterator operator+(const difference_type aidt_n, const InstancesMmapIterator& aiit_b)
+  {
+    return aiit_b + aidt_n;
+  }
+
+  inline InstancesMmapIterator operator-(const difference_type aidt_n) const
+  {
+    return InstancesMmapIterator(_ptinstmmap_instances,uintidx(difference_type(_ui_idx) - aidt_n));
+  }
+
+  inline difference_type operator-(const InstancesMmapIterator& aiit_b) const
+  {
+    return difference_type(_ui_idx) - difference_type(aiit_b._ui_idx);
+  }
+
+  inline bool operator==(const InstancesMmapIterator& aiit_b) const { return _ui_idx == aiit_b._ui_idx; }
+  inline bool operator!=(const InstancesMmapIterator& aiit_b) const { return _ui_idx != aiit_b._ui_idx; }
+  inline bool operator<(const InstancesMmapIterator& aiit_b) const  { return _ui_idx <  aiit_b._ui_idx; }
+  inline bool operator>(const InstancesMmapIterator& aiit_b) const  { return _ui_idx >  aiit_b._ui_idx; }
+  inline bool operator<=(const InstancesMmapIterator& aiit_b) const { return _ui_idx <= aiit_b._ui_idx; }
+  inline bool operator>=(const InstancesMmapIterator& aiit_b) const { return _ui_idx >= aiit_b._ui_idx; }
+
+protected:
+
+  const InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> *_ptinstmmap_instances;
+  uintidx                                                            _ui_idx;
+
+}; /*InstancesMmapIterator*/
+
+
+/*! \class InstancesMmap
+  \brief Container of instances of a binary file mapped in memory
+  \details It is used in place of the std::vector<data::Instance<T_FEATURE>*> of the data set, with begin(), end() and size(). The rows are divided in blocks of about INSTANCES_MMAP_SIZEBLOCK bytes, when the first row of a block is accessed the next block is requested to the operating system (madvise MADV_WILLNEED), so its reading overlaps with the processing of the current block. The pages already processed are released by the operating system when it needs memory. The views are shared, it is not thread safe
+*/
+template < typename T_FEATURE,
+	   typename T_INSTANCES_CLUSTER_K,
+	   typename T_CLUSTERIDX
+	   >
+class InstancesMmap {
+public:
+  typedef InstancesMmapIterator<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> iterator;
+  typedef InstancesMmapIterator<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> const_iterator;
+  typedef data::Instance<T_FEATURE>*                                          value_type;
+
+  InstancesMmap(const std::string &aistr_fileBinary)
+    : _i_fd(-1)
+    , _ptc_map(NULL)
+    , _st_sizeMap(0)
+    , _ui_numInstances(0)
+    , _ui_numDimensions(0)
+    , _pt_features(NULL)
+    , _pi32_classIdx(NULL)
+    , _ui_shiftBlock(0)
+    , _arrayinstview_views(NULL)
+  {
+    _i_fd = open(aistr_fileBinary.c_str(), O_RDONLY);
+    if ( _i_fd < 0 ) {
+      std::string lstr_error("InstancesMmap: no file input data ");
+      lstr_error += aistr_fileBinary;
+      throw  std::invalid_argument(lstr_error);
+    }
+    struct stat lstat_file;
+    if ( fstat(_i_fd, &lstat_file) != 0
+	 || (size_t) lstat_file.st_size < sizeof(InstancesBinaryHeader) ) {
+      this->_close();
+      std::string lstr_error("InstancesMmap: is not a binary file of instances ");
+      lstr_error += aistr_fileBinary;
+      throw  std::invalid_argument(lstr_error);
+    }
+    _st_sizeMap = (size_t) lstat_file.st_size;
+    _ptc_map = (char*) mmap(NULL, _st_sizeMap, PROT_READ, MAP_SHARED, _i_fd, 0);
+    if ( _ptc_map == MAP_FAILED ) {
+      _ptc_map = NULL;
+      this->_close();
+      std::string lstr_error("InstancesMmap: can not map the file ");
+      lstr_error += aistr_fileBinary;
+      throw  std::runtime_error(lstr_error);
+    }
+
+    InstancesBinaryHeader lheader_file;
+    std::memcpy(&lheader_file, _ptc_map, sizeof(InstancesBinaryHeader));
+    if ( std::memcmp(lheader_file._ac_magic,INSTANCES_BINARY_MAGIC,sizeof(lheader_file._ac_magic)) != 0
+	 || lheader_file._ui64_sizeFeature != sizeof(T_FEATURE)
+	 || lheader_file._ui64_offsetLabels > _st_sizeMap ) {
+      this->_close();
+      std::string lstr_error("InstancesMmap: is not a binary file of instances of this feature type ");
+      lstr_error += aistr_fileBinary;
+      throw  std::invalid_argument(lstr_error);
+    }
+
+    _ui_numInstances  = (uintidx) lheader_file._ui64_numInstances;
+    _ui_numDimensions = (uintidx) lheader_file._ui64_numDimensions;
+    _pt_features = (T_FEATURE*) (_ptc_map + lheader_file._ui64_offsetFeatures);
+    data::Instance<T_FEATURE>::setNumDimensions(_ui_numDimensions);
+
+    /*CLASS LABELS, IN ORDER OF THEIR INDEX
+     */
+    const char* lpc_label = _ptc_map + lheader_file._ui64_offsetLabels;
+    _vectorstr_classLabel.reserve(lheader_file._ui64_numClass + 1);
+    for (uint64_t lui64_i = 0; lui64_i <= lheader_file._ui64_numClass; lui64_i++) {
+      uint32_t lui32_length;
+      if ( lpc_label + sizeof(uint32_t) > _ptc_map + _st_sizeMap ) break;
+      std::memcpy(&lui32_length, lpc_label, sizeof(uint32_t));
+      lpc_label += sizeof(uint32_t);
+      if ( lpc_label + lui32_length > _ptc_map + _st_sizeMap ) break;
+      _vectorstr_classLabel.push_back(std::string(lpc_label,lui32_length));
+      lpc_label += lui32_length;
+    }
+    if ( _vectorstr_classLabel.size() != lheader_file._ui64_numClass + 1 ) {
+      this->_close();
+      std::string lstr_error("InstancesMmap: incomplete file ");
+      lstr_error += aistr_fileBinary;
+      throw  std::invalid_argument(lstr_error);
+    }
+    _str_key = _vectorstr_classLabel.back();
+    _vectorstr_classLabel.pop_back();
+    if ( lheader_file._ui64_numClass > 0 )
+      _pi32_classIdx = (const int32_t*) (_ptc_map + lheader_file._ui64_offsetClass);
+
+    /*NUMBER OF ROWS PER BLOCK, POWER OF TWO
+     */
+    const uintidx lui_sizeRow = _ui_numDimensions * sizeof(T_FEATURE);
+    while ( (uintidx(2) << _ui_shiftBlock) * lui_sizeRow <= INSTANCES_MMAP_SIZEBLOCK )
+      ++_ui_shiftBlock;
+
+    madvise(_ptc_map, _st_sizeMap, MADV_SEQUENTIAL);
+    this->_willNeed(0);
+
+    _arrayinstview_views =
+      new data::InstanceView<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+      [INSTANCES_MMAP_NUMVIEWS];
+  }
+
+  InstancesMmap(const InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiinstmmap_b) = delete;
+
+  InstancesMmap(InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &&aiinstmmap_b)
+    : _i_fd(aiinstmmap_b._i_fd)
+    , _ptc_map(aiinstmmap_b._ptc_map)
+    , _st_sizeMap(aiinstmmap_b._st_sizeMap)
+    , _ui_numInstances(aiinstmmap_b._ui_numInstances)
+    , _ui_numDimensions(aiinstmmap_b._ui_numDimensions)
+    , _pt_features(aiinstmmap_b._pt_features)
+    , _pi32_classIdx(aiinstmmap_b._pi32_classIdx)
+    , _ui_shiftBlock(aiinstmmap_b._ui_shiftBlock)
+    , _arrayinstview_views(aiinstmmap_b._arrayinstview_views)
+    , _vectorstr_classLabel(std::move(aiinstmmap_b._vectorstr_classLabel))
+    , _str_key(std::move(aiinstmmap_b._str_key))
+  {
+    aiinstmmap_b._i_fd                = -1;
+    aiinstmmap_b._ptc_map             = NULL;
+    aiinstmmap_b._ui_numInstances     = 0;
+    aiinstmmap_b._pt_features         = NULL;
+    aiinstmmap_b._pi32_classIdx       = NULL;
+    aiinstmmap_b._arrayinstview_views = NULL;
+  }
+
+  ~InstancesMmap()
+  {
+    this->_close();
+    if ( _arrayinstview_views != NULL )
+      delete [] _arrayinstview_views;
+  }
+
+  inline iterator begin() const
+  {
+    return iterator(this,0);
+  }
+
+  inline iterator end() const
+  {
+    return iterator(this,_ui_numInstances);
+  }
+
+  inline uintidx size() const
+  {
+    return _ui_numInstances;
+  }
+
+  inline uintidx getNumInstBlock() const
+  {
+    return uintidx(1) << _ui_shiftBlock;
+  }
+
+  /*! \fn const std::vector<std::string>& getVectorClassLabel() const
+    \brief Labels of the classes, in order of their index, empty if the file has no class
+   */
+  inline const std::vector<std::string>& getVectorClassLabel() const
+  {
+    return _vectorstr_classLabel;
+  }
+
+  /*! \fn const std::string& getKey() const
+    \brief Options used to read the text file, see instancesBinaryKey
+   */
+  inline const std::string& getKey() const
+  {
+    return _str_key;
+  }
+
+  /*! \fn data::Instance<T_FEATURE>* getView(const uintidx aiui_idx) const
+    \brief A view of the instance aiui_idx
+    \details When the first row of a block is accessed, the next block is requested
+   */
+  inline data::Instance<T_FEATURE>* getView(const uintidx aiui_idx) const
+  {
+    if ( (aiui_idx & (this->getNumInstBlock() - 1)) == 0 )
+      this->_willNeed((aiui_idx >> _ui_shiftBlock) + 1);
+
+    data::InstanceView<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>* lptinstview_row =
+      &_arrayinstview_views[aiui_idx & (INSTANCES_MMAP_NUMVIEWS - 1)];
+    lptinstview_row->setView
+      (_pt_features + aiui_idx * _ui_numDimensions,
+       (_pi32_classIdx != NULL)?T_CLUSTERIDX(_pi32_classIdx[aiui_idx]):T_CLUSTERIDX(UNKNOWN_CLUSTER_IDX)
+       );
+
+    return lptinstview_row;
+  }
+
+protected:
+
+  void _willNeed(const uintidx aiui_block) const
+  {
+    const uintidx lui_firstRow = aiui_block << _ui_shiftBlock;
+    if ( lui_firstRow >= _ui_numInstances )
+      return;
+    const uintidx lui_numRows =
+      std::min(this->getNumInstBlock(), _ui_numInstances - lui_firstRow);
+    const size_t lst_sizePage = (size_t) sysconf(_SC_PAGESIZE);
+    char* lpc_begin = (char*) (_pt_features + lui_firstRow * _ui_numDimensions);
+    char* lpc_end   = (char*) (_pt_features + (lui_firstRow + lui_numRows) * _ui_numDimensions);
+    char* lpc_page  = _ptc_map + ((lpc_begin - _ptc_map) / lst_sizePage) * lst_sizePage;
+    madvise(lpc_page, size_t(lpc_end - lpc_page), MADV_WILLNEED);
+    if ( _pi32_classIdx != NULL ) {
+      lpc_begin = (char*) (_pi32_classIdx + lui_firstRow);
+      lpc_end   = (char*) (_pi32_classIdx + lui_firstRow + lui_numRows);
+      lpc_page  = _ptc_map + ((lpc_begin - _ptc_map) / lst_sizePage) * lst_sizePage;
+      madvise(lpc_page, size_t(lpc_end - lpc_page), MADV_WILLNEED);
+    }
+  }
+
+  void _close()
+  {
+    if ( _ptc_map != NULL ) {
+      munmap(_ptc_map, _st_sizeMap);
+      _ptc_map = NULL;
+    }
+    if ( _i_fd >= 0 ) {
+      close(_i_fd);
+      _i_fd = -1;
+    }
+  }
+
+  int                      _i_fd;
+  char                     *_ptc_map;
+  size_t                   _st_sizeMap;
+  uintidx                  _ui_numInstances;
+  uintidx                  _ui_numDimensions;
+  T_FEATURE                *_pt_features;
+  const int32_t            *_pi32_classIdx;
+  uintidx                  _ui_shiftBlock;
+  data::InstanceView<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+                           *_arrayinstview_views;
+  std::vector<std::string> _vectorstr_classLabel;
+  std::string              _str_key;
+
+}; /*InstancesMmap*/
+
+
+/*! \fn std::pair<InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>, std::vector<data::Instance<T_FEATURE>* > > dataSetReadMmap(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> &aiipri_inParamReadInst)
+    \brief Read a data set, the training instances from a binary file mapped in memory
+    \details The binary file is the name of the current file of instances with the extension INSTANCES_BINARY_EXTENSION. It is created from the text file the first time, and again if the text file is newer or if it was created with other options. The test instances are read in memory
+    \param aiipri_inParamReadInst a inout::InParamReadInst with the necessary parameters to read a data set file
+    \return a pair, the first with the training instances and the second with the test instances
+ */
+template <typename T_FEATURE,
+	  typename T_INSTANCES_CLUSTER_K,
+	  typename T_CLUSTERIDX
+	  >
+std::pair
+<InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>,
+ std::vector<data::Instance<T_FEATURE>* > >
+dataSetReadMmap
+(inout::InParamReadInst<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>   &aiipri_inParamReadInst)
+{
+#ifdef __VERBOSE_YES
+  const char* lpc_labelFunc = "inout::dataSetReadMmap";
+  ++geiinparam_verbose;
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ":  IN(" << geiinparam_verbose << ')'
+	      << "\n\t(input inout::InParamReadInst["
+	      << &aiipri_inParamReadInst << "]"
+	      << "\n\t)"
+	      << std::endl;
+  }
+#endif //__VERBOSE_YES
+
+  const std::string lstr_fileBinary =
+    aiipri_inParamReadInst.getCurrentFileInstance() + INSTANCES_BINARY_EXTENSION;
+
+  /*REUSE THE BINARY FILE
+   */
+  bool lb_writeBinary = true;
+  {
+    struct stat lstat_fileInstance;
+    struct stat lstat_fileBinary;
+    if ( stat(aiipri_inParamReadInst.getCurrentFileInstance().c_str(), &lstat_fileInstance) == 0
+	 && stat(lstr_fileBinary.c_str(), &lstat_fileBinary) == 0
+	 && lstat_fileBinary.st_mtime >= lstat_fileInstance.st_mtime ) {
+      try {
+	InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+	  linstmmap_check(lstr_fileBinary);
+	lb_writeBinary =
+	  (linstmmap_check.getKey() != instancesBinaryKey(aiipri_inParamReadInst));
+      }
+      catch (std::exception &ex) {
+	lb_writeBinary = true;
+      }
+    }
+  }
+
+  if ( lb_writeBinary )
+    instancesWriteBinary(aiipri_inParamReadInst,lstr_fileBinary);
+
+  InstancesMmap<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+    lostinstmmap_instances(lstr_fileBinary);
+  std::vector<data::Instance<T_FEATURE>* >  lovectorptinst_instancesTest;
+
+  if ( aiipri_inParamReadInst.getClassInstanceColumn() ) {
+
+    data::InstanceIterfazClass
+      <T_INSTANCES_CLUSTER_K,T_CLUSTERIDX>
+      ::initialize();
+
+    /*THE SAME INDEX OF THE CLASSES OF THE BINARY FILE
+     */
+    data::InstanceClass<T_FEATURE,T_INSTANCES_CLUSTER_K,T_CLUSTERIDX> linstclass_label;
+    for ( auto liter_label: lostinstmmap_instances.getVectorClassLabel() )
+      linstclass_label.setClassIdx(liter_label);
+
+    data::InstanceIterfazClass
+      <T_INSTANCES_CLUSTER_K,
+       T_CLUSTERIDX>
+      ::setVectorClassLabel();
+
+    if ( aiipri_inParamReadInst.getNumFilesInstanceTest() > 0) {
+
+      lovectorptinst_instancesTest =
+	inout::instancesReadWithClass
+	(aiipri_inParamReadInst,
+	 true
+	 );
+    }
+  }
+  else if ( aiipri_inParamReadInst.getNumFilesInstanceTest() > 0) {
+
+    lovectorptinst_instancesTest =
+      inout::instancesRead
+      (aiipri_inParamReadInst,
+       true
+       );
+  }
+
+#ifdef __VERBOSE_YES
+  if ( geiinparam_verbose <= geiinparam_verboseMax ) {
+    std::cout << lpc_labelFunc
+	      << ": OUT(" << geiinparam_verbose << ')'
+	      << std::endl;
+  }
+  --geiinparam_verbose;
+#endif //__VERBOSE_YES
+
+  return std::make_pair(std::move(lostinstmmap_instances), lovectorptinst_instancesTest);
+}
+
+} /*END namespace inout*/
+
+#endif /*__INSTANCES_MMAP_HPP*/
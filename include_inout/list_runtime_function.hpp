@@ -109,6 +109,14 @@ public:
     this->pIntervalZT_domain->increaseUpperBound();
   }
 
+  /*! \fn void setDomainUpperBound(T_INTEGERDOMAIN aiT_upperBound)
+    \brief Continue from a generation, see gacheckpoint::Snapshot
+  */
+  inline void setDomainUpperBound(T_INTEGERDOMAIN aiT_upperBound)
+  {
+    this->pIntervalZT_domain->setUpperBound(aiT_upperBound);
+  }
+
   inline std::string getLabelX()	
   {
     return this->s_labelX;
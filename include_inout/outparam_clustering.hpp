@@ -445,6 +445,10 @@ public:
     , _str_percentageSensitivityTest()
     , _str_percentageSpecificity()
     , _str_percentageSpecificityTest()
+    , _t_silhouetteLower(OUTPARAMCLUSTERING_METRIC_NaN)
+    , _t_silhouetteUpper(OUTPARAMCLUSTERING_METRIC_NaN)
+    , _t_silhouetteLowerTest(OUTPARAMCLUSTERING_METRIC_NaN)
+    , _t_silhouetteUpperTest(OUTPARAMCLUSTERING_METRIC_NaN)
      
   {
    
@@ -486,6 +490,10 @@ public:
     _str_percentageSensitivityTest = "";
     _str_percentageSpecificity = "";
     _str_percentageSpecificityTest = "";
+    _t_silhouetteLower = OUTPARAMCLUSTERING_METRIC_NaN;
+    _t_silhouetteUpper = OUTPARAMCLUSTERING_METRIC_NaN;
+    _t_silhouetteLowerTest = OUTPARAMCLUSTERING_METRIC_NaN;
+    _t_silhouetteUpperTest = OUTPARAMCLUSTERING_METRIC_NaN;
   }
 
   inline void setMetricFunc
@@ -564,6 +572,21 @@ public:
     return _str_percentageSpecificityTest;
   }
 
+  /*! \fn void setSilhouetteBounds(T_METRIC ait_silhouetteLower, T_METRIC ait_silhouetteUpper)
+    \brief Confidence bounds of the silhouette when it is estimated with a sample, see um::ReportPairwise
+  */
+  inline void setSilhouetteBounds(T_METRIC ait_silhouetteLower, T_METRIC ait_silhouetteUpper) 
+  {
+    _t_silhouetteLower = ait_silhouetteLower;
+    _t_silhouetteUpper = ait_silhouetteUpper;
+  }
+
+  inline void setSilhouetteBoundsTest(T_METRIC ait_silhouetteLower, T_METRIC ait_silhouetteUpper) 
+  {
+    _t_silhouetteLowerTest = ait_silhouetteLower;
+    _t_silhouetteUpperTest = ait_silhouetteUpper;
+  }
+
   
   virtual void  print(std::ostream& aipf_outFile=std::cout, const char aic_separator=',') const
   {
@@ -590,6 +613,21 @@ public:
     aipf_outFile << aic_separator << ":specificity"   
 		 << aic_separator <<  _str_percentageSpecificityTest;
 
+    if ( _t_silhouetteLower != OUTPARAMCLUSTERING_METRIC_NaN
+	 || _t_silhouetteUpper != OUTPARAMCLUSTERING_METRIC_NaN ) {
+      aipf_outFile << aic_separator << "_silhouette lower bound"
+		   << aic_separator << _t_silhouetteLower;
+      aipf_outFile << aic_separator << "_silhouette upper bound"
+		   << aic_separator << _t_silhouetteUpper;
+    }
+    if ( _t_silhouetteLowerTest != OUTPARAMCLUSTERING_METRIC_NaN
+	 || _t_silhouetteUpperTest != OUTPARAMCLUSTERING_METRIC_NaN ) {
+      aipf_outFile << aic_separator << ":silhouette lower bound"
+		   << aic_separator << _t_silhouetteLowerTest;
+      aipf_outFile << aic_separator << ":silhouette upper bound"
+		   << aic_separator << _t_silhouetteUpperTest;
+    }
+
    
   }
 
@@ -608,6 +646,10 @@ protected:
   std::string               _str_percentageSensitivityTest;
   std::string               _str_percentageSpecificity;
   std::string               _str_percentageSpecificityTest;
+  T_METRIC                  _t_silhouetteLower;
+  T_METRIC                  _t_silhouetteUpper;
+  T_METRIC                  _t_silhouetteLowerTest;
+  T_METRIC                  _t_silhouetteUpperTest;
   
 }; /*END clas OutParamClusteringMetric*/
 
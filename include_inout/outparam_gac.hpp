@@ -12,6 +12,8 @@
 #define __OUT_PARAM_EA_HPP__
 
 
+#include <cmath>
+#include <string>
 #include "outparam_clustering.hpp"
 
 /*! \namespace inout
@@ -51,7 +53,10 @@ public:
     ::initialize(aii_numRunAlgorithm);
    
     this->t_fitness = OUTPARAMCLUSTERING_FITNESS_NaN;
-    this->t_numTotalGenerations = OUTPARAMCLUSTERING_INT_NaN; 
+    this->t_numTotalGenerations = OUTPARAMCLUSTERING_INT_NaN;
+    this->_t_objetiveFuncMiniBatch = OUTPARAMCLUSTERING_METRIC_NaN;
+    this->_t_errorMiniBatch = OUTPARAMCLUSTERING_METRIC_NaN;
+    this->_str_terminationCriterion.assign("none");
   }
 
   inline T_METRIC getFitness()
@@ -79,6 +84,36 @@ public:
     return this->t_numTotalGenerations;
   }
 
+  /*! \fn void setMiniBatch(T_METRIC ait_objetiveFuncMiniBatch, T_METRIC ait_objetiveFunc)
+    \brief The objective function of the best chromosome estimated on the mini-batch and computed on all the instances
+  */
+  inline void setMiniBatch(T_METRIC ait_objetiveFuncMiniBatch, T_METRIC ait_objetiveFunc)
+  {
+    this->_t_objetiveFuncMiniBatch = ait_objetiveFuncMiniBatch;
+    this->_t_errorMiniBatch =
+      (ait_objetiveFunc != T_METRIC(0))
+      ?std::abs(ait_objetiveFuncMiniBatch - ait_objetiveFunc) / std::abs(ait_objetiveFunc)
+      :std::abs(ait_objetiveFuncMiniBatch);
+  }
+
+  inline T_METRIC getErrorMiniBatch()
+  {
+    return this->_t_errorMiniBatch;
+  }
+
+  /*! \fn void setTerminationCriterion(const std::string& aistr_terminationCriterion)
+    \brief Name of the criterion that stopped the algorithm, see runtime::TerminationCriteria
+  */
+  inline void setTerminationCriterion(const std::string& aistr_terminationCriterion)
+  {
+    this->_str_terminationCriterion = aistr_terminationCriterion;
+  }
+
+  inline const std::string& getTerminationCriterion() const
+  {
+    return this->_str_terminationCriterion;
+  }
+
   virtual void  print(std::ostream& aipf_outFile=std::cout, const char aic_separator=',') const
   {
     OutParamClustering<T_METRIC,T_CLUSTERIDX>::print(aipf_outFile);
@@ -87,12 +122,23 @@ public:
 		 << aic_separator << this->t_fitness;
     aipf_outFile << aic_separator << "_number total generations" 
 		 << aic_separator << this->t_numTotalGenerations;
+    aipf_outFile << aic_separator << "_termination criterion" 
+		 << aic_separator << this->_str_terminationCriterion;
+    if ( this->_t_errorMiniBatch != OUTPARAMCLUSTERING_METRIC_NaN ) {
+      aipf_outFile << aic_separator << "_minibatch objective function"
+		   << aic_separator << this->_t_objetiveFuncMiniBatch;
+      aipf_outFile << aic_separator << "_minibatch relative error"
+		   << aic_separator << this->_t_errorMiniBatch;
+    }
   }
 
 protected:  
 
   T_METRIC        t_fitness;             
-  COMMON_IDOMAIN  t_numTotalGenerations; 
+  COMMON_IDOMAIN  t_numTotalGenerations;
+  T_METRIC        _t_objetiveFuncMiniBatch;
+  T_METRIC        _t_errorMiniBatch;
+  std::string     _str_terminationCriterion;
 
 }; /*OutParamGAC*/
 
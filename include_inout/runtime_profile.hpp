@@ -0,0 +1,253 @@
+/*! \file runtime_profile.hpp
+ *
+ * \brief time, calls and distance evaluations of each phase of an algorithm
+ *
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef RUNTIME_PROFILE_HPP
+#define RUNTIME_PROFILE_HPP
+
+#include <fstream>
+#include <string>
+#include <stdint.h>
+#include "execution_time.hpp"
+#include "dist.hpp"
+#include "common.hpp"
+
+/*! \namespace runtime
+  \brief Module for obtaining run-time statistics
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace runtime {
+
+/*! \enum ProfilePhase
+  \brief Phases of a genetic algorithm, the names are those of geverbosepc_labelstep
+*/
+enum ProfilePhase {
+  PROFILE_INITIALIZE,
+  PROFILE_CLUSTERING,
+  PROFILE_FITNESS,
+  PROFILE_ELITISM,
+  PROFILE_SELECTION,
+  PROFILE_CROSSOVER,
+  PROFILE_MUTATION,
+  PROFILE_NUM_PHASES
+};
+
+const char *garray_nameProfilePhase[] = {
+  "INITIALIZE",
+  "CLUSTERING",
+  "FITNESS",
+  "ELITISM",
+  "SELECTION",
+  "CROSSOVER",
+  "MUTATION"
+};
+
+/*! \class ProfilePhases
+  \brief Time, number of calls and distance evaluations of each phase, per generation and in total
+  \details Disabled until open() is called, then each begin() and end() read the clock and dist::Counter. endGeneration() writes a row with the phases of the generation, the columns are separated as in the files of runtime::ListRuntimeFunction, so the file can be plotted in the same way. close() writes the totals in a comment line #total
+*/
+class ProfilePhases {
+public:
+  ProfilePhases()
+    : _b_enable(false)
+    , _c_separator('\t')
+  {
+    this->_reset(this->_arrayphase_generation);
+    this->_reset(this->_arrayphase_total);
+  }
+
+  ~ProfilePhases()
+  {
+    this->close();
+  }
+
+  /*! \fn void open(const std::string &aistr_fileNamePlotStat, const char aic_separator = '\t')
+    \brief Enable the profile, the file is the name of the plot-stat file with the suffix _profile before the extension
+    \param aistr_fileNamePlotStat the name returned by inout::OutParamClustering::getFileNameOutPlotStatObjetiveFunc
+    \param aic_separator the separator of the columns
+  */
+  void open
+  (const std::string &aistr_fileNamePlotStat,
+   const char        aic_separator = '\t'
+   )
+  {
+    std::string       lstr_fileName(aistr_fileNamePlotStat);
+    const std::size_t lsize_ext = lstr_fileName.rfind(".dat");
+
+    if ( lsize_ext != std::string::npos )
+      lstr_fileName.insert(lsize_ext,"_profile");
+    else
+      lstr_fileName.append("_profile.dat");
+
+    this->_fileout_profile.open
+      (lstr_fileName.c_str(),
+       std::ios::out | std::ios::app
+       );
+    this->_fileout_profile.precision(COMMON_COUT_PRECISION);
+    this->_c_separator = aic_separator;
+    this->_b_enable = this->_fileout_profile.is_open();
+
+    if ( this->_b_enable ) {
+      this->_fileout_profile << "#Iterations";
+      for (int li_i = 0; li_i < PROFILE_NUM_PHASES; li_i++) {
+	this->_fileout_profile
+	  << this->_c_separator << garray_nameProfilePhase[li_i] << "_time"
+	  << this->_c_separator << garray_nameProfilePhase[li_i] << "_calls"
+	  << this->_c_separator << garray_nameProfilePhase[li_i] << "_distances";
+      }
+      this->_fileout_profile << '\n';
+    }
+  }
+
+  inline bool isEnable() const
+  {
+    return this->_b_enable;
+  }
+
+  inline void begin(const ProfilePhase aienum_phase)
+  {
+    if ( this->_b_enable ) {
+      this->_arrayphase_generation[aienum_phase].et_start = runtime::start();
+      this->_arrayphase_generation[aienum_phase].ui_distStart =
+	dist::Counter::getNumEvaluations();
+    }
+  }
+
+  inline void end(const ProfilePhase aienum_phase)
+  {
+    if ( this->_b_enable ) {
+      Phase &lphase_i = this->_arrayphase_generation[aienum_phase];
+      lphase_i.et_time +=
+	runtime::elapsedTime(lphase_i.et_start);
+      lphase_i.ui_numDist +=
+	dist::Counter::getNumEvaluations() - lphase_i.ui_distStart;
+      ++lphase_i.ui_numCalls;
+    }
+  }
+
+  /*! \fn void endGeneration(const COMMON_IDOMAIN aiidomain_generation)
+    \brief Write the row of the generation and add it to the totals
+  */
+  void endGeneration(const COMMON_IDOMAIN aiidomain_generation)
+  {
+    if ( !this->_b_enable )
+      return;
+
+    this->_fileout_profile << aiidomain_generation;
+    this->_print(this->_arrayphase_generation);
+    this->_fileout_profile << '\n';
+    this->_accumulate();
+  }
+
+  /*! \fn void close()
+    \brief Write the totals of the run, including the phases of a generation not finished, and disable the profile
+  */
+  void close()
+  {
+    if ( !this->_b_enable )
+      return;
+
+    this->_accumulate();
+    this->_fileout_profile << "#total";
+    this->_print(this->_arrayphase_total);
+    this->_fileout_profile << '\n';
+    this->_fileout_profile.close();
+    this->_b_enable = false;
+  }
+
+protected:
+
+  struct Phase {
+    ExecutionTime et_start;
+    ExecutionTime et_time;
+    uint64_t      ui_distStart;
+    uint64_t      ui_numCalls;
+    uint64_t      ui_numDist;
+  };
+
+  void _reset(Phase *aoarrayphase_phases)
+  {
+    for (int li_i = 0; li_i < PROFILE_NUM_PHASES; li_i++) {
+      aoarrayphase_phases[li_i].et_time     = runtime::initialize();
+      aoarrayphase_phases[li_i].ui_numCalls = 0;
+      aoarrayphase_phases[li_i].ui_numDist  = 0;
+    }
+  }
+
+  void _accumulate()
+  {
+    for (int li_i = 0; li_i < PROFILE_NUM_PHASES; li_i++) {
+      this->_arrayphase_total[li_i].et_time +=
+	this->_arrayphase_generation[li_i].et_time;
+      this->_arrayphase_total[li_i].ui_numCalls +=
+	this->_arrayphase_generation[li_i].ui_numCalls;
+      this->_arrayphase_total[li_i].ui_numDist +=
+	this->_arrayphase_generation[li_i].ui_numDist;
+    }
+    this->_reset(this->_arrayphase_generation);
+  }
+
+  void _print(const Phase *aiarrayphase_phases)
+  {
+    for (int li_i = 0; li_i < PROFILE_NUM_PHASES; li_i++) {
+      this->_fileout_profile
+	<< this->_c_separator << aiarrayphase_phases[li_i].et_time
+	<< this->_c_separator << aiarrayphase_phases[li_i].ui_numCalls
+	<< this->_c_separator << aiarrayphase_phases[li_i].ui_numDist;
+    }
+  }
+
+  bool          _b_enable;
+  char          _c_separator;
+  std::ofstream _fileout_profile;
+  Phase         _arrayphase_generation[PROFILE_NUM_PHASES];
+  Phase         _arrayphase_total[PROFILE_NUM_PHASES];
+
+}; /*ProfilePhases*/
+
+
+/*! \class ScopedProfilePhase
+  \brief Measures a phase from the declaration to the end of the block
+*/
+class ScopedProfilePhase {
+public:
+  ScopedProfilePhase
+  (ProfilePhases      &aiprofile_phases,
+   const ProfilePhase aienum_phase
+   )
+    : _profile_phases(aiprofile_phases)
+    , _enum_phase(aienum_phase)
+  {
+    this->_profile_phases.begin(aienum_phase);
+  }
+
+  ~ScopedProfilePhase()
+  {
+    this->_profile_phases.end(this->_enum_phase);
+  }
+
+  ScopedProfilePhase(const ScopedProfilePhase &aiscoped_b) = delete;
+  ScopedProfilePhase& operator=(const ScopedProfilePhase &aiscoped_b) = delete;
+
+protected:
+
+  ProfilePhases      &_profile_phases;
+  const ProfilePhase _enum_phase;
+
+}; /*ScopedProfilePhase*/
+
+} /*END namespace runtime
+   */
+
+#endif  /*RUNTIME_PROFILE_HPP*/
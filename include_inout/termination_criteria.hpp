@@ -0,0 +1,173 @@
+/*! \file termination_criteria.hpp
+ *
+ * \brief termination criteria of the evolutionary algorithms
+ *
+ * \version 1.0
+ * \date 2015-2017
+ * \authors Hermes Robles-Berumen <hermes@uaz.edu.mx>\n Sebastian Ventura <sventura@uco.es>\n Amelia Zafra <azafra@uco.es>\n <a href="http://www.uco.es/kdis/">KDIS</a>
+ * \copyright <a href="https://www.gnu.org/licenses/gpl-3.0.en.html">GPLv3</a> license
+ */
+
+#ifndef TERMINATION_CRITERIA_HPP
+#define TERMINATION_CRITERIA_HPP
+
+#include <cmath>
+#include <limits>
+#include "execution_time.hpp"
+#include "inparam_clustering.hpp"
+#include "common.hpp"
+
+/*! \namespace runtime
+  \brief Module for obtaining run-time statistics
+  \details
+
+  \version 1.0
+  \date   2015-2017
+  \copyright GPLv3 license
+*/
+
+namespace runtime {
+
+/*! \enum TerminationCriterion
+  \brief Criterion that stopped the algorithm, TERMINATION_ALGORITHM is a criterion of the algorithm itself
+*/
+enum TerminationCriterion {
+  TERMINATION_NOT_ATTAINED,
+  TERMINATION_GENERATIONS,
+  TERMINATION_EXECUTION_TIME,
+  TERMINATION_STAGNATION,
+  TERMINATION_TARGET_FITNESS,
+  TERMINATION_ALGORITHM
+};
+
+const char *garray_nameTerminationCriterion[] = {
+  "not attained",
+  "generations",
+  "execution time",
+  "stagnation",
+  "target fitness",
+  "algorithm"
+};
+
+/*! \class TerminationCriteria
+  \brief Criteria shared by the evolutionary algorithms: number of generations, execution time, generations without improvement of the best fitness and target fitness
+  \details The options are those of inout::InParamClustering. A generation is stagnant when the best fitness does not exceed the reference by more than getTolStagnation() in relative terms, the reference is the fitness of the last generation that was not stagnant. isAttained must be called once per generation, the first criterion attained is recorded
+*/
+class TerminationCriteria {
+public:
+  TerminationCriteria
+  (const COMMON_IDOMAIN           aiidomain_numMaxGenerations,
+   const inout::InParamClustering &aiinp_inParamClustering
+   )
+    : _idomain_numMaxGenerations(aiidomain_numMaxGenerations)
+    , _rd_maxExecutiontime(aiinp_inParamClustering.getMaxExecutiontime())
+    , _ui_numStagnation(aiinp_inParamClustering.getNumStagnation())
+    , _rd_tolStagnation(aiinp_inParamClustering.getTolStagnation())
+    , _rd_targetFitness(aiinp_inParamClustering.getTargetFitness())
+    , _ui_generationsStagnant(0)
+    , _rd_fitnessReference(-std::numeric_limits<double>::max())
+    , _enum_criterion(TERMINATION_NOT_ATTAINED)
+  {}
+
+  /*! \fn bool isAttained(const COMMON_IDOMAIN aiidomain_generation, const ExecutionTime aiet_elapsed, const double aird_fitnessBest)
+    \brief True when a criterion is attained
+    \param aiidomain_generation the number of generations completed
+    \param aiet_elapsed the execution time, runtime::elapsedTime
+    \param aird_fitnessBest the fitness of the best chromosome found, -std::numeric_limits<double>::max() if it has not been evaluated
+  */
+  bool isAttained
+  (const COMMON_IDOMAIN aiidomain_generation,
+   const ExecutionTime  aiet_elapsed,
+   const double         aird_fitnessBest = -std::numeric_limits<double>::max()
+   )
+  {
+    if ( this->_enum_criterion != TERMINATION_NOT_ATTAINED )
+      return true;
+
+    if ( aird_fitnessBest != -std::numeric_limits<double>::max() ) {
+      if ( aird_fitnessBest >= this->_rd_targetFitness ) {
+	this->_enum_criterion = TERMINATION_TARGET_FITNESS;
+	return true;
+      }
+      if ( this->_rd_fitnessReference == -std::numeric_limits<double>::max()
+	   || aird_fitnessBest - this->_rd_fitnessReference >
+	   this->_rd_tolStagnation * std::abs(this->_rd_fitnessReference) ) {
+	this->_rd_fitnessReference = aird_fitnessBest;
+	this->_ui_generationsStagnant = 0;
+      }
+      else {
+	++this->_ui_generationsStagnant;
+	if ( this->_ui_numStagnation > 0
+	     && this->_ui_generationsStagnant >= this->_ui_numStagnation ) {
+	  this->_enum_criterion = TERMINATION_STAGNATION;
+	  return true;
+	}
+      }
+    }
+
+    if ( aiidomain_generation >= this->_idomain_numMaxGenerations )
+      this->_enum_criterion = TERMINATION_GENERATIONS;
+    else if ( aiet_elapsed >= this->_rd_maxExecutiontime )
+      this->_enum_criterion = TERMINATION_EXECUTION_TIME;
+
+    return ( this->_enum_criterion != TERMINATION_NOT_ATTAINED );
+  }
+
+  /*! \fn void setAttained(const TerminationCriterion aienum_criterion)
+    \brief Record a criterion checked outside, eg. TERMINATION_ALGORITHM
+  */
+  inline void setAttained(const TerminationCriterion aienum_criterion)
+  {
+    if ( this->_enum_criterion == TERMINATION_NOT_ATTAINED )
+      this->_enum_criterion = aienum_criterion;
+  }
+
+  inline TerminationCriterion getCriterion() const
+  {
+    return this->_enum_criterion;
+  }
+
+  inline const char* getNameCriterion() const
+  {
+    return garray_nameTerminationCriterion[this->_enum_criterion];
+  }
+
+  inline uintidx getGenerationsStagnant() const
+  {
+    return this->_ui_generationsStagnant;
+  }
+
+  inline double getFitnessReference() const
+  {
+    return this->_rd_fitnessReference;
+  }
+
+  /*! \fn void setStagnation(const uintidx aiui_generationsStagnant, const double aird_fitnessReference)
+    \brief Continue the count of generations without improvement of a run resumed, see gacheckpoint::Snapshot
+  */
+  inline void setStagnation
+  (const uintidx aiui_generationsStagnant,
+   const double  aird_fitnessReference
+   )
+  {
+    this->_ui_generationsStagnant = aiui_generationsStagnant;
+    this->_rd_fitnessReference = aird_fitnessReference;
+  }
+
+protected:
+
+  COMMON_IDOMAIN       _idomain_numMaxGenerations;
+  double               _rd_maxExecutiontime;
+  uintidx              _ui_numStagnation;
+  double               _rd_tolStagnation;
+  double               _rd_targetFitness;
+  uintidx              _ui_generationsStagnant;
+  double               _rd_fitnessReference;
+  TerminationCriterion _enum_criterion;
+
+}; /*TerminationCriteria*/
+
+} /*END namespace runtime
+   */
+
+#endif  /*TERMINATION_CRITERIA_HPP*/